@@ -11,6 +11,8 @@
 # bench/pr/src/bin/parse
 # bench/main/src/bin/parse2
 # bench/pr/src/bin/parse2
+# bench/main/src/bin/semantics
+# bench/pr/src/bin/semantics
 
 set -ex
 
@@ -0,0 +1,103 @@
+module arrays_92_mod
+implicit none
+
+type :: particles
+    real(8) :: x(100), v(100)
+end type
+
+contains
+
+    subroutine axpy(a, x, y)
+        real(8), intent(in) :: a
+        real(8), intent(in) :: x(:)
+        real(8), intent(inout) :: y(:)
+        integer :: i
+        do i = 1, size(y)
+            y(i) = y(i) + a*x(i)
+        end do
+    end subroutine
+
+    subroutine axpy_n(n, a, x, y)
+        integer, intent(in) :: n
+        real(8), intent(in) :: a, x(n)
+        real(8), intent(inout) :: y(n)
+        integer :: i
+        do i = 1, n
+            y(i) = y(i) + a*x(i)
+        end do
+    end subroutine
+
+    ! Both arguments may be the same array, since neither is modified
+    real(8) function dot(x, y) result(s)
+        real(8), intent(in) :: x(:), y(:)
+        integer :: i
+        s = 0
+        do i = 1, size(x)
+            s = s + x(i)*y(i)
+        end do
+    end function
+
+    ! Targets may overlap each other
+    subroutine shift(a, b)
+        real(8), target, intent(inout) :: a(:), b(:)
+        integer :: i
+        do i = 1, size(a)
+            a(i) = b(i) + 1
+        end do
+    end subroutine
+
+    subroutine step(p, dt)
+        type(particles), intent(inout) :: p
+        real(8), intent(in) :: dt
+        integer :: i
+        do i = 1, size(p%x)
+            p%x(i) = p%x(i) + dt*p%v(i)
+        end do
+    end subroutine
+
+end module
+
+program arrays_92
+use arrays_92_mod
+implicit none
+real(8), target :: x(100), y(100)
+integer(8) :: k(100)
+type(particles) :: p
+integer :: i
+
+do i = 1, 100
+    x(i) = i
+    y(i) = 2*i
+end do
+call axpy(2.0_8, x, y)
+if (abs(y(100) - 400) > 1e-12_8) error stop
+call axpy_n(100, -1.0_8, x, y)
+if (abs(y(100) - 300) > 1e-12_8) error stop
+if (abs(sum(y) - 3*5050) > 1e-9_8) error stop
+
+if (abs(dot(x, x) - 338350) > 1e-9_8) error stop
+
+x = 0
+call shift(x(2:), x(:99))
+print *, x(1), x(50), x(100)
+if (abs(x(100) - 99) > 1e-12_8) error stop
+if (abs(x(50) - 49) > 1e-12_8) error stop
+
+p%x = 0
+p%v = [(i, i = 1, 100)]
+call step(p, 0.5_8)
+call step(p, 0.5_8)
+if (abs(p%x(100) - 100) > 1e-12_8) error stop
+
+! Element by element: the LLVM backend only supports scalar TRANSFER
+do i = 1, 100
+    k(i) = transfer(y(i), k(i))
+end do
+y = 0
+do i = 1, 50
+    y(i) = transfer(k(i), y(i))
+end do
+if (abs(y(50) - 150) > 1e-12_8) error stop
+if (abs(sum(y) - 3*1275) > 1e-9_8) error stop
+print *, sum(y)
+end program
@@ -0,0 +1,54 @@
+! Jacobi sweeps and reductions over `do concurrent` loops, compiled with
+! --do-concurrent=parallel --do-concurrent-schedule=dynamic
+subroutine sweep(n, u, v)
+implicit none
+integer, intent(in) :: n
+real(8), intent(in) :: u(n, n)
+real(8), intent(inout) :: v(n, n)
+integer :: i, j
+do concurrent (i = 2:n-1, j = 2:n-1) shared(u, v)
+    v(i, j) = (u(i-1, j) + u(i+1, j) + u(i, j-1) + u(i, j+1)) / 4
+end do
+end subroutine
+
+program do_concurrent_14
+implicit none
+integer, parameter :: n = 200
+real(8) :: u(n, n), v(n, n), s, big, small, neg, t
+integer :: i, j, step, cnt, expected_cnt
+
+u = 0
+u(:, 1) = 1
+v = u
+do step = 1, 10
+    call sweep(n, u, v)
+    call sweep(n, v, u)
+end do
+
+s = 0
+big = -1
+small = 2
+neg = -3
+cnt = 0
+do concurrent (i = 1:n, j = 1:n) local(t) reduce(+:s, cnt) reduce(max:big, neg) reduce(min:small)
+    t = u(i, j)
+    s = s + t
+    big = max(big, t)
+    small = min(small, t)
+    neg = max(neg, -1 - t)
+    if (t > 0.5d0) cnt = cnt + 1
+end do
+print *, s, big, small, neg, cnt
+expected_cnt = 0
+do j = 1, n
+    do i = 1, n
+        if (u(i, j) > 0.5d0) expected_cnt = expected_cnt + 1
+    end do
+end do
+if (abs(s - sum(u)) > 1e-9_8) error stop
+if (abs(big - 1) > 1e-12_8) error stop
+if (abs(small) > 1e-12_8) error stop
+if (abs(neg + 1) > 1e-12_8) error stop
+if (cnt /= expected_cnt) error stop
+if (abs(u(2, 2) - 0.470365753462829161_8) > 1e-12_8) error stop
+end program
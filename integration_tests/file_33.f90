@@ -0,0 +1,36 @@
+program file_33
+    ! More units open at once than the runtime used to support, and a
+    ! record written over a longer file
+    implicit none
+    integer, parameter :: n = 1010
+    integer :: i, u, x, ios
+    character(len=20) :: name
+
+    do i = 1, n
+        u = 1000 + 7*i
+        write(name, '(a,i0,a)') 'file_33_', i, '.txt'
+        open(u, file=trim(name), status='replace')
+        write(u, *) i
+    end do
+    do i = 1, n
+        u = 1000 + 7*i
+        rewind(u)
+        read(u, *) x
+        if (x /= i) error stop
+        close(u, status='delete')
+    end do
+
+    open(10, file='file_33.txt', status='replace')
+    do i = 1, 100
+        write(10, *) i
+    end do
+    rewind(10)
+    write(10, *) 42
+    rewind(10)
+    read(10, *) x
+    if (x /= 42) error stop
+    read(10, *, iostat=ios) x
+    if (ios == 0) error stop
+    close(10, status='delete')
+    print *, "ok"
+end program file_33
@@ -0,0 +1,35 @@
+program file_34
+    ! Unformatted records larger than the unit buffer, and records of many items
+    implicit none
+    integer :: u, i
+    integer, allocatable :: a(:), b(:)
+    real(8), allocatable :: x(:), y(:)
+    integer :: k(3)
+
+    allocate(a(100000), b(100000), x(50000), y(50000))
+    do i = 1, size(a)
+        a(i) = 3*i - 7
+    end do
+    do i = 1, size(x)
+        x(i) = i / 8.0d0
+    end do
+
+    open(newunit=u, file='file_34.dat', form='unformatted', access='sequential', status='replace')
+    write(u) a
+    close(u)
+    open(newunit=u, file='file_34.dat', form='unformatted', access='sequential', status='old')
+    read(u) b
+    close(u, status='delete')
+    if (any(a /= b)) error stop
+    print *, b(1), b(size(b))
+
+    open(newunit=u, file='file_34.dat', form='unformatted', access='stream', status='replace')
+    write(u) x, 1, 2, 3
+    rewind(u)
+    read(u) y
+    read(u) k
+    close(u, status='delete')
+    if (any(x /= y)) error stop
+    if (any(k /= [1, 2, 3])) error stop
+    print *, y(size(y)), k
+end program file_34
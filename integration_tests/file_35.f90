@@ -0,0 +1,50 @@
+program file_35
+    ! Asynchronous WRITEs completed by WAIT, and INQUIRE(PENDING=)
+    implicit none
+    integer :: u, v, i, k, ios
+    integer :: ids(4), id
+    logical :: pending
+    real(8), allocatable :: x(:,:), y(:)
+    character(len=20) :: line
+
+    allocate(x(100000,4), y(100000))
+    open(newunit=u, file='file_35.dat', form='unformatted', access='sequential', &
+        status='replace', asynchronous='yes')
+    do k = 1, 4
+        do i = 1, size(x, 1)
+            x(i,k) = k + i / 8.0d0
+        end do
+        write(u, asynchronous='yes', id=ids(k)) x(:,k)
+    end do
+    wait(u, id=ids(2), iostat=ios)
+    if (ios /= 0) error stop
+    inquire(u, id=ids(2), pending=pending)
+    if (pending) error stop
+    wait(u)
+    inquire(u, pending=pending)
+    if (pending) error stop
+    close(u)
+
+    open(newunit=u, file='file_35.dat', form='unformatted', access='sequential', status='old')
+    do k = 1, 4
+        read(u) y
+        if (abs(y(1) - (k + 1 / 8.0d0)) > 1d-12) error stop
+        if (abs(y(size(y)) - (k + size(y) / 8.0d0)) > 1d-12) error stop
+    end do
+    close(u, status='delete')
+
+    open(newunit=v, file='file_35.txt', status='replace', asynchronous='yes')
+    write(v, '(a)', asynchronous='yes', id=id) 'first'
+    write(v, '(a)') 'second'
+    write(v, '(i0)', asynchronous='yes', id=id) 3
+    wait(v, id=id)
+    rewind(v)
+    read(v, '(a)') line
+    if (line /= 'first') error stop
+    read(v, '(a)') line
+    if (line /= 'second') error stop
+    read(v, *) i
+    if (i /= 3) error stop
+    close(v, status='delete')
+    print *, y(size(y)), i
+end program file_35
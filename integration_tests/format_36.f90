@@ -0,0 +1,36 @@
+program format_36
+    ! The same constant format used many times and from several statements
+    implicit none
+    character(len=*), parameter :: fmt = '(2(I2, 2(I3)))'
+    character(len=40) :: line
+    integer :: i, j
+    real(8) :: x
+
+    do i = 1, 1000
+        x = i / 4.0d0
+        write(line, '(I5, 2(F8.2, 1X), A)') i, x, -x, 'ok'
+        if (i == 3) then
+            print *, line
+            if (line /= '    3    0.75    -0.75 ok') error stop
+        end if
+        if (i == 1000) then
+            print *, line
+            if (line /= ' 1000  250.00  -250.00 ok') error stop
+        end if
+    end do
+
+    do i = 1, 3
+        write(line, fmt) (i * j, j = 1, 6)
+        print *, line
+        if (i == 1 .and. line /= ' 1  2  3 4  5  6') error stop
+        if (i == 3 .and. line /= ' 3  6  912 15 18') error stop
+    end do
+
+    write(line, fmt) 6, 5, 4, 3, 2, 1
+    print *, line
+    if (line /= ' 6  5  4 3  2  1') error stop
+
+    write(line, '(I5, 2(F8.2, 1X), A)') 7, 1.5d0, 2.0d0, 'ab'
+    print *, line
+    if (line /= '    7    1.50     2.00 ab') error stop
+end program format_36
@@ -0,0 +1,39 @@
+program format_37
+    ! Rounding of reals by the F, E, ES, EN and D edit descriptors
+    implicit none
+    character(len=20) :: s
+
+    write(s, '(F10.4)') 3.14159265d0
+    print *, s
+    if (s /= '    3.1416') error stop
+    write(s, '(F8.3)') -0.0004d0
+    print *, s
+    if (s /= '  -0.000') error stop
+    write(s, '(F12.2)') 123456.789d0
+    print *, s
+    if (s /= '   123456.79') error stop
+    write(s, '(ES12.4)') 12345.678d0
+    print *, s
+    if (s /= '  1.2346E+04') error stop
+    write(s, '(E12.4)') 0.000123456d0
+    print *, s
+    if (s /= '  0.1235E-03') error stop
+    write(s, '(E15.6E3)') 1.0d-100
+    print *, s
+    if (s /= '  0.100000E-099') error stop
+    write(s, '(EN12.3)') 123456.0d0
+    print *, s
+    if (s /= ' 123.456E+03') error stop
+    write(s, '(EN12.3)') 0.00456d0
+    print *, s
+    if (s /= '   4.560E-03') error stop
+    write(s, '(D12.4)') -2.5d10
+    print *, s
+    if (s /= ' -0.2500D+11') error stop
+    write(s, '(1P,E12.4)') 6.02214076d23
+    print *, s
+    if (s /= '  6.0221E+23') error stop
+    write(s, '(ES12.4)') 0.0d0
+    print *, s
+    if (s /= '  0.0000E+00') error stop
+end program format_37
@@ -0,0 +1,55 @@
+program intrinsics_382
+! random_number, random_seed(put/get) and random_init
+implicit none
+integer :: n, i
+integer, allocatable :: seed(:), seed2(:)
+real(8) :: a(1000), b(1000), c(7, 9)
+real :: d(501)
+real(8) :: x
+
+call random_seed(size=n)
+allocate(seed(n), seed2(n))
+seed = [(37 * i + 5, i = 1, n)]
+call random_seed(put=seed)
+call random_seed(get=seed2)
+if (any(seed /= seed2)) error stop
+
+! Putting the same seed repeats the sequence, whether the values are
+! drawn one at a time or for a whole array
+call random_number(a)
+call random_seed(put=seed)
+do i = 1, size(b)
+    call random_number(b(i))
+end do
+if (any(a /= b)) error stop
+if (minval(a) < 0 .or. maxval(a) >= 1) error stop
+if (abs(sum(a) / size(a) - 0.5d0) > 0.05d0) error stop
+
+! Non-contiguous sections are filled element by element
+call random_seed(put=seed)
+b = 2
+call random_number(b(1:1000:2))
+if (any(b(2:1000:2) /= 2)) error stop
+if (any(b(1:1000:2) >= 1)) error stop
+
+! The seed got after some draws is the live state, so putting it back
+! continues the sequence from there
+call random_number(x)
+call random_seed(get=seed2)
+call random_number(a)
+call random_seed(put=seed2)
+call random_number(b)
+if (any(a /= b)) error stop
+
+call random_number(c)
+if (minval(c) < 0 .or. maxval(c) >= 1) error stop
+call random_number(d)
+if (minval(d) < 0 .or. maxval(d) >= 1) error stop
+
+call random_init(.true., .true.)
+call random_number(x)
+call random_init(.true., .true.)
+call random_number(a(1))
+if (x /= a(1)) error stop
+print *, "ok"
+end program
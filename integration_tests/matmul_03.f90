@@ -0,0 +1,120 @@
+module matmul_03_mod
+implicit none
+
+contains
+
+    subroutine reference_r8(a, b, c)
+    real(8), intent(in) :: a(:,:), b(:,:)
+    real(8), intent(out) :: c(:,:)
+    integer :: i, j, k
+    c = 0
+    do j = 1, size(b, 2)
+    do k = 1, size(a, 2)
+    do i = 1, size(a, 1)
+        c(i,j) = c(i,j) + a(i,k)*b(k,j)
+    end do
+    end do
+    end do
+    end subroutine
+
+    subroutine reference_c8(a, b, c)
+    complex(8), intent(in) :: a(:,:), b(:,:)
+    complex(8), intent(out) :: c(:,:)
+    integer :: i, j, k
+    c = 0
+    do j = 1, size(b, 2)
+    do k = 1, size(a, 2)
+    do i = 1, size(a, 1)
+        c(i,j) = c(i,j) + a(i,k)*b(k,j)
+    end do
+    end do
+    end do
+    end subroutine
+
+end module
+
+program matmul_03
+use matmul_03_mod
+implicit none
+! The sizes cross the blocks of the runtime kernel in every dimension
+integer, parameter :: m = 150, n = 130, k = 270
+real(8), allocatable :: a(:,:), b(:,:), c(:,:), r(:,:), x(:), y(:)
+real(4), allocatable :: a4(:,:), b4(:,:), c4(:,:)
+complex(8), allocatable :: za(:,:), zb(:,:), zc(:,:), zr(:,:)
+complex(4), allocatable :: ca(:,:), cb(:,:), cc(:,:)
+integer, allocatable :: ia(:,:), ib(:,:), ic(:,:)
+real(8) :: s
+integer :: i, j
+
+allocate(a(m, k), b(k, n), c(m, n), r(m, n))
+do j = 1, k
+do i = 1, m
+    a(i, j) = modulo(i + 2*j, 7) - 3
+end do
+end do
+do j = 1, n
+do i = 1, k
+    b(i, j) = modulo(3*i + j, 5) / 4.0_8
+end do
+end do
+call reference_r8(a, b, r)
+
+c = matmul(a, b)
+if (maxval(abs(c - r)) > 1e-10_8) error stop
+print *, sum(c)
+
+! Sections are not contiguous
+c = 0
+c(1:m:2, :) = matmul(a(1:m:2, :), b)
+if (maxval(abs(c(1:m:2, :) - r(1:m:2, :))) > 1e-10_8) error stop
+c(:, 1:n-1) = matmul(a, b(:, 1:n-1))
+if (maxval(abs(c(:, 1:n-1) - r(:, 1:n-1))) > 1e-10_8) error stop
+
+c = matmul(transpose(transpose(a)), b)
+if (maxval(abs(c - r)) > 1e-10_8) error stop
+
+! Matrix times vector and vector times matrix
+allocate(x(k), y(m))
+x = b(:, 3)
+y = matmul(a, x)
+if (maxval(abs(y - r(:, 3))) > 1e-10_8) error stop
+x = matmul(a(5, :), b)
+if (maxval(abs(x(1:n) - r(5, :))) > 1e-10_8) error stop
+
+allocate(a4(m, k), b4(k, n), c4(m, n))
+a4 = real(a, 4)
+b4 = real(b, 4)
+c4 = matmul(a4, b4)
+if (maxval(abs(c4 - r)) > 1e-5_8 * maxval(abs(r))) error stop
+
+allocate(za(m, k), zb(k, n), zc(m, n), zr(m, n))
+za = cmplx(a, a(:, k:1:-1), 8)
+zb = cmplx(b / 2, -b, 8)
+call reference_c8(za, zb, zr)
+zc = matmul(za, zb)
+if (maxval(abs(zc - zr)) > 1e-10_8) error stop
+print *, sum(zc)
+
+allocate(ca(m, k), cb(k, n), cc(m, n))
+ca = cmplx(za, kind=4)
+cb = cmplx(zb, kind=4)
+cc = matmul(ca, cb)
+zc = cc
+if (maxval(abs(zc - zr)) > 1e-5_8 * maxval(abs(zr))) error stop
+
+allocate(ia(m, k), ib(k, n), ic(m, n))
+ia = int(a)
+ib = int(4*b)
+ic = matmul(ia, ib)
+if (maxval(abs(ic - nint(4*r))) /= 0) error stop
+
+! An empty inner dimension gives zeros
+c = matmul(a(:, 1:0), b(1:0, :))
+if (maxval(abs(c)) /= 0) error stop
+
+s = dot_product(a(:, 1), a(:, 1))
+if (abs(s - sum(a(:, 1)**2)) > 1e-10_8) error stop
+s = dot_product(a(1, :), b(:, 1))
+if (abs(s - r(1, 1)) > 1e-10_8) error stop
+print *, s
+end program
@@ -0,0 +1,30 @@
+program openmp_47
+! Formatted WRITE to one unit from several threads
+use omp_lib
+implicit none
+integer, parameter :: n = 4000
+integer :: i, j, u, ios
+logical :: seen(n)
+
+call omp_set_num_threads(8)
+open(newunit=u, file="openmp_47.txt", status="replace", form="formatted")
+!$omp parallel do private(i)
+do i = 1, n
+    write(u, "(I8)") i
+end do
+!$omp end parallel do
+close(u)
+
+seen = .false.
+open(newunit=u, file="openmp_47.txt", status="old", form="formatted")
+do i = 1, n
+    read(u, *, iostat=ios) j
+    if (ios /= 0) error stop
+    if (j < 1 .or. j > n) error stop
+    if (seen(j)) error stop
+    seen(j) = .true.
+end do
+close(u, status="delete")
+if (.not. all(seen)) error stop
+print *, "ok"
+end program
@@ -0,0 +1,39 @@
+module opt_level_01_mod
+implicit none
+
+contains
+
+    pure real(8) function norm2_sq(x) result(s)
+    real(8), intent(in) :: x(:)
+    integer :: i
+    s = 0
+    do i = 1, size(x)
+        s = s + x(i)**2
+    end do
+    end function
+
+    recursive integer function fib(n) result(r)
+    integer, intent(in) :: n
+    if (n < 2) then
+        r = n
+    else
+        r = fib(n - 1) + fib(n - 2)
+    end if
+    end function
+
+end module
+
+program opt_level_01
+! Compiled with an explicit `-O` level, `-march` and `-mtune`
+use opt_level_01_mod
+implicit none
+real(8) :: x(1000)
+integer :: i
+
+do i = 1, size(x)
+    x(i) = i
+end do
+if (abs(norm2_sq(x) - 333833500) > 1e-6_8) error stop
+if (fib(20) /= 6765) error stop
+print *, norm2_sq(x), fib(20)
+end program
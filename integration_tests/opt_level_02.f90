@@ -0,0 +1,16 @@
+program opt_level_02
+! Compiled with `-Ofast`, which is `-O3 --fast`
+implicit none
+real(8) :: x(1000), s
+integer :: i
+
+do i = 1, size(x)
+    x(i) = 1.0_8 / i
+end do
+s = 0
+do i = 1, size(x)
+    s = s + x(i)
+end do
+if (abs(s - 7.4854708605503449_8) > 1e-12_8) error stop
+print *, s
+end program
@@ -0,0 +1,13 @@
+! Compiled with `-j 2` by test_lfortran_cmdline, with the files in reverse
+! `use` order. `next` is not called, since a submodule procedure in another
+! file is not linked yet; the submodule only checks that it is compiled
+! after its parent.
+program parallel_compilation_01
+use, intrinsic :: iso_fortran_env, only: int64
+use parallel_compilation_01b, only: base, twice
+implicit none
+integer(int64) :: i
+i = twice(base) + 1
+print *, i
+if (i /= 81) error stop
+end program
@@ -0,0 +1,14 @@
+module parallel_compilation_01a
+use, intrinsic :: iso_fortran_env, only: int64
+implicit none
+
+integer(int64), parameter :: base = 40
+
+contains
+
+    integer(int64) function twice(x) result(r)
+    integer(int64), intent(in) :: x
+    r = 2 * x
+    end function
+
+end module
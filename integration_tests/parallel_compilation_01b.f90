@@ -0,0 +1,13 @@
+module parallel_compilation_01b
+use parallel_compilation_01a, only: base, twice
+use, intrinsic :: iso_fortran_env, only: int64
+implicit none
+
+interface
+    module function next(x) result(r)
+    integer(int64), intent(in) :: x
+    integer(int64) :: r
+    end function
+end interface
+
+end module
@@ -0,0 +1,9 @@
+submodule (parallel_compilation_01b) parallel_compilation_01c
+implicit none
+contains
+    module function next(x) result(r)
+    integer(int64), intent(in) :: x
+    integer(int64) :: r
+    r = twice(x) + 1
+    end function
+end submodule
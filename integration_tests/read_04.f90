@@ -0,0 +1,30 @@
+program read_04
+    ! List-directed reads of reals and integers, separated by blanks or
+    ! commas, with d exponents and more digits than a double holds
+    implicit none
+    real(8) :: x(3), y
+    real :: z
+    integer :: i(3)
+    integer(8) :: k
+    integer :: unit
+
+    open(newunit=unit, file="read_04_data.txt")
+    read(unit, *) x
+    if (x(1) /= 1500.0d0) error stop
+    if (x(2) /= -2.5d-3) error stop
+    if (x(3) /= 0.1d0) error stop
+    read(unit, *) y
+    if (y /= 3.0d0) error stop
+    read(unit, *) i
+    if (i(1) /= 12) error stop
+    if (i(2) /= -7) error stop
+    if (i(3) /= 2147483647) error stop
+    read(unit, *) k
+    if (k /= -huge(k) - 1) error stop
+    rewind(unit)
+    read(unit, *) z
+    if (z /= 1500.0) error stop
+    close(unit)
+
+    print *, x, y, i, k, z
+end program read_04
@@ -0,0 +1,33 @@
+program separate_compilation_13
+! Compiled with `-flto=thin`: the objects are LLVM bitcode that is compiled
+! together when linking
+use separate_compilation_13a_module
+use iso_c_binding, only: c_int
+implicit none
+interface
+    integer(c_int) function call_twice(i) bind(c, name="separate_compilation_13_call_twice")
+    import :: c_int
+    integer(c_int), value, intent(in) :: i
+    end function
+end interface
+integer :: i, step
+real(8) :: s
+
+do i = 1, n
+    call set_x(i, real(i, 8))
+end do
+do step = 1, 10
+    do i = 1, n
+        call set_x(i, get_x(i) + 0.5_8)
+    end do
+    call count_call()
+end do
+s = 0
+do i = 1, n
+    s = s + get_x(i)
+end do
+print *, s, calls
+if (abs(s - 5550) > 1e-10_8) error stop
+if (calls /= 10) error stop
+if (call_twice(21) /= 42) error stop
+end program
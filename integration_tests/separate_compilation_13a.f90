@@ -0,0 +1,32 @@
+module separate_compilation_13a_module
+use iso_c_binding, only: c_int
+implicit none
+integer, parameter :: n = 100
+real(8) :: x(n)
+integer :: calls = 0
+
+contains
+
+    ! Accessors that ThinLTO inlines into the loops of the other file
+    real(8) function get_x(i)
+    integer, intent(in) :: i
+    get_x = x(i)
+    end function
+
+    subroutine set_x(i, value)
+    integer, intent(in) :: i
+    real(8), intent(in) :: value
+    x(i) = value
+    end subroutine
+
+    subroutine count_call()
+    calls = calls + 1
+    end subroutine
+
+    ! Only called from C, so it must stay visible after the link
+    integer(c_int) function twice(i) bind(c, name="separate_compilation_13_twice")
+    integer(c_int), value, intent(in) :: i
+    twice = 2*i
+    end function
+
+end module
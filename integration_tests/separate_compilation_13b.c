@@ -0,0 +1,5 @@
+int separate_compilation_13_twice(int i);
+
+int separate_compilation_13_call_twice(int i) {
+    return separate_compilation_13_twice(i);
+}
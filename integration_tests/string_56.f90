@@ -0,0 +1,33 @@
+program string_56
+! Appending to an allocatable character variable in place
+implicit none
+character(:), allocatable :: s, t
+character(len=3) :: c
+integer :: i
+
+s = "ab"
+s = s // "cd"
+if (s /= "abcd") error stop
+
+s = s // s
+if (s /= "abcdabcd") error stop
+
+s = "ab"
+s = s // "cd" // s // "e"
+if (s /= "abcdabe") error stop
+
+c = "x  "
+s = ""
+do i = 1, 1000
+    s = s // "f," // c
+end do
+if (len(s) /= 5000) error stop
+if (s(1:6) /= "f,x  f") error stop
+if (s(4996:5000) /= "f,x  ") error stop
+
+t = "z"
+s = "y"
+s = s // trim(t) // t
+if (s /= "yzz") error stop
+print *, len(s), s
+end program
@@ -0,0 +1,79 @@
+program string_57
+! Appending in place after each kind of write to an allocatable character
+! variable: the appended length must follow the length of the variable
+implicit none
+character(:), allocatable :: s, t
+character(len=20) :: line
+integer :: u
+
+allocate(character(3) :: s)
+s(1:3) = "abc"
+s = s // "d"
+if (s /= "abcd" .or. len(s) /= 4) error stop 1
+
+s(2:3) = "XY"
+s = s // "e"
+if (s /= "aXYde" .or. len(s) /= 5) error stop 2
+
+call fill(s)
+s = s // "f"
+if (s /= "zz   f" .or. len(s) /= 6) error stop 3
+
+call reset(s)
+s = s // "g"
+if (s /= "newg" .or. len(s) /= 4) error stop 4
+
+s = f()
+s = s // "h"
+if (s /= "fnh" .or. len(s) /= 3) error stop 5
+
+open(newunit=u, status="scratch")
+write(u, '(a)') "qwerty"
+rewind(u)
+read(u, '(a)') s
+close(u)
+s = s // "i"
+if (s /= "qwei" .or. len(s) /= 4) error stop 6
+
+t = "mv"
+call move_alloc(t, s)
+s = s // "j"
+if (s /= "mvj" .or. len(s) /= 3) error stop 7
+
+line = "fixed"
+s = line
+s = s // "k"
+if (len(s) /= 21 .or. s(21:21) /= "k") error stop 8
+s = trim(line)
+s = s // "l"
+if (s /= "fixedl" .or. len(s) /= 6) error stop 9
+
+deallocate(s)
+allocate(character(2) :: s)
+s(:) = "op"
+s = s // "q"
+if (s /= "opq" .or. len(s) /= 3) error stop 10
+
+s = repeat("ab", 3)
+s = s // "c"
+if (s /= "abababc" .or. len(s) /= 7) error stop 11
+print *, s
+
+contains
+
+    subroutine fill(x)
+    character(*), intent(inout) :: x
+    x = "zz"
+    end subroutine
+
+    subroutine reset(x)
+    character(:), allocatable, intent(inout) :: x
+    x = "new"
+    end subroutine
+
+    function f() result(r)
+    character(:), allocatable :: r
+    r = "fn"
+    end function
+
+end program
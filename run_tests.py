@@ -1,6 +1,7 @@
 #!/usr/bin/env python
 
 import os
+import re
 import subprocess as sp
 import sys
 from typing import Dict
@@ -8,7 +9,8 @@ from typing import Dict
 ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__)))
 sys.path.append(os.path.join(ROOT_DIR, "src", "libasr"))
 
-from compiler_tester.tester import color, fg, log, run_test, style, tester_main
+from compiler_tester.tester import (RunException, check, color, fg, log,
+    run_test, style, tester_main)
 
 def run_cmd(cmd, cwd=None):
     print(f"+ {cmd}")
@@ -17,6 +19,31 @@ def run_cmd(cmd, cwd=None):
         print("Command failed.")
         exit(1)
 
+def normalize_unique_names(output):
+    # With --generate-object-code, mangled names end with the random ID of
+    # the run, and the names of some generated procedures contain the address
+    # of their ASR node, which both differ from run to run
+    output = re.sub(rb"[A-Za-z0-9]{22}\b", b"<ID>", output)
+    return re.sub(rb"_[0-9]{10,}_", b"_<ADDRESS>_", output)
+
+def check_pass_jobs(filename, cmd, extra_args, normalize=False):
+    # Running the function-local passes on a thread pool must not change the
+    # output, so compare `--pass-jobs 4` against the serial run directly
+    cmd = cmd.format(infile=os.path.join("tests", filename)) + " " + extra_args
+    serial = sp.run(cmd, shell=True, capture_output=True)
+    parallel = sp.run(cmd + " --pass-jobs 4", shell=True, capture_output=True)
+    if normalize:
+        for p in (serial, parallel):
+            p.stdout = normalize_unique_names(p.stdout)
+            p.stderr = normalize_unique_names(p.stderr)
+    if (serial.returncode, serial.stdout, serial.stderr) != \
+            (parallel.returncode, parallel.stdout, parallel.stderr):
+        log.error(f"{filename} * pass_jobs    output differs from the serial run")
+        log.error(f"    {cmd}")
+        raise RunException("--pass-jobs 4 output differs from the serial "
+            "run for %s" % filename)
+    log.debug(f"{filename} * pass_jobs    {check()}")
+
 def single_test(test: Dict, verbose: bool, no_llvm: bool, skip_run_with_dbg: bool,
                 update_reference: bool, verify_hash: bool,
                 no_color: bool, specific_backends=None,
@@ -82,6 +109,7 @@ def single_test(test: Dict, verbose: bool, no_llvm: bool, skip_run_with_dbg: boo
     fast = is_included("fast")
     print_leading_space = is_included("print_leading_space")
     interactive = is_included("interactive")
+    pass_jobs = is_included("pass_jobs")
     options = test.get("options", "")
     pass_ = test.get("pass", None)
     extrafiles = test.get("extrafiles", "").split(",")
@@ -635,6 +663,20 @@ def single_test(test: Dict, verbose: bool, no_llvm: bool, skip_run_with_dbg: boo
                 verify_hash,
                 extra_args)
 
+    if pass_jobs:
+        if no_llvm:
+            log.info(f"{filename} * pass_jobs    SKIPPED as requested")
+        else:
+            check_pass_jobs(filename, "lfortran --no-color --show-llvm {infile}",
+                extra_args)
+            # The mangling of separate compilation, as in the integration
+            # tests built with LLVM_GOC
+            check_pass_jobs(filename, "lfortran --no-color --show-llvm "
+                "--generate-object-code {infile}", extra_args, normalize=True)
+        if test.get("pass", None) is not None:
+            check_pass_jobs(filename, "lfortran --pass=" + test["pass"] +
+                " --show-asr --no-color {infile}", extra_args)
+
     if run_with_dbg:
         if skip_run_with_dbg:
             log.info(f"{filename} * run_with_dbg   SKIPPED as requested")
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+/*
+ * Simulates a time stepping loop that writes a checkpoint of N reals (2^22 by
+ * default) every step, the way `write(u) x` and
+ * `write(u, asynchronous='yes', id=id) x` followed by `wait(u)` do, and
+ * reports the time per step of the computation alone, of the writes alone,
+ * and of both with synchronous and with asynchronous writes. With
+ * asynchronous writes the time per step should approach the larger of the
+ * first two rather than their sum.
+ *
+ * Usage: async_write [N] [STEPS]
+ */
+
+static double compute(std::vector<double> &x)
+{
+    double s = 0;
+    for (int r = 0; r < 8; r++) {
+        for (std::size_t i = 0; i < x.size(); i++) {
+            x[i] = std::sqrt(x[i] * x[i] + 1.0) - 0.5;
+            s += x[i];
+        }
+    }
+    return s;
+}
+
+static void write_checkpoint(int32_t unit, std::vector<double> &x, bool async)
+{
+    if (async) _lfortran_async_begin(unit);
+    _lfortran_file_write(unit, nullptr, "",
+        (int64_t)(x.size() * sizeof(double)), x.data(), (int64_t)-1);
+    if (async) _lfortran_async_end();
+}
+
+int main(int argc, char *argv[])
+{
+    int64_t N = argc > 1 ? std::atoll(argv[1]) : (1 << 22);
+    int steps = argc > 2 ? std::atoi(argv[2]) : 20;
+    const int32_t unit = 10;
+    char filename[] = "async_write.dat";
+    std::vector<double> x(N, 1.0);
+    double checksum = 0;
+
+    const char *modes[] = {"compute only", "write only", "synchronous",
+        "asynchronous"};
+    for (int mode = 0; mode < 4; mode++) {
+        _lfortran_open(unit, filename, (char*)"replace", (char*)"unformatted",
+            (char*)"sequential", nullptr, nullptr);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int step = 0; step < steps; step++) {
+            if (mode != 1) checksum += compute(x);
+            if (mode != 0) write_checkpoint(unit, x, mode == 3);
+        }
+        _lfortran_wait(unit, -1, nullptr);
+        _lfortran_flush(unit);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        _lfortran_close(unit, (char*)"delete");
+        double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        std::cout << modes[mode] << ": " << ms / steps << " ms per step"
+            << std::endl;
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <bin/compilation_cache.h>
+#include <libasr/config.h>
+#include <libasr/string_utils.h>
+
+namespace LCompilers::LFortran {
+
+namespace {
+
+    /*
+        128-bit digest made of two independent 64-bit lanes: FNV-1a and a
+        multiplicative hash with a different prime and rotation. Not
+        cryptographic, but collisions between build inputs are negligible.
+    */
+    class Hasher {
+    public:
+        void update(const std::string &s) {
+            for (unsigned char c : s) {
+                a = (a ^ c) * 0x100000001b3ULL;
+                b = ((b ^ c) * 0x9e3779b97f4a7c15ULL);
+                b = (b << 31) | (b >> 33);
+            }
+            // Separate consecutive fields, so that "ab" + "c" != "a" + "bc"
+            a = (a ^ s.size()) * 0x100000001b3ULL;
+            b = (b ^ s.size()) * 0x9e3779b97f4a7c15ULL;
+        }
+
+        std::string hexdigest() const {
+            static const char *digits = "0123456789abcdef";
+            std::string r;
+            for (uint64_t lane : {a, b}) {
+                for (int i = 60; i >= 0; i -= 4) r += digits[(lane >> i) & 0xf];
+            }
+            return r;
+        }
+
+    private:
+        uint64_t a = 0xcbf29ce484222325ULL;
+        uint64_t b = 0x84222325cbf29ce4ULL;
+    };
+
+    std::string b2s(bool b) {
+        return b ? "1" : "0";
+    }
+
+    // The options that can change the generated object or .mod files, or
+    // the rendering of the diagnostics that a hit replays
+    std::string options_fingerprint(const CompilerOptions &co) {
+        const PassOptions &po = co.po;
+        std::string s;
+        s += b2s(co.fixed_form) + b2s(co.interactive) + b2s(co.c_preprocessor)
+            + b2s(co.prescan) + b2s(co.disable_main) + b2s(co.symtab_only)
+            + b2s(co.fast) + b2s(co.openmp) + b2s(co.continue_compilation)
+            + b2s(co.generate_object_code) + b2s(co.separate_compilation)
+            + b2s(co.logical_casting) + b2s(co.enable_bounds_checking)
+            + b2s(co.implicit_typing) + b2s(co.implicit_interface)
+            + b2s(co.implicit_argument_casting) + b2s(co.print_leading_space)
+            + b2s(co.rtlib) + b2s(co.use_loop_variable_after_loop)
+            + b2s(co.emit_debug_info) + b2s(co.emit_debug_line_column)
+            + b2s(co.legacy_array_sections) + b2s(co.ignore_pragma)
+            + b2s(co.stack_arrays) + b2s(co.no_alias_metadata);
+        s += ";" + b2s(co.no_warnings) + b2s(co.disable_style)
+            + b2s(co.no_error_banner) + b2s(co.use_colors)
+            + b2s(co.show_stacktrace) + ";" + co.error_format;
+        s += ";" + co.target + ";" + pf2s(co.platform);
+        s += ";O" + std::to_string(co.opt_level) + std::to_string(co.size_level)
+            + b2s(co.thin_lto_prelink) + b2s(co.thin_lto) + ";" + co.march
+            + ";" + co.mtune;
+        for (auto &d : co.c_preprocessor_defines) s += ";D" + d;
+        s += ";" + std::to_string(po.default_integer_kind)
+            + b2s(po.fast) + b2s(po.disable_main)
+            + b2s(po.use_loop_variable_after_loop) + b2s(po.realloc_lhs)
+            + b2s(po.module_name_mangling)
+            + b2s(po.intrinsic_module_name_mangling)
+            + b2s(po.global_symbols_mangling)
+            + b2s(po.intrinsic_symbols_mangling)
+            + b2s(po.all_symbols_mangling) + b2s(po.bindc_mangling)
+            + b2s(po.fortran_mangling) + b2s(po.mangle_underscore)
+            + b2s(po.openmp) + b2s(po.do_concurrent_parallel)
+            + b2s(po.do_concurrent_lfortran_runtime)
+            + b2s(po.do_concurrent_dynamic) + b2s(po.enable_gpu_offloading)
+            + b2s(po.skip_removal_of_unused_procedures_in_pass_array_by_data);
+        s += ";" + std::to_string(po.unroll_factor)
+            + ";" + std::to_string(po.do_concurrent_chunk);
+        for (auto &i : po.skip_optimization_func_instantiation) {
+            s += ";S" + std::to_string(i);
+        }
+        return s;
+    }
+
+    bool write_file(const std::filesystem::path &path, const std::string &text) {
+        std::ofstream out(path, std::ofstream::out | std::ofstream::binary);
+        out << text;
+        out.close();
+        return out.good();
+    }
+
+} // namespace
+
+std::atomic<int> CompilationCache::hits{0};
+std::atomic<int> CompilationCache::misses{0};
+
+CompilationCache::CompilationCache(const std::filesystem::path &cache_dir)
+    : cache_dir{cache_dir}
+{
+}
+
+std::string CompilationCache::source_key(const std::string &infile,
+    const std::string &preprocessed_src,
+    const CompilerOptions &compiler_options,
+    const std::string &pipeline_key)
+{
+    Hasher h;
+    h.update("lfortran-cache-1");
+    h.update(LFORTRAN_VERSION);
+    // The file name ends up in debug information and diagnostics
+    h.update(infile);
+    h.update(options_fingerprint(compiler_options));
+    h.update(pipeline_key);
+    h.update(preprocessed_src);
+    return h.hexdigest();
+}
+
+std::string CompilationCache::entry_key(const std::string &source_key,
+    const std::vector<std::string> &mod_files)
+{
+    Hasher h;
+    h.update(source_key);
+    for (auto &mod_file : mod_files) {
+        std::string modfile;
+        if (!read_file(mod_file, modfile)) return "";
+        h.update(mod_file);
+        h.update(modfile);
+    }
+    return h.hexdigest();
+}
+
+bool CompilationCache::fetch(const std::string &source_key,
+    const std::string &outfile, const std::filesystem::path &mod_files_dir,
+    std::string &diagnostics)
+{
+    std::string manifest;
+    if (!read_file((cache_dir / (source_key + ".manifest")).string(), manifest)) {
+        return false;
+    }
+    std::vector<std::string> mod_files;
+    std::istringstream in(manifest);
+    for (std::string line; std::getline(in, line);) {
+        if (!line.empty()) mod_files.push_back(line);
+    }
+    std::string key = entry_key(source_key, mod_files);
+    if (key.empty()) return false;
+
+    std::filesystem::path entry = cache_dir / key;
+    std::string saved_mods;
+    if (!read_file((entry / "mods").string(), saved_mods)
+            || !read_file((entry / "stderr").string(), diagnostics)) {
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::copy_file(entry / "object.o", outfile,
+        std::filesystem::copy_options::overwrite_existing, ec);
+    if (ec) return false;
+    std::istringstream mods(saved_mods);
+    for (std::string name; std::getline(mods, name);) {
+        if (name.empty()) continue;
+        std::filesystem::copy_file(entry / name, mod_files_dir / name,
+            std::filesystem::copy_options::overwrite_existing, ec);
+        if (ec) return false;
+    }
+    return true;
+}
+
+void CompilationCache::store(const std::string &source_key,
+    const std::vector<std::string> &loaded_mod_files,
+    const std::string &object_file,
+    const std::vector<std::filesystem::path> &saved_mod_files,
+    const std::string &diagnostics)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(cache_dir, ec);
+    if (ec) return;
+
+    std::vector<std::string> mod_files = loaded_mod_files;
+    std::sort(mod_files.begin(), mod_files.end());
+    mod_files.erase(std::unique(mod_files.begin(), mod_files.end()),
+        mod_files.end());
+    std::string key = entry_key(source_key, mod_files);
+    if (key.empty()) return;
+
+    std::string tmp_suffix = ".tmp." + get_unique_ID();
+    std::filesystem::path entry = cache_dir / key;
+    std::filesystem::path tmp_entry = cache_dir / (key + tmp_suffix);
+    std::filesystem::create_directory(tmp_entry, ec);
+    if (ec) return;
+    bool ok = true;
+    std::filesystem::copy_file(object_file, tmp_entry / "object.o", ec);
+    ok = ok && !ec;
+    std::string saved_mods;
+    for (auto &mod_file : saved_mod_files) {
+        std::filesystem::copy_file(mod_file, tmp_entry / mod_file.filename(), ec);
+        ok = ok && !ec;
+        saved_mods += mod_file.filename().string() + "\n";
+    }
+    ok = ok && write_file(tmp_entry / "mods", saved_mods);
+    ok = ok && write_file(tmp_entry / "stderr", diagnostics);
+    if (ok) {
+        // Fails if another compiler stored the same entry meanwhile
+        std::filesystem::rename(tmp_entry, entry, ec);
+    }
+    std::filesystem::remove_all(tmp_entry, ec);
+    if (!ok) return;
+
+    std::string manifest;
+    for (auto &mod_file : mod_files) manifest += mod_file + "\n";
+    std::filesystem::path manifest_path = cache_dir / (source_key + ".manifest");
+    std::filesystem::path tmp_manifest = cache_dir / (source_key + ".manifest" + tmp_suffix);
+    if (write_file(tmp_manifest, manifest)) {
+        std::filesystem::rename(tmp_manifest, manifest_path, ec);
+    }
+    std::filesystem::remove(tmp_manifest, ec);
+}
+
+} // namespace LCompilers::LFortran
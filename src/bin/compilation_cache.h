@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <libasr/utils.h>
+
+namespace LCompilers::LFortran {
+
+    /*
+        An on-disk, content addressed cache of compiled units (`--cache-dir`).
+
+        A unit is looked up in two steps, like ccache's "direct mode":
+
+        1. The source key hashes the preprocessed source, the options that
+           affect code generation, the pass pipeline and the LFortran
+           version. It names a manifest that lists the .mod files the unit
+           loaded when it was last compiled.
+        2. The entry key hashes the source key together with the current
+           contents of those .mod files. It names a directory with the
+           object file, the .mod files the unit wrote and its diagnostics.
+
+        Entries are written to a temporary directory and renamed into place,
+        so concurrent compilers sharing a cache never see partial entries.
+    */
+    class CompilationCache {
+    public:
+        CompilationCache(const std::filesystem::path &cache_dir);
+
+        static std::string source_key(const std::string &infile,
+            const std::string &preprocessed_src,
+            const CompilerOptions &compiler_options,
+            const std::string &pipeline_key);
+
+        /*
+            On a hit, copies the cached object file to `outfile` and the
+            cached .mod files to `mod_files_dir`, stores the diagnostics
+            that the original compilation printed in `diagnostics` and
+            returns true.
+        */
+        bool fetch(const std::string &source_key, const std::string &outfile,
+            const std::filesystem::path &mod_files_dir, std::string &diagnostics);
+
+        void store(const std::string &source_key,
+            const std::vector<std::string> &loaded_mod_files,
+            const std::string &object_file,
+            const std::vector<std::filesystem::path> &saved_mod_files,
+            const std::string &diagnostics);
+
+        // Process wide statistics, reported by `--time-report`
+        static std::atomic<int> hits;
+        static std::atomic<int> misses;
+
+    private:
+        std::filesystem::path cache_dir;
+
+        // Returns "" if one of the .mod files cannot be read
+        std::string entry_key(const std::string &source_key,
+            const std::vector<std::string> &mod_files);
+    };
+
+} // namespace LCompilers::LFortran
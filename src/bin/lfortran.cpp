@@ -1,9 +1,10 @@
 #include "libasr/utils.h"
 #include <chrono>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <stdlib.h>
 #include <filesystem>
-#include <random>
 #ifndef CLI11_HAS_FILESYSTEM
 #define CLI11_HAS_FILESYSTEM 0
 #endif // CLI11_HAS_FILESYSTEM
@@ -59,6 +60,8 @@
 #include <bin/lfortran_accessor.h>
 #include <bin/lfortran_command_line_parser.h>
 #include <bin/lsp_cli.h>
+#include <bin/compilation_cache.h>
+#include <bin/module_dependency_scheduler.h>
 
 
 #ifdef WITH_LSP
@@ -79,7 +82,7 @@
 #define MAGENTA "\033[35m"   // Magenta for 'File reading' and 'Src -> ASR'
 #define RED        "\033[31m"   // Red for 'Time taken by pass' and 'ASR -> ASR passes'
 
-extern std::string lcompilers_unique_ID;
+extern thread_local std::string lcompilers_unique_ID;
 extern std::string lcompilers_commandline_options;
 
 namespace {
@@ -114,19 +117,6 @@ std::string get_system_temp_dir()
 std::string LFORTRAN_TEMP_DIR = get_system_temp_dir();
 
 
-std::string get_unique_ID() {
-    static std::random_device dev;
-    static std::mt19937 rng(dev());
-    std::uniform_int_distribution<int> dist(0, 61);
-    const std::string v =
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
-    std::string res;
-    for (int i = 0; i < 22; i++) {
-        res += v[dist(rng)];
-    }
-    return res;
-}
-
 void print_one_component(std::string component) {
     std::istringstream ss(component);
     std::string component_name;
@@ -435,6 +425,10 @@ int prompt(bool verbose, CompilerOptions &cu)
             std::cout << r.asr << std::endl;
             section("LLVM IR:");
             std::cout << r.llvm_ir << std::endl;
+            section("JIT:");
+            std::cout << "Compile time: " << r.compile_time / 1000.0 << " ms" << std::endl;
+            std::cout << "Run time: " << r.run_time / 1000.0 << " ms" << std::endl;
+            std::cout << "JIT memory: " << r.jit_memory << " bytes" << std::endl;
         }
 
         switch (r.type) {
@@ -935,7 +929,8 @@ int dump_all_passes(const std::string &infile, CompilerOptions &compiler_options
 
 int save_mod_files(const LCompilers::ASR::TranslationUnit_t &u,
     const LCompilers::CompilerOptions &compiler_options,
-    LCompilers::LocationManager lm)
+    LCompilers::LocationManager lm,
+    std::vector<std::filesystem::path> *saved_mod_files = nullptr)
 {
     for (auto &item : u.m_symtab->get_scope()) {
         if (LCompilers::ASR::is_a<LCompilers::ASR::Module_t>(*item.second)) {
@@ -973,6 +968,7 @@ int save_mod_files(const LCompilers::ASR::TranslationUnit_t &u,
 		out.open(fullpath, std::ofstream::out | std::ofstream::binary);
                 out << modfile_binary;
             }
+            if (saved_mod_files) saved_mod_files->push_back(fullpath);
         }
     }
     return 0;
@@ -1008,7 +1004,7 @@ int handle_mlir(const std::string &infile,
     }
 
     // ASR -> MLIR -> LLVM
-    LCompilers::LLVMEvaluator e(compiler_options.target);
+    LCompilers::LLVMEvaluator e(compiler_options);
     std::unique_ptr<LCompilers::MLIRModule> m;
     diagnostics.diagnostics.clear();
     LCompilers::Result<std::unique_ptr<LCompilers::MLIRModule>>
@@ -1092,7 +1088,9 @@ int compile_src_to_object_file(const std::string &infile,
         bool assembly,
         CompilerOptions &compiler_options,
         LCompilers::PassManager& lpm,
-        bool arg_c = false)
+        bool arg_c = false,
+        const std::function<void()> &mod_files_saved = nullptr,
+        std::ostream &diagnostics_out = std::cerr)
 {
     int time_file_read=0;
     int time_src_to_asr=0;
@@ -1105,6 +1103,9 @@ int compile_src_to_object_file(const std::string &infile,
     auto t2 = std::chrono::high_resolution_clock::now();
     time_file_read = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
 
+    // The names of this compilation are freed with its ASR
+    LCompilers::InternPool names;
+    LCompilers::InternScope names_scope(names);
     LCompilers::FortranEvaluator fe(compiler_options);
     LCompilers::ASR::TranslationUnit_t* asr;
 
@@ -1123,14 +1124,46 @@ int compile_src_to_object_file(const std::string &infile,
         compiler_options.po.intrinsic_module_name_mangling = true;
     }
     LCompilers::diag::Diagnostics diagnostics;
+
+    // Look the unit up in the compilation cache. The key needs the
+    // preprocessed source, which is computed separately (with its own
+    // LocationManager) so that a miss compiles exactly as without a cache.
+    bool use_cache = !compiler_options.cache_dir.empty() && !assembly
+        && !compiler_options.po.enable_gpu_offloading;
+    std::string cache_key;
+    std::string rendered_diagnostics;
+    std::vector<std::filesystem::path> saved_mod_files;
+    if (use_cache) {
+        LCompilers::LocationManager cache_lm = lm;
+        LCompilers::diag::Diagnostics cache_diagnostics;
+        LCompilers::Result<std::string> preprocessed = fe.get_preprocessed(
+            input, cache_lm, cache_diagnostics);
+        if (preprocessed.ok) {
+            cache_key = LCompilers::LFortran::CompilationCache::source_key(
+                infile, preprocessed.result, compiler_options,
+                lpm.get_pipeline_key() + (arg_c ? ",arg_c" : ""));
+            LCompilers::LFortran::CompilationCache cache(compiler_options.cache_dir);
+            if (cache.fetch(cache_key, outfile, compiler_options.po.mod_files_dir,
+                    rendered_diagnostics)) {
+                LCompilers::LFortran::CompilationCache::hits++;
+                diagnostics_out << rendered_diagnostics;
+                if (mod_files_saved) mod_files_saved();
+                return 0;
+            }
+            LCompilers::LFortran::CompilationCache::misses++;
+        }
+        compiler_options.po.loaded_mod_files.clear();
+    }
+
     t1 = std::chrono::high_resolution_clock::now();
     LCompilers::Result<LCompilers::ASR::TranslationUnit_t*>
         result = fe.get_asr2(input, lm, diagnostics);
-    lcompilers_unique_ID = compiler_options.generate_object_code ? get_unique_ID() : "";
+    lcompilers_unique_ID = compiler_options.generate_object_code ? LCompilers::get_unique_ID() : "";
 
     time_src_to_asr = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
     bool has_error_w_cc = compiler_options.continue_compilation && diagnostics.has_error();
-    std::cerr << diagnostics.render(lm, compiler_options);
+    rendered_diagnostics = diagnostics.render(lm, compiler_options);
+    diagnostics_out << rendered_diagnostics;
     if (result.ok) {
         asr = result.result;
     } else {
@@ -1141,14 +1174,16 @@ int compile_src_to_object_file(const std::string &infile,
     // Save .mod files
     {
         t1 = std::chrono::high_resolution_clock::now();
-        int err = save_mod_files(*asr, compiler_options, lm);
+        int err = save_mod_files(*asr, compiler_options, lm, &saved_mod_files);
         t2 = std::chrono::high_resolution_clock::now();
         time_save_mod = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
         if (err) return err;
+        // Let units waiting on these modules start before our backend runs
+        if (mod_files_saved) mod_files_saved();
     }
 
     // ASR -> LLVM
-    LCompilers::LLVMEvaluator e(compiler_options.target);
+    LCompilers::LLVMEvaluator e(compiler_options);
 
     if (!(compiler_options.generate_object_code || compiler_options.separate_compilation)
         && !LCompilers::ASRUtils::main_program_present(*asr)
@@ -1156,6 +1191,11 @@ int compile_src_to_object_file(const std::string &infile,
         // Create an empty object file (things will be actually
         // compiled and linked when the main program is present):
         e.create_empty_object_file(outfile);
+        if (!cache_key.empty() && !has_error_w_cc) {
+            LCompilers::LFortran::CompilationCache(compiler_options.cache_dir).store(
+                cache_key, compiler_options.po.loaded_mod_files, outfile,
+                saved_mod_files, rendered_diagnostics);
+        }
         return 0;
     }
 
@@ -1176,13 +1216,15 @@ int compile_src_to_object_file(const std::string &infile,
             LCompilers::diag::Level::Error,
             LCompilers::diag::Stage::Semantic, {})
         );
-        std::cerr << diagnostics.render(lm, compiler_options);
+        diagnostics_out << diagnostics.render(lm, compiler_options);
         return 1;
 #endif
     }
     LCompilers::Result<std::unique_ptr<LCompilers::LLVMModule>>
         res = fe.get_llvm3(*asr, lpm, diagnostics, infile, &time_opt);
-    std::cerr << diagnostics.render(lm, compiler_options);
+    std::string llvm_diagnostics = diagnostics.render(lm, compiler_options);
+    rendered_diagnostics += llvm_diagnostics;
+    diagnostics_out << llvm_diagnostics;
     if (res.ok) {
         m = std::move(res.result);
     } else {
@@ -1193,6 +1235,12 @@ int compile_src_to_object_file(const std::string &infile,
     // LLVM -> Machine code (saves to an object file)
     if (assembly) {
         e.save_asm_file(*(m->m_m), outfile);
+    } else if (compiler_options.thin_lto) {
+        // Compiled to machine code with the other files when linking
+        t1 = std::chrono::high_resolution_clock::now();
+        e.save_bitcode_file(*(m->m_m), outfile);
+        t2 = std::chrono::high_resolution_clock::now();
+        time_llvm_to_bin = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
     } else {
         t1 = std::chrono::high_resolution_clock::now();
         e.save_object_file(*(m->m_m), outfile);
@@ -1211,7 +1259,7 @@ int compile_src_to_object_file(const std::string &infile,
                 LCompilers::Result<std::unique_ptr<LCompilers::MLIRModule>>
                     mlir_res = fe.get_mlir((LCompilers::ASR::asr_t &)mod, diagnostics);
 
-                std::cerr << diagnostics.render(lm, compiler_options);
+                diagnostics_out << diagnostics.render(lm, compiler_options);
                 if (mlir_res.ok) {
                     mlir_res.result->mlir_to_llvm(*mlir_res.result->llvm_ctx);
                     std::string mlir_tmp_o = (std::filesystem::path(LFORTRAN_TEMP_DIR) / std::filesystem::path(infile)
@@ -1246,19 +1294,113 @@ int compile_src_to_object_file(const std::string &infile,
         compiler_options.po.vector_of_time_report.push_back(message);
         message = "LLVM opt:    " + std::to_string(time_opt / 1000) + "." + std::to_string(time_opt % 1000) + " ms";
         compiler_options.po.vector_of_time_report.push_back(message);
+        // The functions that took longest, and the rest together
+        const size_t max_functions = 20;
+        std::vector<std::pair<std::string, int64_t>> opt_times
+            = fe.get_function_opt_times();
+        int64_t time_other_functions = 0;
+        for (size_t i = 0; i < opt_times.size(); i++) {
+            if (i >= max_functions) {
+                time_other_functions += opt_times[i].second;
+                continue;
+            }
+            std::string name = opt_times[i].first.empty()
+                ? "(whole module)" : opt_times[i].first;
+            message = "[PASS]" + name + ": " + std::to_string(opt_times[i].second / 1000.0) + " ms";
+            compiler_options.po.vector_of_time_report.push_back(message);
+        }
+        if (opt_times.size() > max_functions) {
+            message = "[PASS](" + std::to_string(opt_times.size() - max_functions)
+                + " other functions): " + std::to_string(time_other_functions / 1000.0) + " ms";
+            compiler_options.po.vector_of_time_report.push_back(message);
+        }
         message = "LLVM -> BIN: " + std::to_string(time_llvm_to_bin / 1000) + "." + std::to_string(time_llvm_to_bin % 1000) + " ms";
         compiler_options.po.vector_of_time_report.push_back(message);
     }
 
+    if (!cache_key.empty() && !has_error_w_cc) {
+        LCompilers::LFortran::CompilationCache(compiler_options.cache_dir).store(
+            cache_key, compiler_options.po.loaded_mod_files, outfile,
+            saved_mod_files, rendered_diagnostics);
+    }
+
     return has_error_w_cc;
 }
 
+/*
+    Compiles `infiles` to `outfiles` on `n_jobs` threads (0: one per core).
+    Files are ordered by the `use` graph between them and independent files
+    are compiled concurrently, each with its own copy of `compiler_options`
+    and `lpm` (and hence its own FortranEvaluator and Allocator). The
+    diagnostics of each file are buffered and printed in command line order
+    once all files are done. Returns the exit code of every file, -1 for
+    files skipped because a module they depend on failed to compile.
+*/
+std::vector<int> compile_src_to_object_files_parallel(
+        const std::vector<std::string> &infiles,
+        const std::vector<std::string> &outfiles,
+        size_t n_jobs,
+        CompilerOptions &compiler_options,
+        LCompilers::PassManager& lpm)
+{
+    std::vector<LCompilers::LFortran::CompilationUnit> units;
+    for (auto &infile : infiles) {
+        units.push_back(LCompilers::LFortran::scan_module_dependencies(
+            infile, read_file_ok(infile), compiler_options.fixed_form));
+    }
+    LCompilers::LFortran::ModuleDependencyScheduler scheduler(units);
+    std::string error;
+    if (!scheduler.build_graph(error)) {
+        std::cerr << "error: " << error << std::endl;
+        return std::vector<int>(infiles.size(), 1);
+    }
+
+    // Register the LLVM targets once, before any worker creates its own
+    // LLVMEvaluator (the target registry is not thread safe)
+    { LCompilers::LLVMEvaluator e(compiler_options); }
+
+    std::string unique_ID = lcompilers_unique_ID;
+    std::vector<std::vector<std::string>> time_reports(infiles.size());
+    std::vector<std::string> diagnostics(infiles.size());
+    std::vector<int> status = scheduler.run(n_jobs,
+        [&](size_t i, const std::function<void()> &release) -> int {
+            CompilerOptions worker_options = compiler_options;
+            worker_options.po.vector_of_time_report.clear();
+            LCompilers::PassManager worker_lpm = lpm;
+            lcompilers_unique_ID = unique_ID;
+            std::ostringstream diagnostics_out;
+            int err = compile_src_to_object_file(infiles[i], outfiles[i],
+                worker_options.time_report, false, worker_options,
+                worker_lpm, false, release, diagnostics_out);
+            time_reports[i] = std::move(worker_options.po.vector_of_time_report);
+            diagnostics[i] = diagnostics_out.str();
+            return err;
+        }, compiler_options.continue_compilation);
+
+    // Report in command line order, independent of the thread schedule
+    for (size_t i = 0; i < infiles.size(); i++) {
+        std::cerr << diagnostics[i];
+        if (compiler_options.time_report) {
+            compiler_options.po.vector_of_time_report.push_back(
+                "File: " + infiles[i]);
+            for (auto &entry : time_reports[i]) {
+                compiler_options.po.vector_of_time_report.push_back(entry);
+            }
+        }
+        if (status[i] == -1) {
+            std::cerr << "error: '" << infiles[i] << "' was not compiled "
+                "because a module it uses failed to compile" << std::endl;
+        }
+    }
+    return status;
+}
+
 int compile_llvm_to_object_file(const std::string& infile,
                                 const std::string& outfile,
                                 CompilerOptions& compiler_options)
 {
     std::string input = read_file_ok(infile);
-    LCompilers::LLVMEvaluator e(compiler_options.target);
+    LCompilers::LLVMEvaluator e(compiler_options);
 
     std::unique_ptr<LCompilers::LLVMModule> m = e.parse_module2(input, infile);
     e.save_object_file(*(m->m_m), outfile);
@@ -1754,6 +1896,54 @@ int compile_to_binary_fortran(const std::string &infile,
     return 0;
 }
 
+#ifdef HAVE_LFORTRAN_LLVM
+/*
+    Replaces the LLVM bitcode among `object_files` (written with `-flto=thin`)
+    by the object files that the ThinLTO backend compiles from all of it
+    together. These are temporary and also added to `temp_object_files`.
+*/
+int thin_lto_backend(std::vector<std::string> &object_files,
+        std::vector<std::string> &temp_object_files,
+        const std::string &outfile, bool shared_executable,
+        CompilerOptions &compiler_options)
+{
+    std::vector<std::string> bitcode_files, native_files;
+    for (auto &s : object_files) {
+        if (LCompilers::LLVMEvaluator::is_bitcode_file(s)) {
+            bitcode_files.push_back(s);
+        } else {
+            native_files.push_back(s);
+        }
+    }
+    if (bitcode_files.empty()) return 0;
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    std::string prefix = (std::filesystem::path(LFORTRAN_TEMP_DIR)
+        / std::filesystem::path(outfile).filename()).string() + ".lto";
+    std::vector<std::string> lto_object_files;
+    try {
+        LCompilers::LLVMEvaluator e(compiler_options);
+        lto_object_files = e.thin_lto_link(bitcode_files, native_files,
+            shared_executable, prefix);
+    } catch (const LCompilers::LCompilersException &e) {
+        std::cerr << "ThinLTO: " << e.msg() << std::endl;
+        return 10;
+    }
+    object_files = native_files;
+    for (auto &s : lto_object_files) {
+        object_files.push_back(s);
+        temp_object_files.push_back(s);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    if (compiler_options.time_report) {
+        int time_lto = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        compiler_options.po.vector_of_time_report.push_back("ThinLTO backend: "
+            + std::to_string(time_lto / 1000) + "." + std::to_string(time_lto % 1000) + " ms");
+    }
+    return 0;
+}
+#endif
+
 // infile is an object file
 // outfile will become the executable
 int link_executable(const std::vector<std::string> &infiles,
@@ -1961,12 +2151,26 @@ int link_executable(const std::vector<std::string> &infiles,
                 compile_cmd += extra_linker_flags;
             }
             compile_cmd += " -l" + runtime_lib + " -lm";
+            if (static_executable) {
+                // The runtime starts a thread for asynchronous I/O
+                compile_cmd += " -lpthread";
+            }
             if (compiler_options.openmp) {
                 std::string openmp_shared_library = compiler_options.openmp_lib_dir;
                 std::string omp_cmd =  " -L" + openmp_shared_library + " -Wl,-rpath," + openmp_shared_library + " -lomp";
                 if (!openmp_shared_library.empty()) {
                     compile_cmd += omp_cmd;
                 }
+            } else if (compiler_options.po.do_concurrent_parallel &&
+                    !compiler_options.po.do_concurrent_lfortran_runtime) {
+                // `do concurrent` calls GOMP, which libgomp and libomp provide
+                std::string openmp_shared_library = compiler_options.openmp_lib_dir;
+                if (!openmp_shared_library.empty()) {
+                    compile_cmd += " -L" + openmp_shared_library + " -Wl,-rpath,"
+                        + openmp_shared_library + " -lomp";
+                } else {
+                    compile_cmd += " -lgomp";
+                }
             }
             run_cmd = "./" + outfile;
         }
@@ -2340,7 +2544,7 @@ int main_app(int argc, char *argv[]) {
         }
     }
 
-    lcompilers_unique_ID = ( parser.opts.compiler_options.generate_object_code || compiler_options.separate_compilation ) ? get_unique_ID() : "";
+    lcompilers_unique_ID = ( parser.opts.compiler_options.generate_object_code || compiler_options.separate_compilation ) ? LCompilers::get_unique_ID() : "";
     if (parser.opts.compiler_options.generate_object_code) {
         compiler_options.po.intrinsic_symbols_mangling = true;
         compiler_options.po.intrinsic_module_name_mangling = true;
@@ -2637,6 +2841,27 @@ int main_app(int argc, char *argv[]) {
     // we need this separate vector to store temporary object files as some object files passed as arguments
     // are considered as it is and we do not want to delete them
     std::vector<std::string> temp_object_files;
+    // exit codes of the Fortran files already compiled by `-j`
+    std::map<std::string, int> parallel_status;
+#ifdef HAVE_LFORTRAN_LLVM
+    if (opts.arg_j != 1 && backend == Backend::llvm) {
+        std::vector<std::string> infiles, outfiles;
+        for (const auto &arg_file : opts.arg_files) {
+            if (endswith(arg_file, ".f90") || endswith(arg_file, ".f") ||
+                endswith(arg_file, ".F90") || endswith(arg_file, ".F")) {
+                infiles.push_back(arg_file);
+                outfiles.push_back((std::filesystem::path(LFORTRAN_TEMP_DIR) / std::filesystem::path(arg_file)
+                                .filename().replace_extension(".tmp.o")).string());
+            }
+        }
+        std::vector<int> status = compile_src_to_object_files_parallel(
+            infiles, outfiles, std::max(opts.arg_j, 0), compiler_options,
+            lfortran_pass_manager);
+        for (size_t i = 0; i < infiles.size(); i++) {
+            parallel_status[infiles[i]] = status[i] == -1 ? 1 : status[i];
+        }
+    }
+#endif
     for (const auto &arg_file : opts.arg_files) {
         int err = 0;
         std::string tmp_o = (std::filesystem::path(LFORTRAN_TEMP_DIR) / std::filesystem::path(arg_file)
@@ -2650,8 +2875,12 @@ int main_app(int argc, char *argv[]) {
             }
             if (backend == Backend::llvm) {
 #ifdef HAVE_LFORTRAN_LLVM
-                err = compile_src_to_object_file(arg_file, tmp_o, compiler_options.time_report, false,
-                    compiler_options, lfortran_pass_manager);
+                if (parallel_status.find(arg_file) != parallel_status.end()) {
+                    err = parallel_status[arg_file];
+                } else {
+                    err = compile_src_to_object_file(arg_file, tmp_o, compiler_options.time_report, false,
+                        compiler_options, lfortran_pass_manager);
+                }
 #else
                 std::cerr << "Compiling Fortran files to object files requires the LLVM backend to be enabled. Recompile with `WITH_LLVM=yes`." << std::endl;
                 return 1;
@@ -2699,6 +2928,13 @@ int main_app(int argc, char *argv[]) {
     if (object_files.size() == 0) {
         return err_;
     } else {
+#ifdef HAVE_LFORTRAN_LLVM
+        if (backend == Backend::llvm) {
+            int err = thin_lto_backend(object_files, temp_object_files,
+                outfile, opts.shared_link, compiler_options);
+            if (err) return err;
+        }
+#endif
         int status_code = err_ + link_executable(object_files, outfile, compiler_options.time_report, runtime_library_dir,
                 backend, opts.static_link, opts.shared_link, opts.linker, opts.linker_path, true,
                 opts.arg_v, opts.arg_L, opts.arg_l, opts.linker_flags, compiler_options);
@@ -2708,6 +2944,14 @@ int main_app(int argc, char *argv[]) {
             std::remove(filename.c_str());
         }
         if (compiler_options.time_report) {
+            if (!compiler_options.cache_dir.empty()) {
+                compiler_options.po.vector_of_time_report.push_back(
+                    "Compilation cache: "
+                    + std::to_string(LCompilers::LFortran::CompilationCache::hits)
+                    + " hits, "
+                    + std::to_string(LCompilers::LFortran::CompilationCache::misses)
+                    + " misses");
+            }
             int total_time = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
             std::string message = "Total time: " + std::to_string(total_time / 1000) + "." + std::to_string(total_time % 1000) + " ms";
             compiler_options.po.vector_of_time_report.push_back(message);
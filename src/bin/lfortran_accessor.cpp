@@ -14,27 +14,64 @@
 
 namespace LCompilers::LLanguageServer {
 
-    auto LFortranAccessor::showErrors(
+    DocumentAnalysis::~DocumentAnalysis() = default;
+
+    auto LFortranAccessor::analyze(
         const std::string &filename,
         const std::string &text,
-        CompilerOptions &compiler_options
-    ) -> std::vector<LCompilers::error_highlight> {
-        std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        const CompilerOptions &compiler_options
+    ) -> std::shared_ptr<DocumentAnalysis> {
+        auto iter = analysesByFilename.find(filename);
+        if (iter != analysesByFilename.end() && iter->second->text == text) {
+            return iter->second;
+        }
+        // Release the previous version before analysing the new one
+        if (iter != analysesByFilename.end()) {
+            analysesByFilename.erase(iter);
+        }
 
-        LCompilers::LocationManager lm;
+        std::shared_ptr<DocumentAnalysis> analysis =
+            std::make_shared<DocumentAnalysis>();
+        analysis->text = text;
+        analysis->compiler_options = compiler_options;
+        LCompilers::InternScope names_scope(analysis->names);
+        analysis->fe = std::make_unique<LCompilers::FortranEvaluator>(
+            analysis->compiler_options);
         {
-                LCompilers::LocationManager::FileLocations fl;
-                fl.in_filename = filename;
-                lm.files.push_back(fl);
-                lm.file_ends.push_back(text.size());
+            LCompilers::LocationManager::FileLocations fl;
+            fl.in_filename = filename;
+            analysis->lm.files.push_back(fl);
+            analysis->lm.file_ends.push_back(text.size());
         }
+        LCompilers::Result<LCompilers::ASR::TranslationUnit_t*> result =
+            analysis->fe->get_asr2(analysis->text, analysis->lm,
+                analysis->diagnostics);
+        if (result.ok) {
+            analysis->asr = result.result;
+        }
+        analysesByFilename[filename] = analysis;
+        return analysis;
+    }
 
-        LCompilers::diag::Diagnostics diagnostics;
-        {
-                LCompilers::Result<LCompilers::ASR::TranslationUnit_t*> result =
-                    fe.get_asr2(text, lm, diagnostics);
+    auto LFortranAccessor::invalidate(const std::string &filename) -> void {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (filename.empty()) {
+            analysesByFilename.clear();
+        } else {
+            analysesByFilename.erase(filename);
         }
+    }
+
+    auto LFortranAccessor::showErrors(
+        const std::string &filename,
+        const std::string &text,
+        CompilerOptions &compiler_options
+    ) -> std::vector<LCompilers::error_highlight> {
+        std::unique_lock<std::mutex> lock(mutex);
+        std::shared_ptr<DocumentAnalysis> analysis =
+            analyze(filename, text, compiler_options);
+        LCompilers::LocationManager &lm = analysis->lm;
+        LCompilers::diag::Diagnostics &diagnostics = analysis->diagnostics;
 
         std::vector<LCompilers::error_highlight> diag_lists;
         diag_lists.reserve(diagnostics.diagnostics.size());
@@ -75,21 +112,13 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<LCompilers::document_symbols> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        std::shared_ptr<DocumentAnalysis> analysis =
+            analyze(filename, text, compiler_options);
         std::vector<LCompilers::document_symbols> symbol_lists;
 
-        LCompilers::LocationManager lm;
-        {
-            LCompilers::LocationManager::FileLocations fl;
-            fl.in_filename = filename;
-            lm.files.push_back(fl);
-            lm.file_ends.push_back(text.size());
-        }
+        LCompilers::LocationManager &lm = analysis->lm;
         {
-            LCompilers::diag::Diagnostics diagnostics;
-            LCompilers::Result<LCompilers::ASR::TranslationUnit_t*>
-                x = fe.get_asr2(text, lm, diagnostics);
-            if (x.ok) {
+            if (analysis->asr) {
                 // populate_symbol_lists(x.result, lm, symbol_lists);
                 uint16_t l = std::stoi(compiler_options.line);
                 uint16_t c = std::stoi(compiler_options.column);
@@ -101,7 +130,7 @@ namespace LCompilers::LLanguageServer {
                 }
                 uint64_t output_pos = lm.input_to_output_pos(input_pos, false);
                 LCompilers::ASR::asr_t* asr =
-                    fe.handle_lookup_name(x.result, output_pos);
+                    analysis->fe->handle_lookup_name(analysis->asr, output_pos);
                 if (ASR::is_a<ASR::symbol_t>(*asr)) {
                     ASR::symbol_t* s = ASR::down_cast<ASR::symbol_t>(asr);
                     std::string symbol_name = ASRUtils::symbol_name( s );
@@ -133,21 +162,13 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<std::pair<LCompilers::document_symbols, std::string>> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        std::shared_ptr<DocumentAnalysis> analysis =
+            analyze(filename, text, compiler_options);
         std::vector<std::pair<LCompilers::document_symbols, std::string>> symbol_lists;
 
-        LCompilers::LocationManager lm;
-        {
-            LCompilers::LocationManager::FileLocations fl;
-            fl.in_filename = filename;
-            lm.files.push_back(fl);
-            lm.file_ends.push_back(text.size());
-        }
+        LCompilers::LocationManager &lm = analysis->lm;
         {
-            LCompilers::diag::Diagnostics diagnostics;
-            LCompilers::Result<LCompilers::ASR::TranslationUnit_t*>
-                x = fe.get_asr2(text, lm, diagnostics);
-            if (x.ok) {
+            if (analysis->asr) {
                 // populate_symbol_lists(x.result, lm, symbol_lists);
                 uint16_t l = std::stoi(compiler_options.line);
                 uint16_t c = std::stoi(compiler_options.column);
@@ -159,7 +180,7 @@ namespace LCompilers::LLanguageServer {
                 }
                 uint64_t output_pos = lm.input_to_output_pos(input_pos, false);
                 LCompilers::ASR::asr_t* asr =
-                    fe.handle_lookup_name(x.result, output_pos);
+                    analysis->fe->handle_lookup_name(analysis->asr, output_pos);
                 if (ASR::is_a<ASR::symbol_t>(*asr)) {
                     std::pair<LCompilers::document_symbols, std::string> &pair =
                         symbol_lists.emplace_back();
@@ -196,33 +217,25 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<LCompilers::document_symbols> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        std::shared_ptr<DocumentAnalysis> analysis =
+            analyze(filename, text, compiler_options);
         std::vector<LCompilers::document_symbols> symbol_lists;
 
-        LCompilers::LocationManager lm;
+        LCompilers::LocationManager &lm = analysis->lm;
         {
-            LCompilers::LocationManager::FileLocations fl;
-            fl.in_filename = filename;
-            lm.files.push_back(fl);
-            lm.file_ends.push_back(text.size());
-        }
-        {
-            LCompilers::diag::Diagnostics diagnostics;
-            LCompilers::Result<LCompilers::ASR::TranslationUnit_t*>
-                x = fe.get_asr2(text, lm, diagnostics);
-            if (x.ok) {
+            if (analysis->asr) {
                 // populate_symbol_lists(x.result, lm, symbol_lists);
                 uint16_t l = std::stoi(compiler_options.line);
                 uint16_t c = std::stoi(compiler_options.column);
                 uint64_t input_pos = lm.linecol_to_pos(l, c);
                 uint64_t output_pos = lm.input_to_output_pos(input_pos, false);
-                LCompilers::ASR::asr_t* asr = fe.handle_lookup_name(x.result, output_pos);
+                LCompilers::ASR::asr_t* asr = analysis->fe->handle_lookup_name(analysis->asr, output_pos);
                 LCompilers::document_symbols loc;
                 if (ASR::is_a<ASR::symbol_t>(*asr)) {
                     ASR::symbol_t* s = ASR::down_cast<ASR::symbol_t>(asr);
                     std::string symbol_name = ASRUtils::symbol_name( s );
                     LCompilers::LFortran::OccurenceCollector occ(symbol_name, symbol_lists, lm);
-                    occ.visit_TranslationUnit(*x.result);
+                    occ.visit_TranslationUnit(*analysis->asr);
                 }
             }
         }
@@ -270,22 +283,14 @@ namespace LCompilers::LLanguageServer {
         CompilerOptions &compiler_options
     ) -> std::vector<LCompilers::document_symbols> {
         std::unique_lock<std::mutex> lock(mutex);
-        LCompilers::FortranEvaluator fe(compiler_options);
+        std::shared_ptr<DocumentAnalysis> analysis =
+            analyze(filename, text, compiler_options);
         std::vector<LCompilers::document_symbols> symbol_lists;
 
-        LCompilers::LocationManager lm;
-        {
-            LCompilers::LocationManager::FileLocations fl;
-            fl.in_filename = filename;
-            lm.files.push_back(fl);
-            lm.file_ends.push_back(text.size());
-        }
+        LCompilers::LocationManager &lm = analysis->lm;
         {
-            LCompilers::diag::Diagnostics diagnostics;
-            LCompilers::Result<LCompilers::ASR::TranslationUnit_t*>
-                x = fe.get_asr2(text, lm, diagnostics);
-            if (x.ok) {
-              populateSymbolLists(x.result, lm, symbol_lists, -1);
+            if (analysis->asr) {
+              populateSymbolLists(analysis->asr, lm, symbol_lists, -1);
             }
         }
 
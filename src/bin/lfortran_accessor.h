@@ -1,20 +1,51 @@
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <libasr/asr.h>
+#include <libasr/diagnostics.h>
 #include <libasr/exception.h>
+#include <libasr/location.h>
 #include <libasr/lsp_interface.h>
 #include <libasr/utils.h>
 
+namespace LCompilers {
+    class FortranEvaluator;
+}
+
 namespace LCompilers::LLanguageServer {
 
     inline bool is_id_chr(unsigned char c) {
         return std::isalnum(c) || (c == '_');
     }
 
+    /*
+        One version of a document after prescanning, parsing and semantic
+        analysis. The diagnostics, lookups and symbols requested for the same
+        version all share it, instead of compiling the document per request.
+        Any edit analyses the whole document again: program units are not
+        re-analysed on their own.
+    */
+    struct DocumentAnalysis {
+        std::string text;
+        // `fe` refers to these options
+        CompilerOptions compiler_options;
+        // The names of the symbol tables of `asr`, freed together with it
+        LCompilers::InternPool names;
+        std::unique_ptr<LCompilers::FortranEvaluator> fe;
+        LCompilers::LocationManager lm;
+        LCompilers::diag::Diagnostics diagnostics;
+        // nullptr if the semantic analysis failed
+        LCompilers::ASR::TranslationUnit_t *asr = nullptr;
+
+        ~DocumentAnalysis();
+    };
+
     class LFortranAccessor {
     public:
         auto showErrors(
@@ -93,8 +124,25 @@ namespace LCompilers::LLanguageServer {
             int indent,
             bool indent_unit
         ) -> LCompilers::Result<std::string>;
+
+        // Drops the cached analysis of `filename` (of all documents if
+        // empty), e.g. after the compiler options or .mod files changed
+        auto invalidate(const std::string &filename = "") -> void;
     private:
         std::mutex mutex;
+        // The latest analysed version of each document
+        std::unordered_map<
+            std::string,
+            std::shared_ptr<DocumentAnalysis>
+        > analysesByFilename;
+
+        // Returns the cached analysis if `text` did not change since the last
+        // request for `filename`. Must be called with `mutex` locked.
+        auto analyze(
+            const std::string &filename,
+            const std::string &text,
+            const CompilerOptions &compiler_options
+        ) -> std::shared_ptr<DocumentAnalysis>;
     };
 
 } // namespace LCompilers::LLanguageServer
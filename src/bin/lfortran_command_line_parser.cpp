@@ -38,6 +38,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_option("-o", compiler_options.arg_o, "Specify the file to place the compiler's output into");
         app.add_flag("-v", opts.arg_v, "Be more verbose");
         app.add_flag("-E", opts.arg_E, "Preprocess only; do not compile, assemble or link");
+        app.add_option("-j", opts.arg_j, "Compile independent source files in parallel using <n> jobs (0: one per core)")->capture_default_str();
         app.add_option("-l", opts.arg_l, "Link library option")->allow_extra_args(false);
         app.add_option("-L", opts.arg_L, "Library path option")->allow_extra_args(false);
         app.add_option("-I", compiler_options.po.include_dirs, "Include path")->allow_extra_args(false);
@@ -48,8 +49,9 @@ namespace LCompilers::CommandLineInterface {
         app.add_option("-D", compiler_options.c_preprocessor_defines, "Define <macro>=<value> (or 1 if <value> omitted)")->allow_extra_args(false);
         app.add_flag("--version", opts.arg_version, "Display compiler version information");
         app.add_option("-W", opts.linker_flags, "Linker flags")->allow_extra_args(false);
-        app.add_option("-f", opts.f_flags, "All `-f*` flags (only -fPIC & -fdefault-integer-8 supported for now)")->allow_extra_args(false);
-        app.add_option("-O", opts.O_flags, "Optimization level (ignored for now)")->allow_extra_args(false);
+        app.add_option("-f", opts.f_flags, "All `-f*` flags (only -fPIC, -fdefault-integer-8 & -flto=thin supported for now)")->allow_extra_args(false);
+        app.add_option("-O", opts.O_flags, "Optimization level of the LLVM pipeline (0, 1, 2, 3, s, z, fast or g)")->allow_extra_args(false);
+        app.add_option("-m", opts.m_flags, "Target CPU flags (only -march=<cpu> & -mtune=<cpu> supported for now)")->allow_extra_args(false);
 
         // LFortran specific options
         app.add_flag("--cpp", opts.cpp, "Enable C preprocessing");
@@ -73,6 +75,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--visualize", compiler_options.po.visualize, "Print ASR/AST Visualization");
         app.add_option("--pass", opts.arg_pass, "Apply the ASR pass and show ASR (implies --show-asr)");
         app.add_option("--skip-pass", opts.skip_pass, "Skip an ASR pass in default pipeline");
+        app.add_option("--pass-jobs", compiler_options.po.pass_jobs, "Apply function-local ASR passes on <n> threads (0: one per core)")->capture_default_str();
         app.add_flag("--show-llvm", opts.show_llvm, "Show LLVM IR for the given file and exit");
         app.add_flag("--show-mlir", opts.show_mlir, "Show MLIR for the given file and exit");
         app.add_flag("--show-llvm-from-mlir", opts.show_llvm_from_mlir, "Show LLVM IR translated from MLIR for the given file and exit");
@@ -85,6 +88,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--show-stacktrace", compiler_options.show_stacktrace, "Show internal stacktrace on compiler errors");
         app.add_flag("--symtab-only", compiler_options.symtab_only, "Only create symbol tables in ASR (skip executable stmt)");
         app.add_flag("--time-report", compiler_options.time_report, "Show compilation time report");
+        app.add_option("--cache-dir", compiler_options.cache_dir, "Reuse object and .mod files cached in this directory when the source, options and used modules did not change");
         app.add_flag("--static", opts.static_link, "Create a static executable");
         app.add_flag("--shared", opts.shared_link, "Create a shared executable");
         app.add_flag("--logical-casting", compiler_options.logical_casting, "Allow logical casting");
@@ -95,6 +99,10 @@ namespace LCompilers::CommandLineInterface {
         app.add_option("--backend", opts.arg_backend, "Select a backend (llvm, c, cpp, x86, wasm, fortran, mlir)")->capture_default_str();
         app.add_flag("--openmp", compiler_options.openmp, "Enable openmp");
         app.add_flag("--openmp-lib-dir", compiler_options.openmp_lib_dir, "Pass path to openmp library")->capture_default_str();
+        app.add_option("--do-concurrent", opts.arg_do_concurrent, "Run `do concurrent` loops serially or on threads (serial, parallel)")->capture_default_str();
+        app.add_option("--do-concurrent-runtime", opts.arg_do_concurrent_runtime, "Threading runtime of parallel `do concurrent` loops (gomp, lfortran; default: gomp with --openmp, else lfortran)");
+        app.add_option("--do-concurrent-schedule", opts.arg_do_concurrent_schedule, "Distribution of the iterations of parallel `do concurrent` loops (static, dynamic)")->capture_default_str();
+        app.add_option("--do-concurrent-chunk", compiler_options.po.do_concurrent_chunk, "Iterations per chunk with --do-concurrent-schedule=dynamic (0: automatic)")->capture_default_str();
         app.add_flag("--lookup-name", compiler_options.lookup_name, "Lookup a name specified by --line & --column in the ASR");
         app.add_flag("--rename-symbol", compiler_options.rename_symbol, "Returns list of locations where symbol specified by --line & --column appears in the ASR");
         app.add_option("--line", compiler_options.line, "Line number for --lookup-name")->capture_default_str();
@@ -114,6 +122,8 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--implicit-argument-casting", compiler_options.implicit_argument_casting, "Allow implicit argument casting");
         app.add_flag("--print-leading-space", compiler_options.print_leading_space, "Print leading white space if format is unspecified");
         app.add_flag("--interactive-parse", compiler_options.interactive, "Use interactive parse");
+        app.add_flag("--jit-tiered", compiler_options.jit_tiered, "Interactive mode: compile inputs without optimizations, recompile hot procedures at O3 and unload code that can no longer run");
+        app.add_option("--jit-hot-calls", compiler_options.jit_hot_calls, "Number of calls after which --jit-tiered recompiles a procedure")->capture_default_str();
         app.add_flag("--verbose", compiler_options.po.verbose, "Print debugging statements");
         app.add_flag("--dump-all-passes", compiler_options.po.dump_all_passes, "Apply all the passes and dump the ASR into a file");
         app.add_flag("--dump-all-passes-fortran", compiler_options.po.dump_fortran, "Apply all passes and dump the ASR after each pass into fortran file");
@@ -130,6 +140,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--legacy-array-sections", compiler_options.legacy_array_sections, "Enables passing array items as sections if required");
         app.add_flag("--ignore-pragma", compiler_options.ignore_pragma, "Ignores all the pragmas");
         app.add_flag("--stack-arrays", compiler_options.stack_arrays, "Allocate memory for arrays on stack");
+        app.add_flag("--no-alias-metadata", compiler_options.no_alias_metadata, "Do not tell LLVM which memory accesses cannot alias (with --fast)");
         app.add_flag("--wasm-html", compiler_options.wasm_html, "Generate HTML file using emscripten for LLVM->WASM");
         app.add_option("--emcc-embed", compiler_options.emcc_embed, "Embed a given file/directory using emscripten for LLVM->WASM");
         app.add_flag("--mlir-gpu-offloading", compiler_options.po.enable_gpu_offloading, "Enables gpu offloading using MLIR backend");
@@ -216,12 +227,43 @@ namespace LCompilers::CommandLineInterface {
         // set openmp in pass options
         compiler_options.po.openmp = compiler_options.openmp;
 
+        if (opts.arg_do_concurrent == "parallel") {
+            compiler_options.po.do_concurrent_parallel = true;
+        } else if (opts.arg_do_concurrent != "serial") {
+            throw lc::LCompilersException(
+                "The option `--do-concurrent=" + opts.arg_do_concurrent + "` is not supported"
+            );
+        }
+        if (opts.arg_do_concurrent_runtime == "") {
+            compiler_options.po.do_concurrent_lfortran_runtime = !compiler_options.openmp;
+        } else if (opts.arg_do_concurrent_runtime == "lfortran") {
+            compiler_options.po.do_concurrent_lfortran_runtime = true;
+        } else if (opts.arg_do_concurrent_runtime != "gomp") {
+            throw lc::LCompilersException(
+                "The option `--do-concurrent-runtime=" + opts.arg_do_concurrent_runtime + "` is not supported"
+            );
+        }
+        if (opts.arg_do_concurrent_schedule == "dynamic") {
+            compiler_options.po.do_concurrent_dynamic = true;
+        } else if (opts.arg_do_concurrent_schedule != "static") {
+            throw lc::LCompilersException(
+                "The option `--do-concurrent-schedule=" + opts.arg_do_concurrent_schedule + "` is not supported"
+            );
+        }
+
         for (auto &f_flag : opts.f_flags) {
             if (f_flag == "PIC") {
                 // Position Independent Code
                 // We do this by default, so we ignore for now
             } else if (f_flag == "default-integer-8") {
                 compiler_options.po.default_integer_kind = 8;
+            } else if (f_flag == "lto" || f_flag == "lto=thin") {
+                // Only ThinLTO is implemented, which is what `-flto` means
+                compiler_options.thin_lto = true;
+                compiler_options.thin_lto_prelink = true;
+            } else if (f_flag == "no-lto") {
+                compiler_options.thin_lto = false;
+                compiler_options.thin_lto_prelink = false;
             } else {
                 throw lc::LCompilersException(
                     "The flag `-f" + f_flag + "` is not supported"
@@ -229,6 +271,40 @@ namespace LCompilers::CommandLineInterface {
             }
         }
 
+        // The last `-O` wins, like in GCC and Clang
+        for (auto &O_flag : opts.O_flags) {
+            compiler_options.size_level = 0;
+            if (O_flag.size() == 1 && O_flag[0] >= '0' && O_flag[0] <= '3') {
+                compiler_options.opt_level = O_flag[0] - '0';
+            } else if (O_flag == "s" || O_flag == "z") {
+                compiler_options.opt_level = 2;
+                compiler_options.size_level = O_flag == "s" ? 1 : 2;
+            } else if (O_flag == "fast") {
+                // Like in GCC: -O3 without strict standard compliance
+                compiler_options.opt_level = 3;
+                compiler_options.po.fast = true;
+            } else if (O_flag == "g") {
+                // Optimizations that keep the code debuggable
+                compiler_options.opt_level = 1;
+            } else {
+                throw lc::LCompilersException(
+                    "The flag `-O" + O_flag + "` is not supported"
+                );
+            }
+        }
+
+        for (auto &m_flag : opts.m_flags) {
+            if (startswith(m_flag, "arch=")) {
+                compiler_options.march = m_flag.substr(5);
+            } else if (startswith(m_flag, "tune=")) {
+                compiler_options.mtune = m_flag.substr(5);
+            } else {
+                throw lc::LCompilersException(
+                    "The flag `-m" + m_flag + "` is not supported"
+                );
+            }
+        }
+
         // if it's the only file, then we use that file
         // to set the compiler_options
         if (opts.arg_files.size() > 0) {
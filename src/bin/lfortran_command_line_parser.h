@@ -24,11 +24,15 @@ namespace LCompilers::CommandLineInterface {
         bool arg_c = false;
         bool arg_v = false;
         bool arg_E = false;
+        int arg_j = 1;
         std::vector<std::string> arg_l;
         std::vector<std::string> arg_L;
         std::vector<std::string> arg_files;
         std::string arg_file;
         std::string arg_standard;
+        std::string arg_do_concurrent = "serial";
+        std::string arg_do_concurrent_runtime;
+        std::string arg_do_concurrent_schedule = "static";
         bool arg_version = false;
         // see parser.prescan function for what 'prescanning' does
         bool show_prescan = false;
@@ -81,6 +85,7 @@ namespace LCompilers::CommandLineInterface {
         std::vector<std::string> linker_flags;
         std::vector<std::string> f_flags;
         std::vector<std::string> O_flags;
+        std::vector<std::string> m_flags;
 
         CompilerOptions compiler_options;
     }; // struct LFortranCommandLineOpts
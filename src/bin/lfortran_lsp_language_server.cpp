@@ -145,6 +145,7 @@ namespace LCompilers::LanguageServerProtocol {
             optionsByUri.clear();
             logger.debug() << "Invalidated compiler options cache." << std::endl;
         }
+        lfortran.invalidate();
     }
 
     auto LFortranLspLanguageServer::getLFortranConfig(
@@ -248,19 +249,22 @@ namespace LCompilers::LanguageServerProtocol {
         }
         const auto start = std::chrono::high_resolution_clock::now();
         auto readLock = LSP_READ_LOCK(document.mutex(), "document:" + document.uri());
-        const std::string &path = document.path().string();
-        const std::string &text = document.text();
-        const std::string &uri = document.uri();
+        const std::string path = document.path().string();
+        const std::string uri = document.uri();
+        // NOTE: These value may have been updated since the validation was
+        // requested, but that's okay because we want to validate the latest
+        // version anyway:
+        int version = document.version();
+        // Edits publish a new rope and leave this one as it is, so the
+        // document is not locked while LFortran runs. Only this copy of the
+        // text is assembled, not the one cached by `document.text()`.
+        const LineRope lines = document.lines();
+        readLock.unlock();
         try {
-            // NOTE: These value may have been updated since the validation was
-            // requested, but that's okay because we want to validate the latest
-            // version anyway:
-            int version = document.version();
+            const std::string text = lines.str();
             try {
-                readLock.unlock();
                 std::shared_ptr<CompilerOptions> compilerOptions =
                     getCompilerOptions(document);
-                readLock.lock();
                 logger.trace()
                     << "Getting diagnostics from LFortran for document with URI="
                     << uri << std::endl;
@@ -275,10 +279,8 @@ namespace LCompilers::LanguageServerProtocol {
                     << " diagnostics for document with URI=" << uri
                     << std::endl;
 
-                readLock.unlock();
                 const std::shared_ptr<lsc::LFortranLspConfig> config =
                     getLFortranConfig(uri);
-                readLock.lock();
 
                 unsigned int numProblems = config->maxNumberOfProblems;
                 if (highlights.size() < numProblems) {
@@ -1249,6 +1251,8 @@ namespace LCompilers::LanguageServerProtocol {
         const NotificationMessage &/*notification*/,
         DeleteFilesParams &/*params*/
     ) -> void {
+        // The deleted files may be .mod files used by the documents
+        lfortran.invalidate();
         auto readLock = LSP_READ_LOCK(documentMutex, "documents");
         for (auto &[uri, document] : documentsByUri) {
             validate(document);
@@ -1305,6 +1309,7 @@ namespace LCompilers::LanguageServerProtocol {
                 highlightsByDocumentId.erase(iter);
             }
         }
+        lfortran.invalidate(document->path().string());
         BaseLspLanguageServer::receiveTextDocument_didClose(notification, params);
     }
 
@@ -1313,6 +1318,7 @@ namespace LCompilers::LanguageServerProtocol {
         const NotificationMessage &/*notification*/,
         DidChangeWatchedFilesParams &/*params*/
     ) -> void {
+        lfortran.invalidate();
         auto readLock = LSP_READ_LOCK(documentMutex, "documents");
         for (auto &[uri, document] : documentsByUri) {
             validate(document);
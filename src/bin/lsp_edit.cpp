@@ -0,0 +1,90 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <server/logger.h>
+#include <server/lsp_specification.h>
+#include <server/lsp_text_document.h>
+
+namespace lsl = LCompilers::LLanguageServer::Logging;
+namespace lsp = LCompilers::LanguageServerProtocol;
+
+// One keystroke, as sent by an editor in a `textDocument/didChange`
+struct Keystroke {
+    std::size_t line;
+    std::size_t column;
+    std::size_t endColumn;  // > column for a backspace
+    std::string text;
+};
+
+// Replays a typing session against a large document: the cursor jumps to a
+// random line, a statement is typed one character at a time (with the odd
+// typo fixed by a backspace) and finished with a newline, as an editor would
+// report it with one incremental change per keystroke.
+int main()
+{
+    int N = 200000;     // Lines in the document
+    int M = 2000;       // Statements typed
+    std::string text;
+    for (int i = 0; i < N; i++) {
+        text += "    x" + std::to_string(i % 97) + " = x" + std::to_string(i % 89)
+            + " + " + std::to_string(i) + "\n";
+    }
+
+    std::mt19937 rng(20240101);
+    std::vector<Keystroke> session;
+    std::size_t numLines = N + 1;
+    for (int i = 0; i < M; i++) {
+        std::size_t line = rng() % numLines;
+        std::string statement = "    y = y + " + std::to_string(i) + " * z";
+        std::size_t column = 0;
+        for (char c : statement) {
+            session.push_back({line, column, column, std::string(1, c)});
+            column++;
+            if (rng() % 10 == 0) {
+                session.push_back({line, column, column, "q"});
+                session.push_back({line, column, column + 1, ""});
+            }
+        }
+        session.push_back({line, column, column, "\n"});
+        numLines++;
+    }
+
+    lsl::Logger logger("/dev/null", "lsp_edit");
+    lsp::LspTextDocument document("file:///bench.f90", "fortran", 0, text, logger);
+
+    std::cout << "Replay " << session.size() << " keystrokes" << std::endl;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    int version = 1;
+    std::size_t symbols = 0;
+    for (const Keystroke &k : session) {
+        std::vector<lsp::TextDocumentContentChangeEvent> changes(1);
+        lsp::TextDocumentContentChangeEvent_0 change;
+        change.range.start.line = k.line;
+        change.range.start.character = k.column;
+        change.range.end.line = k.line;
+        change.range.end.character = k.endColumn;
+        change.text = k.text;
+        changes[0] = std::move(change);
+        document.apply(changes, version++);
+        // What a hover or completion request would read at the cursor
+        symbols += document.symbolAt(k.line, k.column).length();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::size_t length = document.text().length();
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    auto us = [](auto d) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    };
+    std::cout << "Edits: " << us(t2 - t1) / 1000 << "ms ("
+        << (double)us(t2 - t1) / session.size() << "us per keystroke)"
+        << std::endl;
+    std::cout << "Text: " << us(t3 - t2) / 1000 << "ms" << std::endl;
+    std::cout << "Lines: " << document.numLines() << std::endl;
+    std::cout << "Length (bytes): " << length << std::endl;
+    std::cout << "Symbol characters read: " << symbols << std::endl;
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+/*
+ * Reports the GFLOP/s of `matmul` of N x N real(8) matrices for N = 16, 32,
+ * ... up to MAX_N (1024 by default), once with the loops that `matmul`
+ * falls back to for non-contiguous arrays, and once with
+ * `_lfortran_dmatmul`, which contiguous arrays use. Products of at least
+ * 2^22 multiply-adds run on all threads unless LFORTRAN_NUM_THREADS=1, and
+ * on the BLAS if the benchmark is linked with one.
+ *
+ * Usage: matmul_gflops [MAX_N]
+ */
+
+// r(i, j) = sum over k of a(i, k) * b(k, j), column by column
+static void loops(int64_t n, const double *a, const double *b, double *r)
+{
+    for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < n; i++) r[i + j*n] = 0;
+        for (int64_t k = 0; k < n; k++) {
+            double bkj = b[k + j*n];
+            for (int64_t i = 0; i < n; i++) r[i + j*n] += a[i + k*n] * bkj;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int64_t max_n = argc > 1 ? std::atoll(argv[1]) : 1024;
+    double checksum = 0;
+    std::cout << "     N      loops   runtime  (GFLOP/s)" << std::endl;
+    for (int64_t n = 16; n <= max_n; n *= 2) {
+        std::vector<double> a(n*n), b(n*n), r(n*n);
+        for (int64_t i = 0; i < n*n; i++) {
+            a[i] = (double)(i % 7) - 3;
+            b[i] = (double)(i % 5) / 4;
+        }
+        double flops = 2.0 * n * n * n;
+        // Repeat small products for at least about 10^8 flops
+        int reps = (int)(1e8 / flops) + 1;
+        double gflops[2];
+        for (int method = 0; method < 2; method++) {
+            auto t1 = std::chrono::high_resolution_clock::now();
+            for (int rep = 0; rep < reps; rep++) {
+                if (method == 0) {
+                    loops(n, a.data(), b.data(), r.data());
+                } else {
+                    _lfortran_dmatmul(n, n, n, a.data(), b.data(), r.data());
+                }
+                checksum += r[rep % (n*n)];
+            }
+            auto t2 = std::chrono::high_resolution_clock::now();
+            double s = std::chrono::duration<double>(t2 - t1).count();
+            gflops[method] = flops * reps / s / 1e9;
+        }
+        std::cout.width(6);
+        std::cout << n;
+        std::cout.width(11);
+        std::cout << gflops[0];
+        std::cout.width(10);
+        std::cout << gflops[1] << std::endl;
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include <bin/module_dependency_scheduler.h>
+#include <libasr/string_utils.h>
+
+namespace LCompilers::LFortran {
+
+namespace {
+
+    bool is_name_chr(char c) {
+        return std::isalnum((unsigned char)c) || c == '_';
+    }
+
+    void skip_blanks(const std::string &s, size_t &pos) {
+        while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t'
+                || s[pos] == '\r')) {
+            pos++;
+        }
+    }
+
+    // Reads an identifier starting at `pos` (after skipping blanks)
+    std::string read_name(const std::string &s, size_t &pos) {
+        skip_blanks(s, pos);
+        size_t start = pos;
+        while (pos < s.size() && is_name_chr(s[pos])) pos++;
+        return s.substr(start, pos - start);
+    }
+
+    // Removes a trailing `!` comment, ignoring `!` inside string literals
+    std::string strip_comment(const std::string &line) {
+        char quote = 0;
+        for (size_t i = 0; i < line.size(); i++) {
+            char c = line[i];
+            if (quote) {
+                if (c == quote) quote = 0;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '!') {
+                return line.substr(0, i);
+            }
+        }
+        return line;
+    }
+
+    void scan_statement(const std::string &stmt, CompilationUnit &unit) {
+        size_t pos = 0;
+        std::string keyword = read_name(stmt, pos);
+        if (keyword == "module") {
+            std::string name = read_name(stmt, pos);
+            skip_blanks(stmt, pos);
+            // `module procedure`, `module function`, ... inside submodules
+            // and interfaces are not module definitions
+            if (name.empty() || pos < stmt.size() || name == "procedure"
+                    || name == "function" || name == "subroutine") {
+                return;
+            }
+            unit.provides.push_back(name);
+        } else if (keyword == "submodule") {
+            // submodule (ancestor[:parent]) name
+            skip_blanks(stmt, pos);
+            if (pos >= stmt.size() || stmt[pos] != '(') return;
+            pos++;
+            std::string ancestor = read_name(stmt, pos);
+            if (!ancestor.empty()) unit.uses.push_back(ancestor);
+        } else if (keyword == "use") {
+            // use [[, intrinsic | , non_intrinsic] ::] name [, ...]
+            skip_blanks(stmt, pos);
+            if (pos < stmt.size() && stmt[pos] == ',') {
+                pos++;
+                std::string nature = read_name(stmt, pos);
+                if (nature == "intrinsic") return;
+                skip_blanks(stmt, pos);
+            }
+            if (stmt.compare(pos, 2, "::") == 0) pos += 2;
+            std::string name = read_name(stmt, pos);
+            if (!name.empty()) unit.uses.push_back(name);
+        }
+    }
+
+} // namespace
+
+CompilationUnit scan_module_dependencies(const std::string &filename,
+    const std::string &input, bool fixed_form)
+{
+    CompilationUnit unit;
+    unit.filename = filename;
+    std::istringstream in(input);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (fixed_form && !line.empty() && (line[0] == 'c' || line[0] == 'C'
+                || line[0] == '*')) {
+            continue;
+        }
+        line = to_lower(strip_comment(line));
+        // Statements separated by `;` on a single line
+        size_t start = 0;
+        while (start <= line.size()) {
+            size_t end = line.find(';', start);
+            if (end == std::string::npos) end = line.size();
+            scan_statement(line.substr(start, end - start), unit);
+            start = end + 1;
+        }
+    }
+    std::sort(unit.uses.begin(), unit.uses.end());
+    unit.uses.erase(std::unique(unit.uses.begin(), unit.uses.end()),
+        unit.uses.end());
+    return unit;
+}
+
+ModuleDependencyScheduler::ModuleDependencyScheduler(
+    const std::vector<CompilationUnit> &units) : units{units}
+{
+}
+
+bool ModuleDependencyScheduler::build_graph(std::string &error)
+{
+    size_t n = units.size();
+    std::map<std::string, size_t> provider;
+    for (size_t i = 0; i < n; i++) {
+        for (auto &mod : units[i].provides) {
+            auto it = provider.find(mod);
+            if (it != provider.end() && it->second != i) {
+                error = "Module '" + mod + "' is defined in both '"
+                    + units[it->second].filename + "' and '"
+                    + units[i].filename + "'";
+                return false;
+            }
+            provider[mod] = i;
+        }
+    }
+
+    dependents.assign(n, {});
+    n_deps.assign(n, 0);
+    for (size_t i = 0; i < n; i++) {
+        // Modules not provided by any unit (intrinsic, or already compiled
+        // to a .mod file) impose no ordering
+        std::set<size_t> deps;
+        for (auto &mod : units[i].uses) {
+            auto it = provider.find(mod);
+            if (it != provider.end() && it->second != i) {
+                deps.insert(it->second);
+            }
+        }
+        n_deps[i] = deps.size();
+        for (size_t d : deps) dependents[d].push_back(i);
+    }
+
+    // Kahn's algorithm, picking the lowest index first so that the order
+    // follows the command line whenever the graph allows it
+    order.clear();
+    std::vector<size_t> remaining = n_deps;
+    std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> ready;
+    for (size_t i = 0; i < n; i++) {
+        if (remaining[i] == 0) ready.push(i);
+    }
+    while (!ready.empty()) {
+        size_t i = ready.top();
+        ready.pop();
+        order.push_back(i);
+        for (size_t d : dependents[i]) {
+            if (--remaining[d] == 0) ready.push(d);
+        }
+    }
+    if (order.size() != n) {
+        error = "Circular module dependency between:";
+        for (size_t i = 0; i < n; i++) {
+            if (remaining[i] != 0) error += " '" + units[i].filename + "'";
+        }
+        return false;
+    }
+
+    height.assign(n, 1);
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        for (size_t d : dependents[*it]) {
+            height[*it] = std::max(height[*it], height[d] + 1);
+        }
+    }
+    return true;
+}
+
+std::vector<size_t> ModuleDependencyScheduler::topological_order() const
+{
+    return order;
+}
+
+std::vector<int> ModuleDependencyScheduler::run(size_t n_jobs,
+    const CompileFn &compile, bool continue_on_error)
+{
+    size_t n = units.size();
+    std::vector<int> status(n, -1);
+    if (n == 0) return status;
+    if (n_jobs == 0) n_jobs = std::max(1u, std::thread::hardware_concurrency());
+    n_jobs = std::min(n_jobs, n);
+
+    // Units on the longest remaining chain are started first; ties are
+    // broken by the position on the command line.
+    auto lower_priority = [&](size_t a, size_t b) {
+        if (height[a] != height[b]) return height[a] < height[b];
+        return a > b;
+    };
+    std::priority_queue<size_t, std::vector<size_t>,
+        decltype(lower_priority)> ready(lower_priority);
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::vector<size_t> remaining = n_deps;
+    std::vector<bool> released(n, false), poisoned(n, false);
+    size_t unfinished = n;
+    std::exception_ptr exception;
+
+    for (size_t i = 0; i < n; i++) {
+        if (remaining[i] == 0) ready.push(i);
+    }
+
+    // Must be called with `m` locked
+    auto release = [&](size_t i) {
+        if (released[i]) return;
+        released[i] = true;
+        for (size_t d : dependents[i]) {
+            if (--remaining[d] == 0) ready.push(d);
+        }
+        cv.notify_all();
+    };
+
+    auto worker = [&]() {
+        while (true) {
+            size_t i;
+            bool skip;
+            {
+                std::unique_lock<std::mutex> lock(m);
+                cv.wait(lock, [&] { return !ready.empty() || unfinished == 0; });
+                if (ready.empty()) return;
+                i = ready.top();
+                ready.pop();
+                skip = poisoned[i];
+            }
+            int err = -1;
+            if (!skip) {
+                try {
+                    err = compile(i, [&, i]() {
+                        std::lock_guard<std::mutex> lock(m);
+                        release(i);
+                    });
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(m);
+                    if (!exception) exception = std::current_exception();
+                    err = 1;
+                }
+            }
+            std::lock_guard<std::mutex> lock(m);
+            status[i] = err;
+            if (err != 0 && !continue_on_error) {
+                for (size_t d : dependents[i]) poisoned[d] = true;
+            }
+            release(i);
+            unfinished--;
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t j = 0; j < n_jobs; j++) workers.emplace_back(worker);
+    for (auto &t : workers) t.join();
+    if (exception) std::rethrow_exception(exception);
+    return status;
+}
+
+} // namespace LCompilers::LFortran
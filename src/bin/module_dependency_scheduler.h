@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace LCompilers::LFortran {
+
+    /*
+        A source file that is compiled as a single unit, together with the
+        (lowercase) names of the modules it defines and the modules it `use`s.
+    */
+    struct CompilationUnit {
+        std::string filename;
+        std::vector<std::string> provides;
+        std::vector<std::string> uses;
+    };
+
+    /*
+        Collects the `module`, `submodule` and `use` statements of a Fortran
+        source without tokenizing or parsing it. Intrinsic modules are
+        skipped, since they are never provided by a user source file.
+    */
+    CompilationUnit scan_module_dependencies(const std::string &filename,
+        const std::string &input, bool fixed_form);
+
+    /*
+        Compiles a set of units on a pool of worker threads, honouring the
+        `use` graph between them: a unit is started only after every unit
+        that provides one of the modules it uses has released its .mod files.
+
+        The callback `compile(i, release)` compiles `units[i]` and returns
+        its exit code. It should call `release()` as soon as the .mod files
+        of the unit are written, so that dependent units can start while it
+        is still in the backend. Units that were never released are released
+        once `compile` returns.
+    */
+    class ModuleDependencyScheduler {
+    public:
+        typedef std::function<int(size_t, const std::function<void()> &)>
+            CompileFn;
+
+        ModuleDependencyScheduler(const std::vector<CompilationUnit> &units);
+
+        // Returns false (and fills `error`) if the `use` graph has a cycle
+        // or a module is defined in more than one unit.
+        bool build_graph(std::string &error);
+
+        // Units in an order in which each unit comes after its dependencies
+        std::vector<size_t> topological_order() const;
+
+        /*
+            Runs `compile` over all units using `n_jobs` threads and returns
+            the exit code of every unit. Dependents of a failed unit are not
+            compiled (their status is -1) unless `continue_on_error` is set.
+        */
+        std::vector<int> run(size_t n_jobs, const CompileFn &compile,
+            bool continue_on_error);
+
+    private:
+        std::vector<CompilationUnit> units;
+        // dependents[i]: units that use a module provided by units[i]
+        std::vector<std::vector<size_t>> dependents;
+        // n_deps[i]: number of distinct units that units[i] depends on
+        std::vector<size_t> n_deps;
+        // Length of the longest chain of dependents, used as the priority
+        std::vector<size_t> height;
+        std::vector<size_t> order;
+    };
+
+} // namespace LCompilers::LFortran
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+/*
+ * Measures the throughput of the random number generator behind
+ * `random_number`: filling an array of N (10^6 by default) reals in bulk,
+ * drawing them one at a time, and filling from T threads at once.
+ *
+ * Usage: random_numbers [N] [T]
+ */
+int main(int argc, char *argv[])
+{
+    int64_t N = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    int T = argc > 2 ? std::atoi(argv[2]) : 4;
+    const int repeat = 100;
+    _lfortran_init_random_seed(20240101);
+    std::vector<double> x(N);
+    std::vector<float> y(N);
+    double checksum = 0;
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeat; r++) {
+        _lfortran_dp_random_fill(N, x.data());
+        checksum += x[r % N];
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t2 - t1).count();
+    std::cout << "real(8), bulk:   " << ns / (N * repeat) << "ns per number" << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeat; r++) {
+        _lfortran_sp_random_fill(N, y.data());
+        checksum += y[r % N];
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    ns = std::chrono::duration<double, std::nano>(t2 - t1).count();
+    std::cout << "real(4), bulk:   " << ns / (N * repeat) << "ns per number" << std::endl;
+
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeat; r++) {
+        for (int64_t i = 0; i < N; i++) {
+            x[i] = _lfortran_dp_rand_num();
+        }
+        checksum += x[r % N];
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    ns = std::chrono::duration<double, std::nano>(t2 - t1).count();
+    std::cout << "real(8), scalar: " << ns / (N * repeat) << "ns per number" << std::endl;
+
+    std::vector<std::vector<double>> xs(T, std::vector<double>(N));
+    std::vector<std::thread> threads;
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < T; t++) {
+        threads.emplace_back([&xs, t, N]() {
+            for (int r = 0; r < repeat; r++) {
+                _lfortran_dp_random_fill(N, xs[t].data());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    ns = std::chrono::duration<double, std::nano>(t2 - t1).count();
+    std::cout << "real(8), bulk, " << T << " threads: " << ns / (N * repeat * T)
+        << "ns per number" << std::endl;
+    for (int t = 0; t < T; t++) {
+        checksum += xs[t][0];
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+    return 0;
+}
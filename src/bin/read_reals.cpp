@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+// The same sequence of reals for writing and checking
+class Reals {
+    std::mt19937_64 rng;
+    std::uniform_real_distribution<double> mantissa;
+    std::uniform_int_distribution<int> exponent;
+public:
+    Reals() : rng(20240101), mantissa(-1, 1), exponent(-12, 12) {}
+    double next() {
+        return mantissa(rng) * std::pow(10.0, exponent(rng));
+    }
+};
+
+/*
+ * Reads N (10^8 by default) reals written with 17 significant digits, five
+ * per line, with `read(u, *) x` in chunks of 10^6, and checks that each one
+ * is read back exactly.
+ *
+ * Usage: read_reals [N] [file]
+ */
+int main(int argc, char *argv[])
+{
+    int64_t N = argc > 1 ? std::atoll(argv[1]) : 100000000;
+    std::string filename = argc > 2 ? argv[2] : "read_reals.txt";
+    const int64_t chunk = 1000000;
+
+    std::cout << "Write " << N << " reals to " << filename << std::endl;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    {
+        FILE *f = std::fopen(filename.c_str(), "w");
+        if (!f) {
+            std::perror(filename.c_str());
+            return 1;
+        }
+        Reals reals;
+        std::vector<char> buffer(1 << 20);
+        std::size_t n = 0;
+        for (int64_t i = 0; i < N; i++) {
+            n += std::snprintf(buffer.data() + n, 32, "%.17g%c", reals.next(),
+                (i % 5 == 4) ? '\n' : ' ');
+            if (n > buffer.size() - 32) {
+                std::fwrite(buffer.data(), 1, n, f);
+                n = 0;
+            }
+        }
+        std::fwrite(buffer.data(), 1, n, f);
+        std::fclose(f);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    std::vector<double> x(chunk);
+    Reals reals;
+    int64_t mismatches = 0;
+    _lfortran_open(10, (char*)filename.c_str(), (char*)"old", nullptr,
+        nullptr, nullptr, nullptr);
+    auto t3 = std::chrono::high_resolution_clock::now();
+    double read_time = 0;
+    for (int64_t i = 0; i < N; i += chunk) {
+        int n = (int)std::min(chunk, N - i);
+        auto start = std::chrono::high_resolution_clock::now();
+        _lfortran_read_array_double(x.data(), n, 10);
+        auto end = std::chrono::high_resolution_clock::now();
+        read_time += std::chrono::duration<double>(end - start).count();
+        for (int j = 0; j < n; j++) {
+            double expected = reals.next();
+            if (std::memcmp(&x[j], &expected, sizeof(double)) != 0) {
+                mismatches++;
+            }
+        }
+    }
+    _lfortran_close(10, nullptr);
+    auto t4 = std::chrono::high_resolution_clock::now();
+
+    auto s = [](auto d) {
+        return std::chrono::duration<double>(d).count();
+    };
+    std::cout << "Write: " << s(t2 - t1) << "s" << std::endl;
+    std::cout << "Read: " << read_time << "s ("
+        << N / read_time / 1e6 << " million reals/s)" << std::endl;
+    std::cout << "Read and check: " << s(t4 - t3) << "s" << std::endl;
+    std::cout << "Mismatches: " << mismatches << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <chrono>
+#include <lfortran/parser/parser.h>
+#include <lfortran/semantics/ast_to_asr.h>
+#include <libasr/asr_scopes.h>
+#include <libasr/asr_utils.h>
+
+// Benchmarks the semantic phase on a large module: many module variables,
+// each used from many procedures, so that most of the time is spent resolving
+// symbols through nested scopes.
+int main()
+{
+    int N = 2000; // Module variables
+    int M = 2000; // Procedures
+    std::string text = "module bench\nimplicit none\n";
+    for (int i = 0; i < N; i++) {
+        text += "integer :: v" + std::to_string(i) + " = " + std::to_string(i)
+            + "\n";
+    }
+    text += "contains\n";
+    for (int i = 0; i < M; i++) {
+        std::string s = std::to_string(i);
+        text += "subroutine g" + s + "(x)\ninteger, intent(inout) :: x\n";
+        text += "integer :: i\n";
+        text += "do i = 1, 10\n";
+        for (int j = 0; j < 10; j++) {
+            text += "    x = x + v" + std::to_string((7*i + 13*j) % N) + "*i\n";
+        }
+        text += "end do\n";
+        if (i > 0) text += "call g" + std::to_string(i-1) + "(x)\n";
+        text += "end subroutine\n";
+    }
+    text += "end module\n";
+
+    Allocator al(64*1024*1024);
+    LCompilers::diag::Diagnostics diagnostics;
+    LCompilers::CompilerOptions co;
+    LCompilers::LocationManager lm;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = "bench.f90";
+        lm.files.push_back(fl);
+        lm.file_ends.push_back(text.size());
+        lm.init_simple(text);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    auto ast = LCompilers::LFortran::parse(al, text, diagnostics, co);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    auto asr = LCompilers::LFortran::ast_to_asr(al, *LCompilers::TRY(ast),
+        diagnostics, nullptr, false, co, lm);
+    auto t3 = std::chrono::high_resolution_clock::now();
+    if (!asr.ok) {
+        std::cerr << diagnostics.render(lm, co);
+        return 1;
+    }
+
+    // Lookups alone: resolve every module variable from the innermost scope
+    LCompilers::SymbolTable *mod_scope = nullptr;
+    for (auto &a : LCompilers::TRY(asr)->m_symtab->get_scope()) {
+        mod_scope = LCompilers::ASRUtils::symbol_symtab(a.second);
+    }
+    LCompilers::SymbolTable fn_scope(mod_scope);
+    LCompilers::SymbolTable block_scope(&fn_scope);
+    std::vector<std::string> names;
+    for (int i = 0; i < N; i++) names.push_back("v" + std::to_string(i));
+    size_t found = 0;
+    auto t4 = std::chrono::high_resolution_clock::now();
+    for (int k = 0; k < 100; k++) {
+        for (auto &name : names) {
+            if (block_scope.resolve_symbol(name)) found++;
+        }
+    }
+    auto t5 = std::chrono::high_resolution_clock::now();
+
+    std::cout << "Parsing:   " <<
+        std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count()
+        << "ms" << std::endl;
+    std::cout << "Semantics: " <<
+        std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count()
+        << "ms" << std::endl;
+    std::cout << "resolve_symbol (" << found << " lookups): " <<
+        std::chrono::duration_cast<std::chrono::milliseconds>(t5 - t4).count()
+        << "ms" << std::endl;
+    std::cout << "String size (bytes):      " << text.size() << std::endl;
+    std::cout << "Allocator usage (bytes): " << al.size_current() << std::endl;
+    return 0;
+}
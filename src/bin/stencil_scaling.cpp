@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+/*
+ * Measures the strong scaling of a Jacobi sweep over an N x N grid (2048 by
+ * default) run the way `--do-concurrent=parallel` runs
+ *
+ *     do concurrent (i = 2:n-1, j = 2:n-1)
+ *         v(i, j) = (u(i-1, j) + u(i+1, j) + u(i, j-1) + u(i, j+1)) / 4
+ *     end do
+ *
+ * on the LFortran runtime: the collapsed iteration space is split evenly
+ * among the threads (static schedule) or handed out in chunks of 8 per
+ * thread, stolen from each other as threads run out (dynamic schedule).
+ * Reports the time per sweep and the speedup over one thread for 1, 2, 4,
+ * ... up to MAX_THREADS threads (the number of processors by default).
+ *
+ * Usage: stencil_scaling [N] [SWEEPS] [MAX_THREADS]
+ */
+
+struct Grid {
+    int64_t n;
+    const double *u;
+    double *v;
+    bool dynamic;
+};
+
+static void sweep_range(const Grid &g, int64_t first, int64_t last)
+{
+    int64_t m = g.n - 2;
+    for (int64_t k = first; k < last; k++) {
+        int64_t i = k % m + 1, j = k / m + 1;
+        const double *u = g.u + j*g.n + i;
+        g.v[j*g.n + i] = (u[-1] + u[1] + u[-g.n] + u[g.n]) / 4;
+    }
+}
+
+// The outlined loop body
+static void sweep(void *data)
+{
+    const Grid &g = *(const Grid*)data;
+    int64_t total = (g.n - 2) * (g.n - 2);
+    int64_t threads = _lfortran_get_num_threads();
+    if (g.dynamic) {
+        int64_t chunk = std::max<int64_t>(total / (threads * 8), 1);
+        int64_t first, last;
+        bool more = _lfortran_loop_dynamic_start(0, total, 1, chunk, &first,
+            &last);
+        while (more) {
+            sweep_range(g, first, last);
+            more = _lfortran_loop_dynamic_next(&first, &last);
+        }
+        _lfortran_loop_end_nowait();
+    } else {
+        int64_t thread = _lfortran_get_thread_num();
+        int64_t chunk = total / threads, leftovers = total % threads;
+        int64_t first = chunk * thread + std::min(thread, leftovers);
+        sweep_range(g, first, first + chunk + (thread < leftovers ? 1 : 0));
+    }
+    _lfortran_barrier();
+}
+
+int main(int argc, char *argv[])
+{
+    int64_t n = argc > 1 ? std::atoll(argv[1]) : 2048;
+    int sweeps = argc > 2 ? std::atoi(argv[2]) : 50;
+    int max_threads = argc > 3 ? std::atoi(argv[3])
+        : (int)std::thread::hardware_concurrency();
+    if (max_threads < 1) max_threads = 1;
+
+    std::vector<double> u(n*n, 0.0), v(n*n, 0.0);
+    for (int64_t j = 0; j < n; j++) u[j*n] = v[j*n] = 1;
+
+    for (int dynamic = 0; dynamic < 2; dynamic++) {
+        std::cout << (dynamic ? "dynamic" : "static") << " schedule:"
+            << std::endl;
+        double t1 = 0;
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            Grid a{n, u.data(), v.data(), dynamic == 1};
+            Grid b{n, v.data(), u.data(), dynamic == 1};
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int s = 0; s < sweeps; s += 2) {
+                _lfortran_parallel(sweep, &a, threads, 0);
+                _lfortran_parallel(sweep, &b, threads, 0);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(
+                end - start).count() / sweeps;
+            if (threads == 1) t1 = ms;
+            std::cout << "  " << threads << " threads: " << ms
+                << " ms per sweep, speedup " << t1 / ms << std::endl;
+        }
+    }
+    std::cout << "Checksum: " << u[(n/2)*n + 1] << std::endl;
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+/*
+ * Measures `s = s // "field,"` for an allocatable `s`, which the LLVM backend
+ * lowers to `_lfortran_str_append_descriptor_string`. The time per append
+ * must not grow with the length of `s`: it stays flat from 10^4 up to N
+ * (10^7 by default) appends as long as appends are linear in total.
+ *
+ * Usage: string_append [N]
+ */
+int main(int argc, char *argv[])
+{
+    int64_t N = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    char piece[] = "field,";
+    char *pieces[1] = {piece};
+    int64_t checksum = 0;
+    for (int64_t n = 10000; n <= N; n *= 10) {
+        char *s = nullptr;
+        int64_t size = 0, capacity = 0;
+        _lfortran_strcpy_descriptor_string(&s, (char*)"", &size, &capacity);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int64_t i = 0; i < n; i++) {
+            _lfortran_str_append_descriptor_string(&s, &size, &capacity, 1, pieces);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t2 - t1).count();
+        std::cout << n << " appends: " << ns / n << "ns per append" << std::endl;
+        if (size != n * (int64_t)std::strlen(piece)) {
+            std::cerr << "Wrong length: " << size << std::endl;
+            return 1;
+        }
+        checksum += s[size - 1];
+        std::free(s);
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+    return 0;
+}
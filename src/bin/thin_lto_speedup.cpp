@@ -0,0 +1,127 @@
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/*
+ * Compiles a program of two Fortran files with `--generate-object-code
+ * --fast`, once to object files and once with `-flto=thin`, and reports the
+ * run time of both executables (the best of 3 runs). The time stepping loop
+ * of the main program only reaches the particle positions through accessor
+ * functions of a module in the other file, which only ThinLTO can inline.
+ * Without `--generate-object-code` the main program would compile the
+ * module's procedures itself.
+ *
+ * Usage: thin_lto_speedup [LFORTRAN]
+ * LFORTRAN is the compiler to use, the `lfortran` next to this benchmark by
+ * default.
+ */
+
+static const char *module_source = R"(module thin_lto_particles
+implicit none
+integer, parameter :: n = 1000
+real(8) :: x(n), v(n)
+
+contains
+
+    real(8) function get_x(i)
+    integer, intent(in) :: i
+    get_x = x(i)
+    end function
+
+    real(8) function get_v(i)
+    integer, intent(in) :: i
+    get_v = v(i)
+    end function
+
+    subroutine set_x(i, value)
+    integer, intent(in) :: i
+    real(8), intent(in) :: value
+    x(i) = value
+    end subroutine
+
+end module
+)";
+
+static const char *program_source = R"(program thin_lto_main
+use thin_lto_particles
+implicit none
+integer :: i, step
+real(8) :: s
+do i = 1, n
+    x(i) = i
+    v(i) = modulo(i, 7) - 3
+end do
+do step = 1, 100000
+    do i = 1, n
+        call set_x(i, get_x(i) + 1e-3_8*get_v(i))
+    end do
+end do
+s = 0
+do i = 1, n
+    s = s + get_x(i)
+end do
+print *, s
+end program
+)";
+
+static bool run(const std::string &cmd)
+{
+    if (std::system(cmd.c_str()) != 0) {
+        std::cerr << "The command '" << cmd << "' failed" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Returns the best time in seconds, or a negative number on failure
+static double build_and_time(const std::string &lfortran,
+        const std::string &name, const std::string &flags)
+{
+    std::string fc = lfortran + " --generate-object-code --fast " + flags;
+    if (!run(fc + " -c thin_lto_particles.f90 -o " + name + "_particles.o")
+            || !run(fc + " -c thin_lto_main.f90 -o " + name + "_main.o")
+            || !run(lfortran + " " + name + "_main.o " + name
+                + "_particles.o -o " + name)) {
+        return -1;
+    }
+    double best = -1;
+    for (int i = 0; i < 3; i++) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        if (!run("./" + name + " > " + name + ".txt")) return -1;
+        auto t2 = std::chrono::high_resolution_clock::now();
+        double s = std::chrono::duration<double>(t2 - t1).count();
+        if (best < 0 || s < best) best = s;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    namespace fs = std::filesystem;
+    std::string lfortran = argc > 1 ? argv[1]
+        : (fs::absolute(argv[0]).parent_path() / "lfortran").string();
+    fs::path dir = fs::temp_directory_path() / "lfortran_thin_lto_speedup";
+    fs::create_directories(dir);
+    fs::current_path(dir);
+    std::ofstream("thin_lto_particles.f90") << module_source;
+    std::ofstream("thin_lto_main.f90") << program_source;
+
+    double objects = build_and_time(lfortran, "objects", "");
+    double lto = build_and_time(lfortran, "thin_lto", "-flto=thin");
+    if (objects < 0 || lto < 0) return 1;
+    std::string out1, out2;
+    std::getline(std::ifstream("objects.txt"), out1);
+    std::getline(std::ifstream("thin_lto.txt"), out2);
+    std::cout << "Object files: " << objects << " s" << std::endl;
+    std::cout << "-flto=thin:   " << lto << " s" << std::endl;
+    std::cout << "Speedup:      " << objects / lto << std::endl;
+    if (out1 != out2) {
+        std::cerr << "The outputs differ: " << out1 << " and " << out2
+            << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/IR/Dominators.h>
+#include <llvm/IR/Module.h>
+
+#include <lfortran/fortran_evaluator.h>
+#include <lfortran/utils.h>
+#include <libasr/codegen/evaluator.h>
+#include <libasr/stacktrace.h>
+#include <libasr/string_utils.h>
+
+/*
+ * Compiles each given file with --fast, once with --no-alias-metadata and
+ * once without, and reports for both how many of the innermost loops that
+ * are left after optimization were vectorized. Scalar remainder loops of
+ * vectorized loops are not counted.
+ *
+ * Usage: vectorization FILE...
+ * For example, from the build directory:
+ *
+ *     src/bin/vectorization ../integration_tests/{arrays,doloop}_*.f90
+ */
+
+struct LoopCounts {
+    size_t loops = 0;
+    size_t vectorized = 0;
+};
+
+static bool has_loop_property(llvm::Loop *loop, const std::string &name)
+{
+    llvm::MDNode *id = loop->getLoopID();
+    if (!id) return false;
+    for (const llvm::MDOperand &op : id->operands()) {
+        llvm::MDNode *property = llvm::dyn_cast_or_null<llvm::MDNode>(op.get());
+        if (!property || property->getNumOperands() == 0) continue;
+        llvm::MDString *s = llvm::dyn_cast<llvm::MDString>(property->getOperand(0));
+        if (s && s->getString() == name) return true;
+    }
+    return false;
+}
+
+static bool has_vector_code(llvm::Loop *loop)
+{
+    for (llvm::BasicBlock *BB : loop->blocks()) {
+        for (llvm::Instruction &I : *BB) {
+            if (I.getType()->isVectorTy()) return true;
+        }
+    }
+    return false;
+}
+
+static void count_loops(llvm::Module &m, LoopCounts &counts)
+{
+    for (llvm::Function &F : m) {
+        if (F.isDeclaration()) continue;
+        llvm::DominatorTree DT(F);
+        llvm::LoopInfo LI(DT);
+        for (llvm::Loop *loop : LI.getLoopsInPreorder()) {
+            if (!loop->getSubLoops().empty()) continue;
+            bool vector = has_vector_code(loop);
+            if (!vector && has_loop_property(loop, "llvm.loop.isvectorized")) {
+                continue;
+            }
+            counts.loops++;
+            if (vector) counts.vectorized++;
+        }
+    }
+}
+
+// Returns false if the file does not compile
+static bool compile(const std::string &filename, bool alias_metadata,
+        LoopCounts &counts)
+{
+    std::string input;
+    if (!LCompilers::read_file(filename, input)) {
+        std::cerr << "Cannot read " << filename << std::endl;
+        return false;
+    }
+    LCompilers::CompilerOptions co;
+    co.po.fast = true;
+    co.po.runtime_library_dir = LCompilers::LFortran::get_runtime_library_dir();
+    co.no_alias_metadata = !alias_metadata;
+    LCompilers::FortranEvaluator fe(co);
+    LCompilers::PassManager lpm;
+    LCompilers::LocationManager lm;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = filename;
+        lm.files.push_back(fl);
+        lm.file_ends.push_back(input.size());
+    }
+    LCompilers::diag::Diagnostics diagnostics;
+    LCompilers::Result<std::unique_ptr<LCompilers::LLVMModule>> res
+        = fe.get_llvm2(input, lm, lpm, diagnostics);
+    if (!res.ok) return false;
+    count_loops(*res.result->m_m, counts);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: vectorization FILE..." << std::endl;
+        return 1;
+    }
+    int dirname_length;
+    LCompilers::LFortran::get_executable_path(
+        LCompilers::binary_executable_path, dirname_length);
+    LCompilers::LFortran::set_exec_path_and_mode(
+        LCompilers::binary_executable_path, dirname_length);
+
+    LoopCounts before, after;
+    size_t files = 0, improved = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 1; i < argc; i++) {
+        LoopCounts b, a;
+        if (!compile(argv[i], false, b) || !compile(argv[i], true, a)) {
+            std::cerr << "Skipping " << argv[i] << std::endl;
+            continue;
+        }
+        if (a.loops == 0 && b.loops == 0) continue;
+        files++;
+        if (a.vectorized > b.vectorized) {
+            improved++;
+            std::cout << argv[i] << ": " << b.vectorized << " -> "
+                << a.vectorized << " of " << a.loops << " loops" << std::endl;
+        }
+        before.loops += b.loops; before.vectorized += b.vectorized;
+        after.loops += a.loops; after.vectorized += a.vectorized;
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    auto rate = [](const LoopCounts &c) {
+        return c.loops ? 100.0 * c.vectorized / c.loops : 0.0;
+    };
+    std::cout << "Files with loops: " << files << ", vectorized more: "
+        << improved << std::endl;
+    std::cout << "--no-alias-metadata: " << before.vectorized << " of "
+        << before.loops << " innermost loops vectorized (" << rate(before)
+        << "%)" << std::endl;
+    std::cout << "alias metadata:      " << after.vectorized << " of "
+        << after.loops << " innermost loops vectorized (" << rate(after)
+        << "%)" << std::endl;
+    std::cout << "Time: " << std::chrono::duration_cast<
+        std::chrono::milliseconds>(t2 - t1).count() << "ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+/*
+ * Formats N (10^6 by default) reals, spread over 24 orders of magnitude, with
+ * each of the edit descriptors below and with list-directed output, the way
+ * `write(s, fmt) x` with a constant `fmt` does, and reports the time per
+ * real.
+ *
+ * Usage: write_reals [N]
+ */
+int main(int argc, char *argv[])
+{
+    int64_t N = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    std::mt19937_64 rng(20240101);
+    std::uniform_real_distribution<double> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(-12, 12);
+    std::vector<double> x(N);
+    for (int64_t i = 0; i < N; i++) {
+        x[i] = mantissa(rng) * std::pow(10.0, exponent(rng));
+    }
+
+    const char *formats[] = {
+        "(F30.6)", "(F12.3)", "(E24.15)", "(ES16.7)", "(EN16.6)", "(D24.15E3)",
+        "(1P,E15.6)", nullptr
+    };
+    std::size_t checksum = 0;
+    for (const char *format : formats) {
+        void *cache = nullptr;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int64_t i = 0; i < N; i++) {
+            char *s = _lcompilers_string_format_fortran_cached(&cache, format,
+                "R8", 0, 0, &x[i]);
+            checksum += s[0];
+            std::free(s);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t2 - t1).count();
+        std::cout << (format ? format : "*") << ": " << ns / N
+            << "ns per real" << std::endl;
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+    return 0;
+}
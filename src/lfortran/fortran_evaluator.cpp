@@ -1,3 +1,4 @@
+#include <chrono>
 #include <fstream>
 
 #include <lfortran/fortran_evaluator.h>
@@ -43,7 +44,7 @@ FortranEvaluator::FortranEvaluator(CompilerOptions& compiler_options)
     compiler_options{compiler_options},
     al{1024*1024},
 #ifdef HAVE_LFORTRAN_LLVM
-    e{std::make_unique<LLVMEvaluator>()},
+    e{std::make_unique<LLVMEvaluator>(compiler_options)},
     eval_count{0},
 #endif
     symbol_table{nullptr}
@@ -80,6 +81,7 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
 {
 #ifdef HAVE_LFORTRAN_LLVM
     EvalResult result;
+    auto t1 = std::chrono::high_resolution_clock::now();
 
     // Src -> AST
     Result<LFortran::AST::TranslationUnit_t*> res = get_ast2(
@@ -128,7 +130,16 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
     std::string return_type = m->get_return_type(run_fn);
 
     // LLVM -> Machine code -> Execution
-    e->add_module(std::move(m));
+    if (compiler_options.jit_tiered) {
+        e->add_module_tiered(std::move(m), run_fn);
+    } else {
+        e->add_module(std::move(m));
+    }
+    if (return_type != "none") {
+        // The JIT compiles the module on the first lookup
+        e->get_symbol_address(run_fn);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
     if (return_type == "integer4") {
         int32_t r = e->execfn<int32_t>(run_fn);
         result.type = EvalResult::integer4;
@@ -167,12 +178,41 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
     } else {
         throw LCompilersException("FortranEvaluator::evaluate(): Return type not supported");
     }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    if (compiler_options.jit_tiered) {
+        e->end_cell(compiler_options.jit_hot_calls);
+    }
+    result.compile_time = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    result.run_time = std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count();
+    result.jit_memory = e->get_jit_stats().memory;
     return result;
 #else
     throw LCompilersException("LLVM is not enabled");
 #endif
 }
 
+FortranEvaluator::JITStats FortranEvaluator::get_jit_stats()
+{
+    JITStats stats;
+#ifdef HAVE_LFORTRAN_LLVM
+    LLVMEvaluator::JITStats s = e->get_jit_stats();
+    stats.memory = s.memory;
+    stats.modules = s.modules;
+    stats.released = s.released;
+    stats.promoted = s.promoted;
+#endif
+    return stats;
+}
+
+std::vector<std::pair<std::string, int64_t>> FortranEvaluator::get_function_opt_times()
+{
+#ifdef HAVE_LFORTRAN_LLVM
+    return e->get_function_opt_times();
+#else
+    return {};
+#endif
+}
+
 Result<std::string> FortranEvaluator::get_ast(const std::string &code,
     LocationManager &lm, diag::Diagnostics &diagnostics)
 {
@@ -192,24 +232,21 @@ Result<std::string> FortranEvaluator::get_ast(const std::string &code,
     }
 }
 
-Result<LFortran::AST::TranslationUnit_t*> FortranEvaluator::get_ast2(
+Result<std::string> FortranEvaluator::get_preprocessed(
             const std::string &code_orig, LocationManager &lm,
             diag::Diagnostics &diagnostics)
 {
-    // Src -> AST
-    const std::string *code=&code_orig;
-    std::string tmp;
+    std::string code = code_orig;
     if (compiler_options.c_preprocessor) {
         // Preprocessor
         LFortran::CPreprocessor cpp(compiler_options);
         Result<std::string> res = cpp.run(code_orig, lm, cpp.macro_definitions, diagnostics);
         if (res.ok) {
-            tmp = res.result;
+            code = res.result;
         } else {
             LCOMPILERS_ASSERT(diagnostics.has_error())
             return res.error;
         }
-        code = &tmp;
     }
     if (compiler_options.prescan || compiler_options.fixed_form) {
         std::vector<std::filesystem::path> include_dirs;
@@ -217,11 +254,23 @@ Result<LFortran::AST::TranslationUnit_t*> FortranEvaluator::get_ast2(
         include_dirs.insert(include_dirs.end(),
                             compiler_options.po.include_dirs.begin(),
                             compiler_options.po.include_dirs.end());
-        tmp = LFortran::prescan(*code, lm, compiler_options.fixed_form, include_dirs);
-        code = &tmp;
+        code = LFortran::prescan(code, lm, compiler_options.fixed_form, include_dirs);
+    }
+    return code;
+}
+
+Result<LFortran::AST::TranslationUnit_t*> FortranEvaluator::get_ast2(
+            const std::string &code_orig, LocationManager &lm,
+            diag::Diagnostics &diagnostics)
+{
+    // Src -> AST
+    Result<std::string> code = get_preprocessed(code_orig, lm, diagnostics);
+    if (!code.ok) {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return code.error;
     }
     Result<LFortran::AST::TranslationUnit_t*>
-        res = LFortran::parse(al, *code, diagnostics, compiler_options);
+        res = LFortran::parse(al, code.result, diagnostics, compiler_options);
     if (res.ok) {
         return res.result;
     } else {
@@ -349,8 +398,8 @@ Result<std::unique_ptr<LLVMModule>> FortranEvaluator::get_llvm2(
 }
 
 /*
-    time_opt: keeps track of time taken by using `--fast` flag
-        i.e. time taken by optimizations, and used when
+    time_opt: keeps track of time taken by the LLVM optimizations of `-O`
+        or the `--fast` flag, and used when
         `--time-report` flag is used
 */
 Result<std::unique_ptr<LLVMModule>> FortranEvaluator::get_llvm3(
@@ -398,7 +447,12 @@ Result<std::unique_ptr<LLVMModule>> FortranEvaluator::get_llvm3(
         return res.error;
     }
 
-    if (compiler_options.po.fast) {
+    // The tiered JIT optimizes the procedures that turn out to be hot
+    // An explicit `-O` level takes precedence over `--fast`
+    int opt_level = compiler_options.opt_level >= 0 ? compiler_options.opt_level
+        : (compiler_options.po.fast ? 3 : 0);
+    if ((opt_level > 0 || compiler_options.thin_lto_prelink)
+            && !compiler_options.jit_tiered) {
         auto t1 = std::chrono::high_resolution_clock::now();
         e->opt(*m->m_m);
         auto t2 = std::chrono::high_resolution_clock::now();
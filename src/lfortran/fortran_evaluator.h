@@ -55,6 +55,18 @@ public:
         std::string ast;
         std::string asr;
         std::string llvm_ir;
+        // Microseconds spent compiling the input to machine code and
+        // running it, and the bytes of code and data held by the JIT after
+        int64_t compile_time = 0;
+        int64_t run_time = 0;
+        size_t jit_memory = 0;
+    };
+
+    struct JITStats {
+        size_t memory = 0;
+        size_t modules = 0;
+        size_t released = 0;
+        size_t promoted = 0;
     };
 
     // Evaluates `code`.
@@ -64,6 +76,9 @@ public:
         diag::Diagnostics &diagnostics);
     Result<EvalResult> evaluate2(const std::string &code);
 
+    // Runs the C preprocessor (if enabled) and the prescanner
+    Result<std::string> get_preprocessed(const std::string &code,
+        LocationManager &lm, diag::Diagnostics &diagnostics);
     Result<std::string> get_ast(const std::string &code,
         LocationManager &lm, diag::Diagnostics &diagnostics);
     Result<LCompilers::LFortran::AST::TranslationUnit_t*> get_ast2(
@@ -115,6 +130,11 @@ public:
     Result<std::string> get_fmt(const std::string &code, LocationManager &lm,
         diag::Diagnostics &diagnostics);
     Allocator &get_al() { return al; };
+    // Statistics of the `jit_tiered` mode
+    JITStats get_jit_stats();
+    // Microseconds the last LLVM optimization spent on each function, the
+    // slowest first (empty without `--time-report`)
+    std::vector<std::pair<std::string, int64_t>> get_function_opt_times();
 
 private:
     Allocator al;
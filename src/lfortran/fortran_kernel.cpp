@@ -76,9 +76,21 @@ namespace LCompilers::LFortran {
         CompilerOptions compiler_options;
         FortranEvaluator e;
 
+        struct CellStats {
+            int execution_counter;
+            int64_t compile_time;   // us
+            int64_t run_time;       // us
+            size_t jit_memory;      // bytes
+        };
+        std::vector<CellStats> cell_stats;
+
+        std::string format_jit_stats();
+
     public:
         custom_interpreter() : compiler_options{}, e{compiler_options} {
             e.compiler_options.interactive = true;
+            // A kernel lives long, keep its JIT memory bounded
+            e.compiler_options.jit_tiered = true;
         }
         virtual ~custom_interpreter() = default;
 
@@ -109,6 +121,24 @@ namespace LCompilers::LFortran {
     };
 
     
+    std::string custom_interpreter::format_jit_stats()
+    {
+        FortranEvaluator::JITStats stats = e.get_jit_stats();
+        std::string out;
+        out += "JIT memory (bytes): " + std::to_string(stats.memory) + "\n";
+        out += "Loaded modules: " + std::to_string(stats.modules) + "\n";
+        out += "Unloaded modules: " + std::to_string(stats.released) + "\n";
+        out += "Modules recompiled at O3: " + std::to_string(stats.promoted) + "\n";
+        out += "\nCell    Compile (ms)    Run (ms)    JIT memory (bytes)\n";
+        for (auto &c : cell_stats) {
+            out += "[" + std::to_string(c.execution_counter) + "]    "
+                + std::to_string(c.compile_time / 1000.0) + "    "
+                + std::to_string(c.run_time / 1000.0) + "    "
+                + std::to_string(c.jit_memory) + "\n";
+        }
+        return out;
+    }
+
     void custom_interpreter::execute_request_impl(send_reply_callback cb,
                                                   int execution_counter, // Typically the cell number
                                                   const std::string& code, // Code to execute
@@ -120,6 +150,15 @@ namespace LCompilers::LFortran {
         std::string code0;
         CompilerOptions cu;
         try {
+            if (startswith(code, "%%jitstats")) {
+                publish_stream("stdout", format_jit_stats());
+                nl::json result;
+                result["status"] = "ok";
+                result["payload"] = nl::json::array();
+                result["user_expressions"] = nl::json::object();
+                cb(result);
+                return;
+            }
             if (startswith(code, "%%showast")) {
                 code0 = code.substr(code.find("\n")+1);
                 LocationManager lm;
@@ -348,41 +387,48 @@ namespace LCompilers::LFortran {
             publish_stream("stdout", std_out);
         }
 
+        cell_stats.push_back({execution_counter, r.compile_time, r.run_time,
+            r.jit_memory});
+        nl::json metadata;
+        metadata["lfortran"]["compile_time_ms"] = r.compile_time / 1000.0;
+        metadata["lfortran"]["run_time_ms"] = r.run_time / 1000.0;
+        metadata["lfortran"]["jit_memory_bytes"] = r.jit_memory;
+
         switch (r.type) {
             case (LCompilers::FortranEvaluator::EvalResult::integer4) : {
                 nl::json pub_data;
                 pub_data["text/plain"] = std::to_string(r.i32);
-                publish_execution_result(execution_counter, std::move(pub_data), nl::json::object());
+                publish_execution_result(execution_counter, std::move(pub_data), metadata);
                 break;
             }
             case (LCompilers::FortranEvaluator::EvalResult::integer8) : {
                 nl::json pub_data;
                 pub_data["text/plain"] = std::to_string(r.i64);
-                publish_execution_result(execution_counter, std::move(pub_data), nl::json::object());
+                publish_execution_result(execution_counter, std::move(pub_data), metadata);
                 break;
             }
             case (LCompilers::FortranEvaluator::EvalResult::real4) : {
                 nl::json pub_data;
                 pub_data["text/plain"] = std::to_string(r.f32);
-                publish_execution_result(execution_counter, std::move(pub_data), nl::json::object());
+                publish_execution_result(execution_counter, std::move(pub_data), metadata);
                 break;
             }
             case (LCompilers::FortranEvaluator::EvalResult::real8) : {
                 nl::json pub_data;
                 pub_data["text/plain"] = std::to_string(r.f64);
-                publish_execution_result(execution_counter, std::move(pub_data), nl::json::object());
+                publish_execution_result(execution_counter, std::move(pub_data), metadata);
                 break;
             }
             case (LCompilers::FortranEvaluator::EvalResult::complex4) : {
                 nl::json pub_data;
                 pub_data["text/plain"] = "(" + std::to_string(r.c32.re) + ", " + std::to_string(r.c32.im) + ")";
-                publish_execution_result(execution_counter, std::move(pub_data), nl::json::object());
+                publish_execution_result(execution_counter, std::move(pub_data), metadata);
                 break;
             }
             case (LCompilers::FortranEvaluator::EvalResult::complex8) : {
                 nl::json pub_data;
                 pub_data["text/plain"] = "(" + std::to_string(r.c64.re) + ", " + std::to_string(r.c64.im) + ")";
-                publish_execution_result(execution_counter, std::move(pub_data), nl::json::object());
+                publish_execution_result(execution_counter, std::move(pub_data), metadata);
                 break;
             }
             case (LCompilers::FortranEvaluator::EvalResult::statement) : {
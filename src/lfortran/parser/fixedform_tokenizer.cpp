@@ -1124,6 +1124,12 @@ struct FixedFormRecursiveDescent {
             return true;
         }
 
+        if (next_is(cur, "wait(")) {
+            push_token_advance(cur, "wait");
+            tokenize_line(cur);
+            return true;
+        }
+
         if (next_is(cur, "allocate")) {
             push_token_advance(cur, "allocate");
             tokenize_line(cur);
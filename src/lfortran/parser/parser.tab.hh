@@ -0,0 +1,334 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Skeleton interface for Bison GLR parsers in C
+
+   Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+#ifndef YY_YY_PARSER_TAB_HH_INCLUDED
+# define YY_YY_PARSER_TAB_HH_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 25 "parser.yy"
+
+#include <lfortran/parser/parser.h>
+
+#line 48 "parser.tab.hh"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    END_OF_FILE = 0,               /* END_OF_FILE  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TK_NEWLINE = 258,              /* TK_NEWLINE  */
+    TK_NAME = 259,                 /* TK_NAME  */
+    TK_DEF_OP = 260,               /* TK_DEF_OP  */
+    TK_INTEGER = 261,              /* TK_INTEGER  */
+    TK_LABEL = 262,                /* TK_LABEL  */
+    TK_REAL = 263,                 /* TK_REAL  */
+    TK_BOZ_CONSTANT = 264,         /* TK_BOZ_CONSTANT  */
+    TK_PLUS = 265,                 /* "+"  */
+    TK_MINUS = 266,                /* "-"  */
+    TK_STAR = 267,                 /* "*"  */
+    TK_SLASH = 268,                /* "/"  */
+    TK_COLON = 269,                /* ":"  */
+    TK_SEMICOLON = 270,            /* ";"  */
+    TK_COMMA = 271,                /* ","  */
+    TK_EQUAL = 272,                /* "="  */
+    TK_LPAREN = 273,               /* "("  */
+    TK_RPAREN = 274,               /* ")"  */
+    TK_LBRACKET = 275,             /* "["  */
+    TK_RBRACKET = 276,             /* "]"  */
+    TK_LBRACE = 277,               /* "{"  */
+    TK_RBRACE = 278,               /* "}"  */
+    TK_RBRACKET_OLD = 279,         /* "/)"  */
+    TK_PERCENT = 280,              /* "%"  */
+    TK_VBAR = 281,                 /* "|"  */
+    TK_STRING = 282,               /* TK_STRING  */
+    TK_COMMENT = 283,              /* TK_COMMENT  */
+    TK_EOLCOMMENT = 284,           /* TK_EOLCOMMENT  */
+    TK_PRAGMA_DECL = 285,          /* TK_PRAGMA_DECL  */
+    TK_OMP = 286,                  /* TK_OMP  */
+    TK_OMP_END = 287,              /* TK_OMP_END  */
+    TK_DBL_DOT = 288,              /* ".."  */
+    TK_DBL_COLON = 289,            /* "::"  */
+    TK_POW = 290,                  /* "**"  */
+    TK_CONCAT = 291,               /* "//"  */
+    TK_ARROW = 292,                /* "=>"  */
+    TK_EQ = 293,                   /* "=="  */
+    TK_NE = 294,                   /* "/="  */
+    TK_LT = 295,                   /* "<"  */
+    TK_LE = 296,                   /* "<="  */
+    TK_GT = 297,                   /* ">"  */
+    TK_GE = 298,                   /* ">="  */
+    TK_NOT = 299,                  /* ".not."  */
+    TK_AND = 300,                  /* ".and."  */
+    TK_OR = 301,                   /* ".or."  */
+    TK_XOR = 302,                  /* ".xor."  */
+    TK_EQV = 303,                  /* ".eqv."  */
+    TK_NEQV = 304,                 /* ".neqv."  */
+    TK_TRUE = 305,                 /* ".true."  */
+    TK_FALSE = 306,                /* ".false."  */
+    TK_FORMAT = 307,               /* TK_FORMAT  */
+    KW_ABSTRACT = 308,             /* KW_ABSTRACT  */
+    KW_ALL = 309,                  /* KW_ALL  */
+    KW_ALLOCATABLE = 310,          /* KW_ALLOCATABLE  */
+    KW_ALLOCATE = 311,             /* KW_ALLOCATE  */
+    KW_ASSIGN = 312,               /* KW_ASSIGN  */
+    KW_ASSIGNMENT = 313,           /* KW_ASSIGNMENT  */
+    KW_ASSOCIATE = 314,            /* KW_ASSOCIATE  */
+    KW_ASYNCHRONOUS = 315,         /* KW_ASYNCHRONOUS  */
+    KW_BACKSPACE = 316,            /* KW_BACKSPACE  */
+    KW_BIND = 317,                 /* KW_BIND  */
+    KW_BLOCK = 318,                /* KW_BLOCK  */
+    KW_CALL = 319,                 /* KW_CALL  */
+    KW_CASE = 320,                 /* KW_CASE  */
+    KW_CHANGE = 321,               /* KW_CHANGE  */
+    KW_CHANGE_TEAM = 322,          /* KW_CHANGE_TEAM  */
+    KW_CHARACTER = 323,            /* KW_CHARACTER  */
+    KW_CLASS = 324,                /* KW_CLASS  */
+    KW_CLOSE = 325,                /* KW_CLOSE  */
+    KW_CODIMENSION = 326,          /* KW_CODIMENSION  */
+    KW_COMMON = 327,               /* KW_COMMON  */
+    KW_COMPLEX = 328,              /* KW_COMPLEX  */
+    KW_CONCURRENT = 329,           /* KW_CONCURRENT  */
+    KW_CONTAINS = 330,             /* KW_CONTAINS  */
+    KW_CONTIGUOUS = 331,           /* KW_CONTIGUOUS  */
+    KW_CONTINUE = 332,             /* KW_CONTINUE  */
+    KW_CRITICAL = 333,             /* KW_CRITICAL  */
+    KW_CYCLE = 334,                /* KW_CYCLE  */
+    KW_DATA = 335,                 /* KW_DATA  */
+    KW_DEALLOCATE = 336,           /* KW_DEALLOCATE  */
+    KW_DEFAULT = 337,              /* KW_DEFAULT  */
+    KW_DEFERRED = 338,             /* KW_DEFERRED  */
+    KW_DIMENSION = 339,            /* KW_DIMENSION  */
+    KW_DO = 340,                   /* KW_DO  */
+    KW_DOWHILE = 341,              /* KW_DOWHILE  */
+    KW_DOUBLE = 342,               /* KW_DOUBLE  */
+    KW_DOUBLE_PRECISION = 343,     /* KW_DOUBLE_PRECISION  */
+    KW_DOUBLE_COMPLEX = 344,       /* KW_DOUBLE_COMPLEX  */
+    KW_ELEMENTAL = 345,            /* KW_ELEMENTAL  */
+    KW_ELSE = 346,                 /* KW_ELSE  */
+    KW_ELSEIF = 347,               /* KW_ELSEIF  */
+    KW_ELSEWHERE = 348,            /* KW_ELSEWHERE  */
+    KW_END = 349,                  /* KW_END  */
+    KW_END_PROGRAM = 350,          /* KW_END_PROGRAM  */
+    KW_ENDPROGRAM = 351,           /* KW_ENDPROGRAM  */
+    KW_END_MODULE = 352,           /* KW_END_MODULE  */
+    KW_ENDMODULE = 353,            /* KW_ENDMODULE  */
+    KW_END_SUBMODULE = 354,        /* KW_END_SUBMODULE  */
+    KW_ENDSUBMODULE = 355,         /* KW_ENDSUBMODULE  */
+    KW_END_BLOCK = 356,            /* KW_END_BLOCK  */
+    KW_ENDBLOCK = 357,             /* KW_ENDBLOCK  */
+    KW_END_BLOCK_DATA = 358,       /* KW_END_BLOCK_DATA  */
+    KW_ENDBLOCKDATA = 359,         /* KW_ENDBLOCKDATA  */
+    KW_END_SUBROUTINE = 360,       /* KW_END_SUBROUTINE  */
+    KW_ENDSUBROUTINE = 361,        /* KW_ENDSUBROUTINE  */
+    KW_END_FUNCTION = 362,         /* KW_END_FUNCTION  */
+    KW_ENDFUNCTION = 363,          /* KW_ENDFUNCTION  */
+    KW_END_PROCEDURE = 364,        /* KW_END_PROCEDURE  */
+    KW_ENDPROCEDURE = 365,         /* KW_ENDPROCEDURE  */
+    KW_END_ENUM = 366,             /* KW_END_ENUM  */
+    KW_ENDENUM = 367,              /* KW_ENDENUM  */
+    KW_END_SELECT = 368,           /* KW_END_SELECT  */
+    KW_ENDSELECT = 369,            /* KW_ENDSELECT  */
+    KW_END_IF = 370,               /* KW_END_IF  */
+    KW_ENDIF = 371,                /* KW_ENDIF  */
+    KW_END_INTERFACE = 372,        /* KW_END_INTERFACE  */
+    KW_ENDINTERFACE = 373,         /* KW_ENDINTERFACE  */
+    KW_END_TYPE = 374,             /* KW_END_TYPE  */
+    KW_ENDTYPE = 375,              /* KW_ENDTYPE  */
+    KW_END_ASSOCIATE = 376,        /* KW_END_ASSOCIATE  */
+    KW_ENDASSOCIATE = 377,         /* KW_ENDASSOCIATE  */
+    KW_END_FORALL = 378,           /* KW_END_FORALL  */
+    KW_ENDFORALL = 379,            /* KW_ENDFORALL  */
+    KW_END_DO = 380,               /* KW_END_DO  */
+    KW_ENDDO = 381,                /* KW_ENDDO  */
+    KW_END_WHERE = 382,            /* KW_END_WHERE  */
+    KW_ENDWHERE = 383,             /* KW_ENDWHERE  */
+    KW_END_CRITICAL = 384,         /* KW_END_CRITICAL  */
+    KW_ENDCRITICAL = 385,          /* KW_ENDCRITICAL  */
+    KW_END_FILE = 386,             /* KW_END_FILE  */
+    KW_ENDFILE = 387,              /* KW_ENDFILE  */
+    KW_END_TEAM = 388,             /* KW_END_TEAM  */
+    KW_ENDTEAM = 389,              /* KW_ENDTEAM  */
+    KW_ENTRY = 390,                /* KW_ENTRY  */
+    KW_ENUM = 391,                 /* KW_ENUM  */
+    KW_ENUMERATOR = 392,           /* KW_ENUMERATOR  */
+    KW_EQUIVALENCE = 393,          /* KW_EQUIVALENCE  */
+    KW_ERRMSG = 394,               /* KW_ERRMSG  */
+    KW_ERROR = 395,                /* KW_ERROR  */
+    KW_EVENT = 396,                /* KW_EVENT  */
+    KW_EXIT = 397,                 /* KW_EXIT  */
+    KW_EXTENDS = 398,              /* KW_EXTENDS  */
+    KW_EXTERNAL = 399,             /* KW_EXTERNAL  */
+    KW_FILE = 400,                 /* KW_FILE  */
+    KW_FINAL = 401,                /* KW_FINAL  */
+    KW_FLUSH = 402,                /* KW_FLUSH  */
+    KW_FORALL = 403,               /* KW_FORALL  */
+    KW_FORMATTED = 404,            /* KW_FORMATTED  */
+    KW_FORM = 405,                 /* KW_FORM  */
+    KW_FORM_TEAM = 406,            /* KW_FORM_TEAM  */
+    KW_FUNCTION = 407,             /* KW_FUNCTION  */
+    KW_GENERIC = 408,              /* KW_GENERIC  */
+    KW_GO = 409,                   /* KW_GO  */
+    KW_GOTO = 410,                 /* KW_GOTO  */
+    KW_IF = 411,                   /* KW_IF  */
+    KW_IMAGES = 412,               /* KW_IMAGES  */
+    KW_IMPLICIT = 413,             /* KW_IMPLICIT  */
+    KW_IMPORT = 414,               /* KW_IMPORT  */
+    KW_IMPURE = 415,               /* KW_IMPURE  */
+    KW_IN = 416,                   /* KW_IN  */
+    KW_INCLUDE = 417,              /* KW_INCLUDE  */
+    KW_INOUT = 418,                /* KW_INOUT  */
+    KW_IN_OUT = 419,               /* KW_IN_OUT  */
+    KW_INQUIRE = 420,              /* KW_INQUIRE  */
+    KW_INSTANTIATE = 421,          /* KW_INSTANTIATE  */
+    KW_INTEGER = 422,              /* KW_INTEGER  */
+    KW_INTENT = 423,               /* KW_INTENT  */
+    KW_INTERFACE = 424,            /* KW_INTERFACE  */
+    KW_INTRINSIC = 425,            /* KW_INTRINSIC  */
+    KW_IS = 426,                   /* KW_IS  */
+    KW_KIND = 427,                 /* KW_KIND  */
+    KW_LEN = 428,                  /* KW_LEN  */
+    KW_LOCAL = 429,                /* KW_LOCAL  */
+    KW_LOCAL_INIT = 430,           /* KW_LOCAL_INIT  */
+    KW_LOGICAL = 431,              /* KW_LOGICAL  */
+    KW_MEMORY = 432,               /* KW_MEMORY  */
+    KW_MODULE = 433,               /* KW_MODULE  */
+    KW_MOLD = 434,                 /* KW_MOLD  */
+    KW_NAME = 435,                 /* KW_NAME  */
+    KW_NAMELIST = 436,             /* KW_NAMELIST  */
+    KW_NEW_INDEX = 437,            /* KW_NEW_INDEX  */
+    KW_NOPASS = 438,               /* KW_NOPASS  */
+    KW_NON_INTRINSIC = 439,        /* KW_NON_INTRINSIC  */
+    KW_NON_OVERRIDABLE = 440,      /* KW_NON_OVERRIDABLE  */
+    KW_NON_RECURSIVE = 441,        /* KW_NON_RECURSIVE  */
+    KW_NONE = 442,                 /* KW_NONE  */
+    KW_NULLIFY = 443,              /* KW_NULLIFY  */
+    KW_ONLY = 444,                 /* KW_ONLY  */
+    KW_OPEN = 445,                 /* KW_OPEN  */
+    KW_OPERATOR = 446,             /* KW_OPERATOR  */
+    KW_OPTIONAL = 447,             /* KW_OPTIONAL  */
+    KW_OUT = 448,                  /* KW_OUT  */
+    KW_PARAMETER = 449,            /* KW_PARAMETER  */
+    KW_PASS = 450,                 /* KW_PASS  */
+    KW_POINTER = 451,              /* KW_POINTER  */
+    KW_POST = 452,                 /* KW_POST  */
+    KW_PRECISION = 453,            /* KW_PRECISION  */
+    KW_PRINT = 454,                /* KW_PRINT  */
+    KW_PRIVATE = 455,              /* KW_PRIVATE  */
+    KW_PROCEDURE = 456,            /* KW_PROCEDURE  */
+    KW_PROGRAM = 457,              /* KW_PROGRAM  */
+    KW_PROTECTED = 458,            /* KW_PROTECTED  */
+    KW_PUBLIC = 459,               /* KW_PUBLIC  */
+    KW_PURE = 460,                 /* KW_PURE  */
+    KW_QUIET = 461,                /* KW_QUIET  */
+    KW_RANK = 462,                 /* KW_RANK  */
+    KW_READ = 463,                 /* KW_READ  */
+    KW_REAL = 464,                 /* KW_REAL  */
+    KW_RECURSIVE = 465,            /* KW_RECURSIVE  */
+    KW_REDUCE = 466,               /* KW_REDUCE  */
+    KW_RESULT = 467,               /* KW_RESULT  */
+    KW_RETURN = 468,               /* KW_RETURN  */
+    KW_REWIND = 469,               /* KW_REWIND  */
+    KW_SAVE = 470,                 /* KW_SAVE  */
+    KW_SELECT = 471,               /* KW_SELECT  */
+    KW_SELECT_CASE = 472,          /* KW_SELECT_CASE  */
+    KW_SELECT_RANK = 473,          /* KW_SELECT_RANK  */
+    KW_SELECT_TYPE = 474,          /* KW_SELECT_TYPE  */
+    KW_SEQUENCE = 475,             /* KW_SEQUENCE  */
+    KW_SHARED = 476,               /* KW_SHARED  */
+    KW_SOURCE = 477,               /* KW_SOURCE  */
+    KW_STAT = 478,                 /* KW_STAT  */
+    KW_STOP = 479,                 /* KW_STOP  */
+    KW_SUBMODULE = 480,            /* KW_SUBMODULE  */
+    KW_SUBROUTINE = 481,           /* KW_SUBROUTINE  */
+    KW_SYNC = 482,                 /* KW_SYNC  */
+    KW_SYNC_ALL = 483,             /* KW_SYNC_ALL  */
+    KW_SYNC_IMAGES = 484,          /* KW_SYNC_IMAGES  */
+    KW_SYNC_MEMORY = 485,          /* KW_SYNC_MEMORY  */
+    KW_SYNC_TEAM = 486,            /* KW_SYNC_TEAM  */
+    KW_TARGET = 487,               /* KW_TARGET  */
+    KW_TEAM = 488,                 /* KW_TEAM  */
+    KW_TEAM_NUMBER = 489,          /* KW_TEAM_NUMBER  */
+    KW_REQUIREMENT = 490,          /* KW_REQUIREMENT  */
+    KW_REQUIRE = 491,              /* KW_REQUIRE  */
+    KW_TEMPLATE = 492,             /* KW_TEMPLATE  */
+    KW_THEN = 493,                 /* KW_THEN  */
+    KW_TO = 494,                   /* KW_TO  */
+    KW_TYPE = 495,                 /* KW_TYPE  */
+    KW_UNFORMATTED = 496,          /* KW_UNFORMATTED  */
+    KW_USE = 497,                  /* KW_USE  */
+    KW_VALUE = 498,                /* KW_VALUE  */
+    KW_VOLATILE = 499,             /* KW_VOLATILE  */
+    KW_WAIT = 500,                 /* KW_WAIT  */
+    KW_WHERE = 501,                /* KW_WHERE  */
+    KW_WHILE = 502,                /* KW_WHILE  */
+    KW_WRITE = 503,                /* KW_WRITE  */
+    UMINUS = 504                   /* UMINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+typedef LCompilers::LFortran::YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+int yyparse (LCompilers::LFortran::Parser &p);
+
+#endif /* !YY_YY_PARSER_TAB_HH_INCLUDED  */
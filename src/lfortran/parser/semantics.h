@@ -841,10 +841,10 @@ static inline char** REDUCE_ARGS(Allocator &al, const Vec<ast_t*> args)
 static inline reduce_opType convert_id_to_reduce_type(
         const Location &loc, const ast_t *id, LCompilers::diag::Diagnostics &diagnostics)
 {
-    std::string s_id = down_cast2<Name_t>(id)->m_id;
-    if (s_id == "MIN" ) {
+    std::string s_id = LCompilers::to_lower(down_cast2<Name_t>(id)->m_id);
+    if (s_id == "min" ) {
         return reduce_opType::ReduceMIN;
-    } else if (s_id == "MAX") {
+    } else if (s_id == "max") {
         return reduce_opType::ReduceMAX;
     } else {
         diagnostics.add(LCompilers::diag::Diagnostic(
@@ -1249,6 +1249,7 @@ ast_t* builtin3(Allocator &al,
 #define NULLIFY(args0, l) builtin1(p.m_a, args0, l, make_Nullify_t)
 #define BACKSPACE(args0, l) builtin1(p.m_a, args0, l, make_Backspace_t)
 #define FLUSH(args0, l) builtin1(p.m_a, args0, l, make_Flush_t)
+#define WAIT(args0, l) builtin1(p.m_a, args0, l, make_Wait_t)
 #define ENDFILE(args0, l) builtin1(p.m_a, args0, l, make_Endfile_t)
 
 #define INCLUDE(arg, l) make_Include_t(p.m_a, l, 0, arg.c_str(p.m_a), nullptr)
@@ -2699,6 +2700,7 @@ void set_m_trivia(stmt_t *s, trivia_t *trivia) {
         TRIVIA_SET(SyncImages)
         TRIVIA_SET(SyncMemory)
         TRIVIA_SET(SyncTeam)
+        TRIVIA_SET(Wait)
         TRIVIA_SET(Write)
         TRIVIA_SET(AssociateBlock)
         TRIVIA_SET(Block)
@@ -476,6 +476,32 @@ public:
                 if(ASRUtils::is_descriptorString(ASRUtils::expr_type(a_iomsg))) {
                     a_iomsg = ASRUtils::cast_string_descriptor_to_pointer(al, a_iomsg);
                 }
+            } else if( m_arg_str == std::string("asynchronous") ) {
+                // Only permits asynchronous transfers on the unit, each
+                // WRITE then decides with its own ASYNCHRONOUS= specifier
+                this->visit_expr(*kwarg.m_value);
+                ASR::expr_t* async_expr = ASRUtils::EXPR(tmp);
+                if (!ASRUtils::is_character(*ASRUtils::expr_type(async_expr))) {
+                    diag.add(Diagnostic(
+                        "`asynchronous` must be of type, String or StringPointer",
+                        Level::Error, Stage::Semantic, {
+                            Label("",{kwarg.loc})
+                        }));
+                    throw SemanticAbort();
+                }
+                if (ASR::is_a<ASR::StringConstant_t>(*async_expr)) {
+                    std::string async_val = to_lower(
+                        ASR::down_cast<ASR::StringConstant_t>(async_expr)->m_s);
+                    rtrim(async_val);
+                    if (async_val != "yes" && async_val != "no") {
+                        diag.add(Diagnostic(
+                            "ASYNCHRONOUS= specifier must have value YES or NO",
+                            Level::Error, Stage::Semantic, {
+                                Label("",{kwarg.loc})
+                            }));
+                        throw SemanticAbort();
+                    }
+                }
             } else {
                 const std::unordered_set<std::string> unsupported_args {"err", "blank", "recl", "fileopt", "action", "position", "pad"};
                 if (unsupported_args.find(m_arg_str) == unsupported_args.end()) {
@@ -772,6 +798,7 @@ public:
         ASR::stmt_t *overloaded_stmt = nullptr;
         std::string read_write = "";
         bool formatted = (n_args == 2);
+        bool is_asynchronous = false;
         Vec<ASR::expr_t*> a_values_vec;
         a_values_vec.reserve(al, n_values);
 
@@ -933,15 +960,32 @@ public:
                 }
                 this->visit_expr(*kwarg.m_value);
                 a_id = ASRUtils::EXPR(tmp);
-                ASR::ttype_t* a_status_type = ASRUtils::expr_type(a_id);
-                if (!ASR::is_a<ASR::String_t>(*ASRUtils::type_get_past_pointer(a_status_type))) {
+                ASR::ttype_t* a_id_type = ASRUtils::expr_type(a_id);
+                if (!ASRUtils::is_variable(a_id) ||
+                    !ASR::is_a<ASR::Integer_t>(*ASRUtils::type_get_past_pointer(a_id_type))) {
                         diag.add(Diagnostic(
-                            "`status` must be of type String",
+                            "`id` must be an integer variable",
                             Level::Error, Stage::Semantic, {
                                 Label("",{loc})
                             }));
                         throw SemanticAbort();
                 }
+            } else if( m_arg_str == std::string("asynchronous") ) {
+                this->visit_expr(*kwarg.m_value);
+                ASR::expr_t* async_expr = ASRUtils::EXPR(tmp);
+                std::string async_val;
+                if (ASR::is_a<ASR::StringConstant_t>(*async_expr)) {
+                    async_val = to_lower(ASR::down_cast<ASR::StringConstant_t>(async_expr)->m_s);
+                }
+                if (async_val != "yes" && async_val != "no") {
+                    diag.add(Diagnostic(
+                        "ASYNCHRONOUS= specifier must be a constant with value YES or NO",
+                        Level::Error, Stage::Semantic, {
+                            Label("",{kwarg.loc})
+                        }));
+                    throw SemanticAbort();
+                }
+                is_asynchronous = (async_val == "yes");
             } else if( m_arg_str == std::string("fmt")  ) {
                 if( a_fmt != nullptr ) {
                     diag.add(Diagnostic(
@@ -1038,6 +1082,14 @@ public:
                 }
             }
         }
+        if( a_id != nullptr && !is_asynchronous ) {
+            diag.add(Diagnostic(
+                R"""(ID= specifier requires ASYNCHRONOUS='YES')""",
+                Level::Error, Stage::Semantic, {
+                    Label("",{loc})
+                }));
+            throw SemanticAbort();
+        }
         if( a_fmt == nullptr && a_end != nullptr ) {
             diag.add(Diagnostic(
                 R"""(List directed format(*) is not allowed with a ADVANCE= specifier)""",
@@ -1279,10 +1331,11 @@ public:
             {"nextrec", 16}, {"blank", 17}, {"position", 18}, {"action", 19},
             {"read", 20}, {"write", 21}, {"readwrite", 22}, {"delim", 23},
             {"pad", 24}, {"flen", 25}, {"blocksize", 26}, {"convert", 27},
-            {"carriagecontrol", 28}, {"size", 29}, {"pos", 30}, {"iolength", 31}};
+            {"carriagecontrol", 28}, {"size", 29}, {"pos", 30}, {"iolength", 31},
+            {"id", 32}, {"pending", 33}};
         std::vector<ASR::expr_t*> args;
         std::string node_name = "Inquire";
-        fill_args_for_rewind_inquire_flush(x, 31, args, 32, argname2idx, node_name);
+        fill_args_for_rewind_inquire_flush(x, 33, args, 34, argname2idx, node_name);
         ASR::expr_t *unit = args[0], *file = args[1], *iostat = args[2], *err = args[3];
         ASR::expr_t *exist = args[4], *opened = args[5], *number = args[6], *named = args[7];
         ASR::expr_t *name = args[8], *access = args[9], *sequential = args[10], *direct = args[11];
@@ -1291,9 +1344,10 @@ public:
         ASR::expr_t *read = args[20], *write = args[21], *readwrite = args[22], *delim = args[23];
         ASR::expr_t *pad = args[24], *flen = args[25], *blocksize = args[26], *convert = args[27];
         ASR::expr_t *carriagecontrol = args[28], *size = args[29], *pos = args[30], *iolength = args[31];
+        ASR::expr_t *id = args[32], *pending = args[33];
         bool is_iolength_present = iolength != nullptr;
-        for( size_t i = 0; i < args.size() - 1; i++ ) {
-            if( is_iolength_present && args[i] ) {
+        for( size_t i = 0; i < args.size(); i++ ) {
+            if( is_iolength_present && args[i] && args[i] != iolength ) {
                 diag.add(Diagnostic(
                     "No argument should be specified when iolength is already present.",
                     Level::Error, Stage::Semantic, {
@@ -1322,7 +1376,7 @@ public:
                                   nextrec, blank, position, action,
                                   read, write, readwrite, delim,
                                   pad, flen, blocksize, convert,
-                                  carriagecontrol, size, pos, iolength);
+                                  carriagecontrol, size, pos, iolength, id, pending);
     }
 
     void visit_Flush(const AST::Flush_t& x) {
@@ -1342,6 +1396,23 @@ public:
         tmp = ASR::make_Flush_t(al, x.base.base.loc, x.m_label, unit, err, iomsg, iostat);
     }
 
+    void visit_Wait(const AST::Wait_t& x) {
+        std::map<std::string, size_t> argname2idx = {{"unit", 0}, {"id", 1}, {"iostat", 2}, {"iomsg", 3}, {"err", 4}};
+        std::vector<ASR::expr_t*> args;
+        std::string node_name = "Wait";
+        fill_args_for_rewind_inquire_flush(x, 5, args, 5, argname2idx, node_name);
+        if( !args[0] ) {
+            diag.add(Diagnostic(
+                "unit must be present in wait statement arguments",
+                Level::Error, Stage::Semantic, {
+                    Label("",{x.base.base.loc})
+                }));
+            throw SemanticAbort();
+        }
+        ASR::expr_t *unit = args[0], *id = args[1], *iostat = args[2], *iomsg = args[3], *err = args[4];
+        tmp = ASR::make_FileWait_t(al, x.base.base.loc, x.m_label, unit, id, iostat, iomsg, err);
+    }
+
     void visit_Associate(const AST::Associate_t& x) {
         this->visit_expr(*(x.m_target));
         ASR::expr_t* target = ASRUtils::EXPR(tmp);
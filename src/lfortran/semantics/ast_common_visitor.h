@@ -131,6 +131,7 @@ static inline int64_t stmt_label(AST::stmt_t *f)
         LFORTRAN_STMT_LABEL_TYPE(SyncImages)
         LFORTRAN_STMT_LABEL_TYPE(SyncMemory)
         LFORTRAN_STMT_LABEL_TYPE(SyncTeam)
+        LFORTRAN_STMT_LABEL_TYPE(Wait)
         LFORTRAN_STMT_LABEL_TYPE(Write)
         LFORTRAN_STMT_LABEL_TYPE(AssociateBlock)
         LFORTRAN_STMT_LABEL_TYPE(Block)
@@ -7593,7 +7594,7 @@ public:
                     diag::Label("", {x.base.base.loc})}));
             throw SemanticAbort();
         }
-        if( ASR::is_a<ASR::Complex_t>(*ASRUtils::expr_type(x_)) ) {
+        if( ASR::is_a<ASR::Complex_t>(*ASRUtils::extract_type(ASRUtils::expr_type(x_))) ) {
             if( y_ != nullptr ) {
                 diag.add(diag::Diagnostic(
                     "The first argument of `cmplx` intrinsic"
@@ -7603,7 +7604,7 @@ public:
                     diag::Label("", {x.base.base.loc})}));
                 throw SemanticAbort();
             }
-            if (!ASR::is_a<ASR::Var_t>(*x_)) {
+            if (ASR::is_a<ASR::ComplexConstructor_t>(*x_)) {
                 const ASR::ComplexConstructor_t* complex_expr = ASR::down_cast<ASR::ComplexConstructor_t>(x_);
                 const ASR::expr_t* real_part_expr = complex_expr->m_re;
                 const ASR::expr_t* imag_part_expr = complex_expr->m_im;
@@ -7621,10 +7622,10 @@ public:
                 }
             }
             int64_t kind_value = handle_kind(kind);
-            if (kind_value != ASRUtils::extract_kind_from_ttype_t(ASRUtils::expr_type(x_))) {
-                return ASR::make_Cast_t(al, x.base.base.loc, x_, ASR::cast_kindType::ComplexToComplex, 
-                                                            ASRUtils::TYPE(ASR::make_Complex_t(al, x.base.base.loc, kind_value)), nullptr);
-            }
+            // Elementwise for arrays
+            ImplicitCastRules::set_converted_value(al, x.base.base.loc, &x_,
+                ASRUtils::type_get_past_allocatable_pointer(ASRUtils::expr_type(x_)),
+                ASRUtils::TYPE(ASR::make_Complex_t(al, x.base.base.loc, kind_value)), diag);
             return (ASR::asr_t*) x_;
         }
         int64_t kind_value = handle_kind(kind);
@@ -2557,6 +2557,7 @@ public:
                            std::vector<std::string> symbols_already_imported_with_renaming = {}) {
         // Import all symbols from the module, e.g.:
         //     use a
+        m->m_symtab->load_all_symbols();
         for (auto &item : m->m_symtab->get_scope()) {
             if ( symbols_already_imported_with_renaming.size() > 0 &&
                  std::find(symbols_already_imported_with_renaming.begin(),
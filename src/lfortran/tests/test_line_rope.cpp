@@ -0,0 +1,129 @@
+#include <tests/doctest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <server/lsp_line_rope.h>
+
+using LCompilers::LanguageServerProtocol::LineRope;
+using LCompilers::LanguageServerProtocol::splitLines;
+
+namespace {
+
+// The position of (line, column) in `text`, computed naively
+std::size_t position(const std::string &text, std::size_t line,
+        std::size_t column) {
+    std::vector<std::string> lines = splitLines(text);
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < line; i++) offset += lines[i].length();
+    return offset + column;
+}
+
+// Checks every query of `rope` against the lines of `text`
+void check(const LineRope &rope, const std::string &text) {
+    std::vector<std::string> lines = splitLines(text);
+    CHECK(rope.str() == text);
+    CHECK(rope.length() == text.length());
+    REQUIRE(rope.numLines() == lines.size());
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        CHECK(rope.line(i) == lines[i]);
+        CHECK(rope.lineOffset(i) == offset);
+        std::size_t length = lines[i].length();
+        while (length > 0 && (lines[i][length - 1] == '\n'
+                || lines[i][length - 1] == '\r')) {
+            length--;
+        }
+        CHECK(rope.lineLength(i) == length);
+        for (std::size_t j = 0; j < lines[i].length(); j++) {
+            std::size_t line_offset = 0;
+            CHECK(rope.lineAt(offset + j, line_offset) == i);
+            CHECK(line_offset == offset);
+        }
+        offset += lines[i].length();
+    }
+}
+
+} // namespace
+
+TEST_CASE("LineRope: construction") {
+    check(LineRope(), "");
+    check(LineRope("x"), "x");
+    check(LineRope("\n"), "\n");
+    check(LineRope("a\nb"), "a\nb");
+    check(LineRope("a\nb\n"), "a\nb\n");
+    check(LineRope("a\r\nb\rc\n\n"), "a\r\nb\rc\n\n");
+    CHECK(LineRope("a\nb\n").numLines() == 3);
+    CHECK(LineRope("a\r\nb").line(0) == "a\r\n");
+}
+
+TEST_CASE("LineRope: line lookup at the boundaries") {
+    LineRope rope("ab\ncd\r\n\nef");
+    std::size_t offset = 0;
+    // The first and the last character of each line, terminators included
+    CHECK(rope.lineAt(0, offset) == 0); CHECK(offset == 0);
+    CHECK(rope.lineAt(2, offset) == 0); CHECK(offset == 0);
+    CHECK(rope.lineAt(3, offset) == 1); CHECK(offset == 3);
+    CHECK(rope.lineAt(6, offset) == 1); CHECK(offset == 3);
+    CHECK(rope.lineAt(7, offset) == 2); CHECK(offset == 7);
+    CHECK(rope.lineAt(8, offset) == 3); CHECK(offset == 8);
+    CHECK(rope.lineAt(9, offset) == 3); CHECK(offset == 8);
+    CHECK_THROWS_AS(rope.lineAt(10, offset), std::out_of_range);
+    CHECK(rope.lineOffset(3) == 8);
+    CHECK_THROWS_AS(rope.lineOffset(4), std::out_of_range);
+    CHECK_THROWS_AS(rope.line(4), std::out_of_range);
+    CHECK(rope.lineLength(1) == 2);
+    CHECK(rope.lineLength(2) == 0);
+    CHECK(rope.lineLength(3) == 2);
+}
+
+TEST_CASE("LineRope: insert") {
+    LineRope rope("ab\ncd");
+    check(rope.replace(0, 0, 0, 0, "x"), "xab\ncd");
+    check(rope.replace(0, 2, 0, 2, "x"), "abx\ncd");
+    check(rope.replace(1, 2, 1, 2, "\n"), "ab\ncd\n");
+    check(rope.replace(0, 1, 0, 1, "1\n2\n3"), "a1\n2\n3b\ncd");
+    check(rope.replace(1, 0, 1, 0, "\r\n"), "ab\n\r\ncd");
+    // "\n" after a line that ends with "\r" joins its terminator
+    check(LineRope("a\rb").replace(1, 0, 1, 0, "\n"), "a\r\nb");
+    check(LineRope("a\nb").replace(0, 1, 0, 1, "\r"), "a\r\nb");
+    // The original is not modified
+    check(rope, "ab\ncd");
+}
+
+TEST_CASE("LineRope: delete") {
+    LineRope rope("ab\ncd\nef");
+    check(rope.replace(0, 0, 0, 1, ""), "b\ncd\nef");
+    check(rope.replace(0, 2, 1, 0, ""), "abcd\nef");
+    check(rope.replace(0, 1, 2, 1, ""), "af");
+    check(rope.replace(0, 0, 2, 2, ""), "");
+    check(rope.replace(1, 0, 2, 0, ""), "ab\nef");
+    // Deleting the "\r" of "\r\n" leaves a "\n" terminator
+    check(LineRope("a\r\nb").replace(0, 1, 1, 0, "\n"), "a\nb");
+    check(rope, "ab\ncd\nef");
+}
+
+TEST_CASE("LineRope: random edits") {
+    std::mt19937 rng(42);
+    const std::string alphabet = "ab\n\r";
+    std::string text = "program p\r\nend\n";
+    LineRope rope(text);
+    for (int i = 0; i < 2000; i++) {
+        std::vector<std::string> lines = splitLines(text);
+        std::size_t a = rng() % lines.size(), b = rng() % lines.size();
+        if (a > b) std::swap(a, b);
+        std::size_t ca = rng() % (rope.lineLength(a) + 1);
+        std::size_t cb = rng() % (rope.lineLength(b) + 1);
+        if (a == b && ca > cb) std::swap(ca, cb);
+        std::string patch;
+        for (std::size_t n = rng() % 4; n > 0; n--) {
+            patch += alphabet[rng() % alphabet.size()];
+        }
+        std::size_t start = position(text, a, ca), end = position(text, b, cb);
+        text = text.substr(0, start) + patch + text.substr(end);
+        rope = rope.replace(a, ca, b, cb, patch);
+        check(rope, text);
+    }
+}
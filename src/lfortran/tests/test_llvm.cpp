@@ -357,6 +357,71 @@ define i64 @f1()
 }
 
 
+TEST_CASE("llvm tiered") {
+    LCompilers::LLVMEvaluator e;
+    e.add_module_tiered(e.parse_module2(R"""(
+define i64 @inc(i64 %x)
+{
+    %1 = add i64 %x, 1
+    ret i64 %1
+}
+    )""", ""), "run0");
+    e.add_module_tiered(e.parse_module2(R"""(
+declare i64 @inc(i64)
+
+define i64 @twice(i64 %x)
+{
+    %1 = call i64 @inc(i64 %x)
+    %2 = call i64 @inc(i64 %1)
+    ret i64 %2
+}
+    )""", ""), "run1");
+    e.end_cell(4);
+    for (int i = 0; i < 6; i++) {
+        std::string run_fn = "run" + std::to_string(i + 2);
+        e.add_module_tiered(e.parse_module2(R"""(
+declare i64 @twice(i64)
+
+define i64 @)""" + run_fn + R"""(()
+{
+    %1 = call i64 @twice(i64 10)
+    ret i64 %1
+}
+        )""", ""), run_fn);
+        CHECK(e.execfn<int64_t>(run_fn) == 12);
+        e.end_cell(4);
+    }
+    LCompilers::LLVMEvaluator::JITStats stats = e.get_jit_stats();
+    // The cells that only ran their input are unloaded
+    CHECK(stats.modules == 2);
+    CHECK(stats.released == 6);
+    // `inc` is called twice per cell and gets recompiled at O3 first
+    CHECK(stats.promoted >= 1);
+
+    // Redefining `inc` replaces it and links `twice` to the new definition
+    e.add_module_tiered(e.parse_module2(R"""(
+define i64 @inc(i64 %x)
+{
+    %1 = sub i64 %x, 1
+    ret i64 %1
+}
+    )""", ""), "run10");
+    e.add_module_tiered(e.parse_module2(R"""(
+declare i64 @twice(i64)
+
+define i64 @run11()
+{
+    %1 = call i64 @twice(i64 10)
+    ret i64 %1
+}
+    )""", ""), "run11");
+    CHECK(e.execfn<int64_t>("run11") == 8);
+    e.end_cell(4);
+    stats = e.get_jit_stats();
+    CHECK(stats.modules == 2);
+    CHECK(stats.released == 8);
+}
+
 TEST_CASE("ASR -> LLVM 1") {
     std::string source = R"(function f()
 integer :: f
@@ -634,6 +699,31 @@ end module funcmod)");
 }
 
 // Tests passing the complex struct by reference
+TEST_CASE("FortranEvaluator tiered") {
+    CompilerOptions cu;
+    cu.interactive = true;
+    cu.jit_tiered = true;
+    cu.jit_hot_calls = 3;
+    cu.po.runtime_library_dir = LCompilers::LFortran::get_runtime_library_dir();
+    FortranEvaluator e(cu);
+    LCompilers::Result<FortranEvaluator::EvalResult>
+    r = e.evaluate2(R"(
+integer function fn(i, j)
+integer, intent(in) :: i, j
+fn = i + j
+end function
+)");
+    CHECK(r.ok);
+    for (int i = 0; i < 5; i++) {
+        r = e.evaluate2("fn(2, " + std::to_string(i) + ")");
+        CHECK(r.ok);
+        CHECK(r.result.type == FortranEvaluator::EvalResult::integer4);
+        CHECK(r.result.i32 == 2 + i);
+        CHECK(r.result.jit_memory > 0);
+    }
+    CHECK(e.get_jit_stats().released >= 5);
+}
+
 TEST_CASE("llvm complex type") {
     LCompilers::LLVMEvaluator e;
     e.add_module(R"""(
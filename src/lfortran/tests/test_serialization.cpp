@@ -123,7 +123,8 @@ void asr_mod(const std::string &src) {
     std::string modfile = LCompilers::save_modfile(*asr, lm);
     LCompilers::SymbolTable symtab(nullptr);
     LCompilers::ASR::TranslationUnit_t *asr2 = LCompilers::load_modfile(al,
-            modfile, true, symtab, lm);
+            modfile, true, lm);
+    LCompilers::ASRUtils::extract_module(*asr2)->m_symtab->load_all_symbols();
     fix_external_symbols(*asr2, symtab);
     LCOMPILERS_ASSERT(LCompilers::asr_verify(*asr2, true, diagnostics));
 
@@ -331,6 +332,66 @@ end module
 
 }
 
+TEST_CASE("ASR modfile lazy loading") {
+    Allocator al(4*1024);
+    std::string src = R"""(
+module a
+implicit none
+integer, parameter :: n = 3
+
+contains
+
+subroutine b()
+call c()
+end subroutine
+
+subroutine c()
+print *, n
+end subroutine
+
+subroutine d()
+print *, "d()"
+end subroutine
+
+end module
+)""";
+    LCompilers::LFortran::AST::TranslationUnit_t* ast0;
+    LCompilers::diag::Diagnostics diagnostics;
+    LCompilers::CompilerOptions compiler_options;
+    ast0 = TRY(LCompilers::LFortran::parse(al, src, diagnostics, compiler_options));
+    LCompilers::LocationManager lm;
+    lm.file_ends.push_back(0);
+    LCompilers::LocationManager::FileLocations file;
+    file.out_start.push_back(0); file.in_start.push_back(0); file.in_newlines.push_back(0);
+    file.in_filename = "test"; file.current_line = 1; file.preprocessor = false; file.out_start0.push_back(0);
+    file.in_start0.push_back(0); file.in_size0.push_back(0); file.interval_type0.push_back(0);
+    file.in_newlines0.push_back(0);
+    lm.files.push_back(file);
+    LCompilers::ASR::TranslationUnit_t* asr = TRY(LCompilers::LFortran::ast_to_asr(al, *ast0,
+        diagnostics, nullptr, false, compiler_options, lm));
+
+    std::string modfile = LCompilers::save_modfile(*asr, lm);
+    LCompilers::SymbolTable symtab(nullptr);
+    LCompilers::ASR::TranslationUnit_t *asr2 = LCompilers::load_modfile(al,
+            modfile, false, lm);
+    LCompilers::SymbolTable *mod_symtab
+        = LCompilers::ASRUtils::extract_module(*asr2)->m_symtab;
+    CHECK(mod_symtab->get_scope().size() == 0);
+
+    // `b` calls `c`, which uses `n`; `d` is not needed
+    CHECK(mod_symtab->get_symbol("b") != nullptr);
+    CHECK(mod_symtab->get_scope().size() == 3);
+    CHECK(mod_symtab->get_scope().count("c") == 1);
+    CHECK(mod_symtab->get_scope().count("n") == 1);
+    CHECK(mod_symtab->get_scope().count("d") == 0);
+    CHECK(mod_symtab->get_symbol("x") == nullptr);
+
+    mod_symtab->load_all_symbols();
+    CHECK(mod_symtab->get_scope().size() == 4);
+    fix_external_symbols(*asr2, symtab);
+    CHECK(LCompilers::asr_verify(*asr2, true, diagnostics));
+}
+
 TEST_CASE("Topological sorting mod_int") {
     std::map<std::string, std::vector<std::string>> deps;
     // 1 depends on 2
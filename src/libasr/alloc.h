@@ -112,6 +112,14 @@ public:
         //return new T(std::forward<Args>(args)...);
     }
 
+    // Takes over the memory blocks of `other`, so that the objects allocated
+    // from it live as long as this allocator. `other` cannot be used anymore.
+    void adopt(Allocator &other) {
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());
+        other.blocks.clear();
+        other.start = nullptr;
+    }
+
     size_t size_current() {
         return current_pos - (size_t)start;
     }
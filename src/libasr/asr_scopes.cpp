@@ -1,11 +1,13 @@
+#include <cstring>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 
 #include <libasr/asr_scopes.h>
 #include <libasr/asr_utils.h>
 #include <libasr/pass/pass_utils.h>
 
-std::string lcompilers_unique_ID;
+thread_local std::string lcompilers_unique_ID;
 std::string lcompilers_commandline_options;
 
 namespace LCompilers  {
@@ -19,17 +21,203 @@ std::string hexify(T i)
     return buf.str();
 }
 
-unsigned int symbol_table_counter = 0;
+// Per thread, so that units compiled concurrently (`-j`) do not race on it
+thread_local unsigned int symbol_table_counter = 0;
+thread_local std::vector<SymbolTable*> *new_symbol_tables = nullptr;
 
-SymbolTable::SymbolTable(SymbolTable *parent) : parent{parent} {
+namespace {
+
+    uint64_t hash_name(std::string_view name) {
+        // FNV-1a
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (unsigned char c : name) {
+            h = (h ^ c) * 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    // The pool of the innermost InternScope of the thread
+    thread_local InternPool *current_pool = nullptr;
+
+} // namespace
+
+// Open addressing with linear probing. Slots are only ever filled, and
+// readers may probe concurrently with a writer.
+struct InternPool::Table {
+    size_t mask;
+    std::vector<std::atomic<SymbolId>> slots;
+
+    Table(size_t n_slots) : mask{n_slots - 1}, slots(n_slots) {
+        for (auto &slot : slots) slot.store(nullptr, std::memory_order_relaxed);
+    }
+
+    SymbolId find(std::string_view name, uint64_t hash) const {
+        for (size_t i = hash & mask;; i = (i + 1) & mask) {
+            SymbolId id = slots[i].load(std::memory_order_acquire);
+            if (id == nullptr) return nullptr;
+            if (id->hash == hash && id->str() == name) return id;
+        }
+    }
+
+    void insert(SymbolId id) {
+        size_t i = id->hash & mask;
+        while (slots[i].load(std::memory_order_relaxed)) i = (i + 1) & mask;
+        slots[i].store(id, std::memory_order_release);
+    }
+};
+
+InternPool::InternPool() : table{new Table(256)}, al(16*1024) {}
+
+InternPool::~InternPool() {
+    delete table.load();
+    for (Table *t : old_tables) delete t;
+}
+
+SymbolId InternPool::find(std::string_view name) const {
+    uint64_t hash = hash_name(name);
+    Table *t = table.load(std::memory_order_acquire);
+    SymbolId id = t->find(name, hash);
+    if (id || t == table.load(std::memory_order_acquire)) return id;
+    // The table grew meanwhile, the name may be in the new one only
+    return table.load(std::memory_order_acquire)->find(name, hash);
+}
+
+SymbolId InternPool::intern(std::string_view name) {
+    uint64_t hash = hash_name(name);
+    SymbolId id = table.load(std::memory_order_acquire)->find(name, hash);
+    if (id) return id;
+    std::lock_guard<std::mutex> lock(mutex);
+    Table *t = table.load(std::memory_order_relaxed);
+    id = t->find(name, hash);
+    if (id) return id;
+    if (2*(n + 1) > t->slots.size()) {
+        Table *bigger = new Table(2*t->slots.size());
+        for (auto &slot : t->slots) {
+            SymbolId o = slot.load(std::memory_order_relaxed);
+            if (o) bigger->insert(o);
+        }
+        table.store(bigger, std::memory_order_release);
+        old_tables.push_back(t);
+        t = bigger;
+    }
+    InternedName *new_id = (InternedName*)al.alloc(
+        sizeof(InternedName) + name.size());
+    new_id->hash = hash;
+    new_id->size = name.size();
+    std::memcpy(new_id->data, name.data(), name.size());
+    new_id->data[name.size()] = '\0';
+    t->insert(new_id);
+    n++;
+    return new_id;
+}
+
+InternPool &InternPool::current() {
+    if (current_pool) return *current_pool;
+    // Never freed, since symbol tables of the process may outlive its exit
+    static InternPool *process_pool = new InternPool();
+    return *process_pool;
+}
+
+InternScope::InternScope(InternPool &pool) : previous{current_pool} {
+    current_pool = &pool;
+}
+
+InternScope::~InternScope() {
+    current_pool = previous;
+}
+
+void SymbolIndex::rehash(size_t n_slots) {
+    std::vector<Slot> old(n_slots, Slot{nullptr, nullptr});
+    std::swap(old, slots);
+    n_used = 0;
+    n_live = 0;
+    for (auto &slot : old) {
+        if (slot.id && slot.id != tombstone()) {
+            insert_or_assign(slot.id, slot.symbol);
+        }
+    }
+}
+
+void SymbolIndex::insert_or_assign(SymbolId id, ASR::symbol_t *symbol) {
+    // Keep the load factor (including tombstones) below 3/4. Only grow if
+    // the table is at least half full of live symbols, otherwise just drop
+    // the tombstones.
+    if (4*(n_used + 1) > 3*slots.size()) {
+        size_t n_slots = std::max<size_t>(8, slots.size());
+        if (2*(n_live + 1) > n_slots) n_slots *= 2;
+        rehash(n_slots);
+    }
+    size_t mask = slots.size() - 1;
+    size_t i = id->hash & mask;
+    Slot *free_slot = nullptr;
+    for (;; i = (i + 1) & mask) {
+        if (slots[i].id == id) {
+            slots[i].symbol = symbol;
+            return;
+        }
+        if (slots[i].id == tombstone()) {
+            if (!free_slot) free_slot = &slots[i];
+        } else if (slots[i].id == nullptr) {
+            break;
+        }
+    }
+    if (!free_slot) {
+        free_slot = &slots[i];
+        n_used++;
+    }
+    n_live++;
+    free_slot->id = id;
+    free_slot->symbol = symbol;
+}
+
+void SymbolIndex::erase(SymbolId id) {
+    if (slots.empty()) return;
+    size_t mask = slots.size() - 1;
+    for (size_t i = id->hash & mask; slots[i].id; i = (i + 1) & mask) {
+        if (slots[i].id == id) {
+            slots[i].id = tombstone();
+            slots[i].symbol = nullptr;
+            n_live--;
+            return;
+        }
+    }
+}
+
+SymbolTable::SymbolTable(SymbolTable *parent)
+        : names{parent ? parent->names : &InternPool::current()},
+          parent{parent} {
     symbol_table_counter++;
     counter = symbol_table_counter;
+    if (new_symbol_tables) new_symbol_tables->push_back(this);
 }
 
 void SymbolTable::reset_global_counter() {
     symbol_table_counter = 0;
 }
 
+void SymbolTable::log_new_symbol_tables(std::vector<SymbolTable*> *log) {
+    new_symbol_tables = log;
+}
+
+unsigned int SymbolTable::get_global_counter() {
+    return symbol_table_counter;
+}
+
+void SymbolTable::set_global_counter(unsigned int value) {
+    symbol_table_counter = value;
+}
+
+uint32_t SymbolTable::get_hash_uint32() {
+    // Uses the ordered view, so that the hash does not depend on the order
+    // in which the symbols were added
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (auto &a : scope) {
+        h = (h ^ hash_name(a.first)) * 0x100000001b3ULL;
+        h = (h ^ (uint64_t)a.second->type) * 0x100000001b3ULL;
+    }
+    return (uint32_t)(h ^ (h >> 32));
+}
+
 void SymbolTable::mark_all_variables_external(Allocator &al) {
     for (auto &a : scope) {
         switch (a.second->type) {
@@ -74,8 +262,8 @@ ASR::symbol_t *SymbolTable::find_scoped_symbol(const std::string &name,
     const SymbolTable *s = this;
     for(size_t i=0; i < n_scope_names; i++) {
         std::string scope_name = m_scope_names[i];
-        if (s->scope.find(scope_name) != scope.end()) {
-            ASR::symbol_t *sym = s->scope.at(scope_name);
+        ASR::symbol_t *sym = s->get_symbol(scope_name);
+        if (sym != nullptr) {
             s = ASRUtils::symbol_symtab(sym);
             if (s == nullptr) {
                 // The m_scope_names[i] found in the appropriate symbol table,
@@ -88,14 +276,8 @@ ASR::symbol_t *SymbolTable::find_scoped_symbol(const std::string &name,
             return nullptr;
         }
     }
-    if (s->scope.find(name) != scope.end()) {
-        ASR::symbol_t *sym = s->scope.at(name);
-        LCOMPILERS_ASSERT(sym)
-        return sym;
-    } else {
-        // The `name` not found in the appropriate symbol table
-        return nullptr;
-    }
+    // Returns `nullptr` if `name` is not found in the appropriate symbol table
+    return s->get_symbol(name);
 }
 
 std::string SymbolTable::get_unique_name(const std::string &name, bool use_unique_id) {
@@ -1,7 +1,14 @@
 #ifndef LFORTRAN_SEMANTICS_ASR_SCOPES_H
 #define LFORTRAN_SEMANTICS_ASR_SCOPES_H
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <libasr/alloc.h>
 #include <libasr/containers.h>
@@ -15,9 +22,123 @@ namespace ASR {
     struct symbol_t;
 }
 
+// An interned identifier. Equal names are interned only once per InternPool,
+// so that symbol lookups compare pointers instead of strings.
+struct InternedName {
+    uint64_t hash;
+    size_t size;
+    char data[1]; // `size` characters, NULL terminated
+
+    std::string_view str() const {
+        return std::string_view(data, size);
+    }
+};
+typedef const InternedName* SymbolId;
+
+/*
+    A set of interned names. A SymbolTable interns its names in the pool of
+    its parent, or, for a table created without a parent, in the current pool
+    of the thread: the one of the innermost live InternScope, and otherwise
+    the pool of the process, which is never freed. A compilation that scopes
+    a pool of its own frees its names together with its ASR, so that long
+    running processes (the language server) do not keep every name they have
+    ever seen. The pool must outlive the symbol tables that use it.
+
+    Lookups do not lock: the table is replaced on growth, and the previous
+    ones are kept until the pool is destroyed for the readers still using
+    them.
+*/
+class InternPool {
+public:
+    InternPool();
+    ~InternPool();
+    InternPool(const InternPool&) = delete;
+    InternPool& operator=(const InternPool&) = delete;
+
+    // Returns the unique SymbolId of `name`
+    SymbolId intern(std::string_view name);
+    // Returns the SymbolId of `name`, `nullptr` if it was not interned
+    SymbolId find(std::string_view name) const;
+
+    static InternPool &current();
+
+private:
+    struct Table;
+    std::atomic<Table*> table;
+    std::vector<Table*> old_tables;
+    size_t n = 0;
+    Allocator al;
+    std::mutex mutex;
+
+    friend class InternScope;
+};
+
+// Makes `pool` the current InternPool of the thread while it exists
+class InternScope {
+    InternPool *previous;
+public:
+    InternScope(InternPool &pool);
+    ~InternScope();
+    InternScope(const InternScope&) = delete;
+    InternScope& operator=(const InternScope&) = delete;
+};
+
+// Open addressing hash table from SymbolId to symbol, with linear probing.
+// Used by SymbolTable for lookups; iteration goes through its ordered view.
+class SymbolIndex {
+    struct Slot {
+        SymbolId id;
+        ASR::symbol_t *symbol;
+    };
+    // Slots with `id == nullptr` are empty, `id == tombstone()` were erased
+    std::vector<Slot> slots;
+    size_t n_used = 0; // Occupied slots, including tombstones
+    size_t n_live = 0;
+
+    static SymbolId tombstone() {
+        static const InternedName t = {0, 0, {0}};
+        return &t;
+    }
+    void rehash(size_t n_slots);
+
+public:
+    ASR::symbol_t* find(SymbolId id) const {
+        if (slots.empty()) return nullptr;
+        size_t mask = slots.size() - 1;
+        for (size_t i = id->hash & mask;; i = (i + 1) & mask) {
+            if (slots[i].id == id) return slots[i].symbol;
+            if (slots[i].id == nullptr) return nullptr;
+        }
+    }
+    void insert_or_assign(SymbolId id, ASR::symbol_t *symbol);
+    void erase(SymbolId id);
+};
+
+// Materializes the symbols of a SymbolTable on demand. Used for modules loaded
+// from an indexed modfile, whose symbols are only deserialized once they are
+// looked up by name (see deserialize_indexed_module()).
+struct SymbolLoader {
+    // Called with the top level symbols materialized by each lookup, after
+    // their parent symbol tables were fixed
+    std::function<void(const std::vector<ASR::symbol_t*> &)> on_load;
+
+    // Materializes `name` together with all symbols it depends on. Returns
+    // `nullptr` if `name` is unknown or was already materialized.
+    virtual ASR::symbol_t* load_symbol(const std::string &name) = 0;
+    // Materializes all remaining symbols
+    virtual void load_all_symbols() = 0;
+    virtual ~SymbolLoader() = default;
+};
+
 struct SymbolTable {
     private:
+    // The stable, ordered view of the symbols, used by everything that
+    // iterates over them (codegen, serialization, pickling, hashing)
     std::map<std::string, ASR::symbol_t*> scope;
+    // The same symbols, for lookups by name
+    SymbolIndex index;
+    // The pool of the names in `index`
+    InternPool *names;
 
     public:
     SymbolTable *parent;
@@ -27,6 +148,9 @@ struct SymbolTable {
     // * down_cast2<TranslationUnit_t>(this->asr_owner)->m_symtab == this
     ASR::asr_t *asr_owner = nullptr;
     unsigned int counter;
+    // If set, symbols missing from `scope` are looked up by the loader. Then
+    // get_scope() only returns the symbols materialized so far.
+    SymbolLoader *loader = nullptr;
 
     SymbolTable(SymbolTable *parent);
 
@@ -36,18 +160,31 @@ struct SymbolTable {
         return std::to_string(counter);
     }
     static void reset_global_counter(); // Resets the internal global counter
+    // Symbol tables created by the current thread are appended to `log`
+    // (none if `nullptr`). Used to renumber the symbol tables created on
+    // worker threads in the order a serial run would have created them.
+    static void log_new_symbol_tables(std::vector<SymbolTable*> *log);
+    static unsigned int get_global_counter();
+    static void set_global_counter(unsigned int value);
 
     // Resolves the symbol `name` recursively in current and parent scopes.
     // Returns `nullptr` if symbol not found.
     ASR::symbol_t* resolve_symbol(const std::string &name) {
-        if (scope.find(name) == scope.end()) {
-            if (parent) {
-                return parent->resolve_symbol(name);
-            } else {
-                return nullptr;
+        // The name is looked up once per pool, usually once for all scopes
+        InternPool *pool = nullptr;
+        SymbolId id = nullptr;
+        for (SymbolTable *s = this; s != nullptr; s = s->parent) {
+            if (s->names != pool) {
+                pool = s->names;
+                id = pool->find(name);
             }
+            ASR::symbol_t *sym = id ? s->index.find(id) : nullptr;
+            if (sym == nullptr && s->loader) {
+                sym = s->loader->load_symbol(name);
+            }
+            if (sym) return sym;
         }
-        return scope[name];
+        return nullptr;
     }
 
     SymbolTable* get_global_scope() {
@@ -65,37 +202,44 @@ struct SymbolTable {
     // Obtains the symbol `name` from the current symbol table
     // Returns `nullptr` if symbol not found.
     ASR::symbol_t* get_symbol(const std::string &name) const {
-        //auto it = scope.find(to_lower(name));
-        auto it = scope.find(name);
-        if (it == scope.end()) {
-            return nullptr;
-        } else {
-            return it->second;
+        SymbolId id = names->find(name);
+        ASR::symbol_t *sym = id ? index.find(id) : nullptr;
+        if (sym == nullptr && loader) {
+            return loader->load_symbol(name);
         }
+        return sym;
     }
 
     void erase_symbol(const std::string &name) {
-        //auto it = scope.find(to_lower(name));
         LCOMPILERS_ASSERT(scope.find(name) != scope.end())
         scope.erase(name);
+        SymbolId id = names->find(name);
+        if (id) index.erase(id);
     }
 
     // Add a new symbol that did not exist before
     void add_symbol(const std::string &name, ASR::symbol_t* symbol) {
         LCOMPILERS_ASSERT(scope.find(name) == scope.end())
-        scope[name] = symbol;
+        add_or_overwrite_symbol(name, symbol);
     }
 
     // Overwrite an existing symbol
     void overwrite_symbol(const std::string &name, ASR::symbol_t* symbol) {
         LCOMPILERS_ASSERT(scope.find(name) != scope.end())
-        scope[name] = symbol;
+        add_or_overwrite_symbol(name, symbol);
     }
 
     // Use as the last resort, prefer to always either add a new symbol
     // or overwrite an existing one, not both
     void add_or_overwrite_symbol(const std::string &name, ASR::symbol_t* symbol) {
         scope[name] = symbol;
+        index.insert_or_assign(names->intern(name), symbol);
+    }
+
+    // Materializes all symbols of a lazily loaded symbol table, so that
+    // get_scope() returns all of them
+    void load_all_symbols() {
+        if (loader) loader->load_all_symbols();
     }
 
     // Marks all variables as external
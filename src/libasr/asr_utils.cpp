@@ -1,5 +1,7 @@
 #include <unordered_set>
 #include <map>
+#include <mutex>
+#include <filesystem>
 #include <libasr/asr_utils.h>
 #include <libasr/string_utils.h>
 #include <libasr/serialization.h>
@@ -7,6 +9,7 @@
 #include <libasr/asr_verify.h>
 #include <libasr/utils.h>
 #include <libasr/modfile.h>
+#include <libasr/file_contents.h>
 #include <libasr/pass/pass_utils.h>
 #include <libasr/pass/intrinsic_function_registry.h>
 #include <libasr/pass/intrinsic_subroutine_registry.h>
@@ -291,6 +294,35 @@ ASR::Module_t* extract_module(const ASR::TranslationUnit_t &m) {
     throw LCompilersException("ICE: Module not found");
 }
 
+/*
+    Prepares a module loaded from a modfile for use. Its symbols are
+    materialized lazily (see deserialize_indexed_module()), so everything that
+    load_module() does to the symbols of a freshly loaded module is also done
+    to the symbols materialized later.
+*/
+static void setup_loaded_module(Allocator &al, ASR::Module_t *mod,
+        bool generate_object_code) {
+    bool mark_external = generate_object_code
+        && !startswith(mod->m_name, "lfortran_intrinsic");
+    if (mark_external) {
+        mod->m_symtab->mark_all_variables_external(al);
+    }
+    if (mod->m_symtab->loader == nullptr) return;
+    mod->m_symtab->loader->on_load = [&al, mod, mark_external](
+            const std::vector<ASR::symbol_t*> &symbols) {
+        SymbolTable *tu_symtab = mod->m_symtab->parent;
+        if (mod->m_intrinsic) {
+            for (auto &sym : symbols) set_intrinsic(sym);
+        }
+        if (mark_external) {
+            mod->m_symtab->mark_all_variables_external(al);
+        }
+        fix_external_symbols(symbols, *mod->m_symtab, *tu_symtab);
+        PassUtils::UpdateDependenciesVisitor v(al);
+        for (auto &sym : symbols) v.visit_symbol(*sym);
+    };
+}
+
 ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
                             const std::string &module_name,
                             const Location &loc, bool intrinsic,
@@ -310,14 +342,14 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
     }
     LCOMPILERS_ASSERT(symtab->parent == nullptr);
     ASR::TranslationUnit_t *mod1 = find_and_load_module(al, module_name,
-            *symtab, intrinsic, pass_options, lm);
+            intrinsic, pass_options, lm);
     if (mod1 == nullptr && !intrinsic) {
         // Module not found as a regular module. Try intrinsic module
         if (module_name == "iso_c_binding"
             ||module_name == "iso_fortran_env"
             ||module_name == "ieee_arithmetic") {
             mod1 = find_and_load_module(al, "lfortran_intrinsic_" + module_name,
-                *symtab, true, pass_options, lm);
+                true, pass_options, lm);
         }
     }
     if (mod1 == nullptr) {
@@ -328,9 +360,7 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
     symtab->add_symbol(module_name, (ASR::symbol_t*)mod2);
     mod2->m_symtab->parent = symtab;
     mod2->m_loaded_from_mod = true;
-    if ( generate_object_code && !startswith(mod2->m_name, "lfortran_intrinsic") ) {
-        mod2->m_symtab->mark_all_variables_external(al);
-    }
+    setup_loaded_module(al, mod2, generate_object_code);
     LCOMPILERS_ASSERT(symtab->resolve_symbol(module_name));
 
     // Create a temporary TranslationUnit just for fixing the symbols
@@ -356,14 +386,13 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
                 // such as using `module_name@intrinsic`:
                 bool is_intrinsic = startswith(item, "lfortran_intrinsic");
                 ASR::TranslationUnit_t *mod1 = find_and_load_module(al,
-                        item,
-                        *symtab, is_intrinsic, pass_options, lm);
+                        item, is_intrinsic, pass_options, lm);
                 if (mod1 == nullptr && !is_intrinsic) {
                     // Module not found as a regular module. Try intrinsic module
                     if (item == "iso_c_binding"
                         ||item == "iso_fortran_env") {
                         mod1 = find_and_load_module(al, "lfortran_intrinsic_" + item,
-                            *symtab, true, pass_options, lm);
+                            true, pass_options, lm);
                     }
                 }
 
@@ -374,9 +403,7 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
                 symtab->add_symbol(item, (ASR::symbol_t*)mod2);
                 mod2->m_symtab->parent = symtab;
                 mod2->m_loaded_from_mod = true;
-                if ( generate_object_code && !startswith(mod2->m_name, "lfortran_intrinsic") ) {
-                    mod2->m_symtab->mark_all_variables_external(al);
-                }
+                setup_loaded_module(al, mod2, generate_object_code);
                 rerun = true;
             }
         }
@@ -460,8 +487,60 @@ void set_intrinsic(ASR::TranslationUnit_t* trans_unit) {
     }
 }
 
+void load_all_module_symbols(ASR::TranslationUnit_t &unit) {
+    for (auto &item : unit.m_symtab->get_scope()) {
+        if (ASR::is_a<ASR::Module_t>(*item.second)) {
+            ASR::Module_t *m = ASR::down_cast<ASR::Module_t>(item.second);
+            if (m->m_loaded_from_mod && !m->m_intrinsic
+                    && !startswith(m->m_name, "lfortran_intrinsic")) {
+                m->m_symtab->load_all_symbols();
+            }
+        }
+    }
+}
+
+/*
+    Opens a modfile. The whole file is read into memory, since its symbols
+    are loaded lazily and the file might be rewritten meanwhile (by a
+    concurrent build, or a reinstall of the runtime library under a long
+    running language server). The modules of the runtime library
+    (`lfortran_intrinsic_*`, ...) are used by almost every compilation unit,
+    so they are read once and shared by all units of the process until their
+    size or modification time changes.
+*/
+static std::shared_ptr<const FileContents> open_modfile(
+        const std::string &filename, bool runtime_library) {
+    if (!runtime_library) return FileContents::read(filename);
+    struct CachedFile {
+        std::filesystem::file_time_type mtime;
+        std::uintmax_t size;
+        std::shared_ptr<const FileContents> file;
+    };
+    static std::mutex mutex;
+    static std::map<std::string, CachedFile> files;
+    std::error_code ec;
+    std::filesystem::file_time_type mtime
+        = std::filesystem::last_write_time(filename, ec);
+    if (ec) return nullptr;
+    std::uintmax_t size = std::filesystem::file_size(filename, ec);
+    if (ec) return nullptr;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(filename);
+    if (it != files.end() && it->second.mtime == mtime
+            && it->second.size == size) {
+        return it->second.file;
+    }
+    std::shared_ptr<const FileContents> file = FileContents::read(filename);
+    if (file) {
+        files[filename] = {mtime, size, file};
+    } else {
+        files.erase(filename);
+    }
+    return file;
+}
+
 ASR::TranslationUnit_t* find_and_load_module(Allocator &al, const std::string &msym,
-                                                SymbolTable &symtab, bool intrinsic,
+                                                bool intrinsic,
                                                 LCompilers::PassOptions& pass_options,
                                                 LCompilers::LocationManager &lm) {
     std::filesystem::path runtime_library_dir { pass_options.runtime_library_dir };
@@ -475,10 +554,13 @@ ASR::TranslationUnit_t* find_and_load_module(Allocator &al, const std::string &m
                           pass_options.include_dirs.end());
 
     for (auto path : mod_files_dirs) {
-        std::string modfile;
         std::filesystem::path full_path = path / filename;
-        if (read_file(full_path.string(), modfile)) {
-            ASR::TranslationUnit_t *asr = load_modfile(al, modfile, false, symtab, lm);
+        std::shared_ptr<const FileContents> modfile = open_modfile(
+            full_path.string(), !runtime_library_dir.empty()
+                && path == runtime_library_dir);
+        if (modfile) {
+            pass_options.loaded_mod_files.push_back(full_path.string());
+            ASR::TranslationUnit_t *asr = load_modfile(al, modfile, false, lm);
             if (intrinsic) {
                 set_intrinsic(asr);
             }
@@ -2242,9 +2324,6 @@ ASR::expr_t* get_compile_time_array_size(Allocator& al, ASR::ttype_t* array_type
     return nullptr;
 }
 
-//Initialize pointer to zero so that it can be initialized in first call to get_instance
-ASRUtils::LabelGenerator* ASRUtils::LabelGenerator::label_generator = nullptr;
-
 } // namespace ASRUtils
 
 
@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <map>
+#include <mutex>
 #include <limits>
 
 #include <libasr/assert.h>
@@ -2303,12 +2304,16 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
                             bool generate_object_code = false);
 
 ASR::TranslationUnit_t* find_and_load_module(Allocator &al, const std::string &msym,
-                                                SymbolTable &symtab, bool intrinsic,
+                                                bool intrinsic,
                                                 LCompilers::PassOptions& pass_options,
                                                 LCompilers::LocationManager &lm);
 
 void set_intrinsic(ASR::TranslationUnit_t* trans_unit);
 
+// Materializes all symbols of the modules that `unit` loaded from modfiles,
+// except the intrinsic ones
+void load_all_module_symbols(ASR::TranslationUnit_t &unit);
+
 static inline bool is_const(ASR::expr_t *x) {
     if (ASR::is_a<ASR::Var_t>(*x)) {
         ASR::Var_t* v = ASR::down_cast<ASR::Var_t>(x);
@@ -4905,13 +4910,14 @@ static inline bool present(Vec<ASR::symbol_t*> &v, const ASR::symbol_t* name) {
 // Singleton LabelGenerator so that it generates
 // unique labels for different statements, from
 // wherever it is called (be it ASR passes, be it
-// AST to ASR transition, etc).
+// AST to ASR transition, etc). It is shared by
+// the threads of `lfortran -j`, hence the mutex.
 class LabelGenerator {
     private:
 
-        static LabelGenerator *label_generator;
         uint64_t unique_label;
         std::map<ASR::asr_t*, uint64_t> node2label;
+        std::mutex mutex;
 
         // Private constructor so that more than
         // one object cannot be created by calling the
@@ -4923,23 +4929,24 @@ class LabelGenerator {
     public:
 
         static LabelGenerator *get_instance() {
-            if (!label_generator) {
-                label_generator = new LabelGenerator;
-            }
-            return label_generator;
+            static LabelGenerator label_generator;
+            return &label_generator;
         }
 
         int get_unique_label() {
+            std::lock_guard<std::mutex> lock(mutex);
             unique_label += 1;
             return unique_label;
         }
 
         void add_node_with_unique_label(ASR::asr_t* node, uint64_t label) {
+            std::lock_guard<std::mutex> lock(mutex);
             LCOMPILERS_ASSERT( node2label.find(node) == node2label.end() );
             node2label[node] = label;
         }
 
         bool verify(ASR::asr_t* node) {
+            std::lock_guard<std::mutex> lock(mutex);
             return node2label.find(node) != node2label.end();
         }
 };
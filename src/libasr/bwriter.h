@@ -3,6 +3,7 @@
 
 #include <sstream>
 #include <iomanip>
+#include <string_view>
 
 #include <libasr/asr_utils.h>
 #include <libasr/exception.h>
@@ -170,13 +171,14 @@ public:
 
 };
 
+// The readers do not copy their input, which must outlive them.
 class BinaryReader
 {
 private:
-    std::string s;
+    std::string_view s;
     size_t pos;
 public:
-    BinaryReader(const std::string &s) : s{s}, pos{0} {}
+    BinaryReader(std::string_view s) : s{s}, pos{0} {}
 
     uint8_t read_int8() {
         if (pos+1 > s.size()) {
@@ -191,7 +193,7 @@ public:
         if (pos+2 > s.size()) {
             throw LCompilersException("read_int16: String is too short for deserialization.");
         }
-        uint16_t n = string_to_uint16(&s[pos]);
+        uint16_t n = string_to_uint16(s.data() + pos);
         pos += 2;
         return n;
     }
@@ -200,7 +202,7 @@ public:
         if (pos+4 > s.size()) {
             throw LCompilersException("read_int32: String is too short for deserialization.");
         }
-        uint32_t n = string_to_uint32(&s[pos]);
+        uint32_t n = string_to_uint32(s.data() + pos);
         pos += 4;
         return n;
     }
@@ -209,17 +211,22 @@ public:
         if (pos+8 > s.size()) {
             throw LCompilersException("read_int64: String is too short for deserialization.");
         }
-        uint64_t n = string_to_uint64(&s[pos]);
+        uint64_t n = string_to_uint64(s.data() + pos);
         pos += 8;
         return n;
     }
 
     std::string read_string() {
+        return std::string(read_string_view());
+    }
+
+    // Returns a view into the input, without copying the string
+    std::string_view read_string_view() {
         size_t n = read_int64();
         if (pos+n > s.size()) {
             throw LCompilersException("read_string: String is too short for deserialization.");
         }
-        std::string r = std::string(&s[pos], n);
+        std::string_view r = s.substr(pos, n);
         pos += n;
         return r;
     }
@@ -309,10 +316,10 @@ public:
 class TextReader
 {
 private:
-    std::string s;
+    std::string_view s;
     size_t pos;
 public:
-    TextReader(const std::string &s) : s{s}, pos{0} {}
+    TextReader(std::string_view s) : s{s}, pos{0} {}
 
     uint8_t read_int8() {
         uint64_t n = read_int64();
@@ -373,13 +380,18 @@ public:
     }
 
     std::string read_string() {
+        return std::string(read_string_view());
+    }
+
+    // Returns a view into the input, without copying the string
+    std::string_view read_string_view() {
         size_t n = read_int64();
         if (pos+n > s.size()) {
             throw LCompilersException("read_string: String is too short for deserialization.");
         }
-        std::string r = std::string(&s[pos], n);
+        std::string_view r = s.substr(pos, n);
         pos += n;
-        if (s[pos] != ' ') {
+        if (pos >= s.size() || s[pos] != ' ') {
             throw LCompilersException("read_string: Space expected.");
         }
         pos ++;
@@ -24,6 +24,7 @@
 #include "llvm/ExecutionEngine/SectionMemoryManager.h"
 #include "llvm/IR/DataLayout.h"
 #include "llvm/IR/LLVMContext.h"
+#include <atomic>
 #include <memory>
 
 #if LLVM_VERSION_MAJOR >= 13
@@ -39,8 +40,41 @@
 namespace llvm {
 namespace orc {
 
+// A SectionMemoryManager that keeps a running total of the bytes it holds,
+// so that the JIT can report how much memory the loaded code takes.
+class CountingMemoryManager : public SectionMemoryManager {
+  std::atomic<size_t> &Total;
+  size_t Size = 0;
+
+  void add(uintptr_t Bytes) {
+    Size += Bytes;
+    Total += Bytes;
+  }
+
+public:
+  CountingMemoryManager(std::atomic<size_t> &Total) : Total(Total) {}
+  ~CountingMemoryManager() override { Total -= Size; }
+
+  uint8_t *allocateCodeSection(uintptr_t Size, unsigned Alignment,
+                               unsigned SectionID,
+                               StringRef SectionName) override {
+    add(Size);
+    return SectionMemoryManager::allocateCodeSection(Size, Alignment,
+                                                     SectionID, SectionName);
+  }
+
+  uint8_t *allocateDataSection(uintptr_t Size, unsigned Alignment,
+                               unsigned SectionID, StringRef SectionName,
+                               bool IsReadOnly) override {
+    add(Size);
+    return SectionMemoryManager::allocateDataSection(
+        Size, Alignment, SectionID, SectionName, IsReadOnly);
+  }
+};
+
 class KaleidoscopeJIT {
 private:
+  std::atomic<size_t> MemoryUsage{0};
   std::unique_ptr<ExecutionSession> ES;
   RTDyldObjectLinkingLayer ObjectLayer;
   IRCompileLayer CompileLayer;
@@ -54,7 +88,10 @@ public:
       :
         ES(std::move(ES)),
         ObjectLayer(*this->ES,
-                    []() { return std::make_unique<SectionMemoryManager>(); }),
+                    [this]() {
+                      return std::make_unique<CountingMemoryManager>(
+                          MemoryUsage);
+                    }),
         CompileLayer(*this->ES, ObjectLayer, std::make_unique<ConcurrentIRCompiler>(std::move(JTMB))),
         DL(std::move(DL)), Mangle(*this->ES, this->DL),
         JITDL(
@@ -108,6 +145,24 @@ public:
     return res;
   }
 
+#if LLVM_VERSION_MAJOR >= 12
+  ResourceTrackerSP createResourceTracker() {
+    return JITDL.createResourceTracker();
+  }
+
+  // Adds the module under `RT`; `RT->remove()` unloads it again
+  Error addModule(std::unique_ptr<Module> M, std::unique_ptr<LLVMContext> &Ctx,
+                  ResourceTrackerSP RT) {
+    auto res = CompileLayer.add(RT,
+                                ThreadSafeModule(std::move(M), std::move(Ctx)));
+    Ctx = std::make_unique<LLVMContext>();
+    return res;
+  }
+#endif
+
+  // Bytes of code and data currently loaded
+  size_t getMemoryUsage() const { return MemoryUsage; }
+
 #if LLVM_VERSION_MAJOR < 17
   Expected<JITEvaluatedSymbol> lookup(StringRef Name) {
 #else
@@ -2644,13 +2644,13 @@ PyMODINIT_FUNC PyInit_lpython_module_)" + fn_name + R"((void) {
                     ASRUtils::type_get_past_array(
                         ASRUtils::type_get_past_allocatable(type)));
                 size_str += "*sizeof(" + ty + ")";
-                out += indent + sym + "->data = (" + ty + "*) _lfortran_malloc(" + size_str + ")";
+                out += indent + sym + "->data = (" + ty + "*) _lfortran_malloc64(" + size_str + ")";
                 out += ";\n";
                 out += indent + sym + "->is_allocated = true;\n";
             } else {
                 std::string ty = CUtils::get_c_type_from_ttype_t(type), size_str;
                 size_str = "sizeof(" + ty + ")";
-                out += indent + sym + " = (" + ty + "*) _lfortran_malloc(" + size_str + ")";
+                out += indent + sym + " = (" + ty + "*) _lfortran_malloc64(" + size_str + ")";
                 out += ";\n";
             }
         }
@@ -658,6 +658,12 @@ Kokkos::View<T*> from_std_vector(const std::vector<T> &v)
         src = out;
     }
 
+    void visit_FileWait(const ASR::FileWait_t &/*x*/) {
+        // WRITE goes to std::cout synchronously, so there is nothing to wait for
+        std::string indent(indentation_level*indentation_spaces, ' ');
+        src = indent + "// WAIT: transfers are synchronous\n";
+    }
+
     void visit_DoConcurrentLoop(const ASR::DoConcurrentLoop_t &x) {
         std::string indent(indentation_level*indentation_spaces, ' ');
         std::string out = indent + "Kokkos::parallel_for(";
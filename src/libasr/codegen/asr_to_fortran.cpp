@@ -1319,6 +1319,42 @@ public:
 
     // void visit_Expr(const ASR::Expr_t &x) {}
 
+    void visit_FileWait(const ASR::FileWait_t &x) {
+        std::string r = indent;
+        r += "wait";
+        r += "(";
+        visit_expr(*x.m_unit);
+        r += src;
+        if (x.m_id) {
+            r += ", ";
+            r += "id=";
+            visit_expr(*x.m_id);
+            r += src;
+        }
+        if (x.m_iostat) {
+            r += ", ";
+            r += "iostat=";
+            visit_expr(*x.m_iostat);
+            r += src;
+        }
+        if (x.m_iomsg) {
+            r += ", ";
+            r += "iomsg=";
+            visit_expr(*x.m_iomsg);
+            r += src;
+        }
+        if (x.m_err) {
+            r += ", ";
+            r += "err=";
+            visit_expr(*x.m_err);
+            r += src;
+        }
+        r += ")";
+        handle_line_truncation(r, 2);
+        r += "\n";
+        src = r;
+    }
+
     /********************************** Expr **********************************/
     void visit_IfExp(const ASR::IfExp_t &x) {
         std::string r = "";
@@ -1891,6 +1891,14 @@ public:
         src = out;
     }
 
+    // All file transfers are synchronous here, so there is nothing to wait for
+    void visit_FileWait(const ASR::FileWait_t& /* x */)
+    {
+        std::string indent(indentation_level * indentation_spaces, ' ');
+        std::string out = indent + "// WAIT: transfers are synchronous\n";
+        src = out;
+    }
+
     void visit_IntrinsicElementalFunction(const ASR::IntrinsicElementalFunction_t &x) {
         std::string out;
         LCOMPILERS_ASSERT(x.n_args == 1);
@@ -47,6 +47,7 @@
 #include <libasr/asr_utils.h>
 #include <libasr/codegen/llvm_utils.h>
 #include <libasr/codegen/llvm_array_utils.h>
+#include <libasr/codegen/llvm_alias_info.h>
 #include <libasr/pass/intrinsic_function_registry.h>
 
 namespace LCompilers {
@@ -191,6 +192,12 @@ public:
     std::unique_ptr<LLVMArrUtils::Descriptor> arr_descr;
     std::vector<llvm::Value*> heap_arrays;
     std::map<llvm::Value*, llvm::Value*> strings_to_be_allocated; // (array, size)
+    std::map<std::string, llvm::GlobalVariable*> format_caches; // constant format -> slot for the parsed format
+    // Positions of the `noalias` array descriptor arguments of each function
+    std::map<llvm::Function*, std::vector<unsigned>> noalias_descriptor_args;
+    // Set once memory is reinterpreted as another type, after which elements
+    // of different types may no longer be assumed not to alias
+    bool type_punning;
     Vec<llvm::Value*> strings_to_be_deallocated;
     struct to_be_allocated_array{ // struct to hold details for the initializing pointer_to_array_type later inside main function.
         llvm::Constant* pointer_to_array_type;
@@ -243,6 +250,38 @@ public:
         llvm_utils->set_api_lp = set_api_lp.get();
         llvm_utils->set_api_sc = set_api_sc.get();
         strings_to_be_deallocated.reserve(al, 1);
+        // Procedures with implicit interfaces are commonly called with
+        // arguments of another type
+        type_punning = compiler_options.implicit_interface ||
+            compiler_options.implicit_argument_casting ||
+            compiler_options.legacy_array_sections;
+    }
+
+    bool emit_alias_info() {
+        return compiler_options.po.fast && !compiler_options.no_alias_metadata;
+    }
+
+    // Fortran does not allow a dummy argument to be accessed through any other
+    // name while it is being modified, unless it is a pointer or a target
+    bool is_noalias_dummy(const ASR::Function_t &x, const ASR::Variable_t &arg) {
+        if (ASRUtils::get_FunctionType(x)->m_abi == ASR::abiType::BindC ||
+                arg.m_value_attr || arg.m_target_attr || arg.m_is_volatile ||
+                ASRUtils::is_pointer(arg.m_type)) {
+            return false;
+        }
+        ASR::ttype_t *type = ASRUtils::extract_type(arg.m_type);
+        switch (type->type) {
+            case ASR::ttypeType::Integer:
+            case ASR::ttypeType::UnsignedInteger:
+            case ASR::ttypeType::Real:
+            case ASR::ttypeType::Complex:
+            case ASR::ttypeType::Logical:
+                return true;
+            case ASR::ttypeType::StructType:
+                return !ASRUtils::is_class_type(type);
+            default:
+                return false;
+        }
     }
 
     #define load_non_array_non_character_pointers(expr, type, llvm_value) if( ASR::is_a<ASR::StructInstanceMember_t>(*expr) && \
@@ -454,10 +493,11 @@ public:
                 if( !compiler_options.stack_arrays ) {
                     llvm::DataLayout data_layout(module->getDataLayout());
                     uint64_t size = data_layout.getTypeAllocSize(llvm_data_type);
-                    prod = builder->CreateMul(prod,
-                        llvm::ConstantInt::get(context, llvm::APInt(32, size)));
+                    llvm::Value* size_in_bytes = builder->CreateMul(
+                        builder->CreateSExtOrTrunc(prod, llvm::Type::getInt64Ty(context)),
+                        llvm::ConstantInt::get(context, llvm::APInt(64, size)));
                     llvm::Value* arr_first_i8 = LLVMArrUtils::lfortran_malloc(
-                        context, *module, *builder, prod);
+                        context, *module, *builder, size_in_bytes);
                     heap_arrays.push_back(arr_first_i8);
                     arr_first = builder->CreateBitCast(
                         arr_first_i8, llvm_data_type->getPointerTo());
@@ -573,12 +613,14 @@ public:
                     llvm::Function::ExternalLinkage, runtime_func_name, *module);
         }
 
-        llvm::AllocaInst *pleft_arg = llvm_utils->CreateAlloca(*builder, complex_type);
+        // The temporaries go to the entry block, so that an operation in a
+        // loop does not grow the stack on every iteration
+        llvm::AllocaInst *pleft_arg = llvm_utils->CreateAlloca(complex_type);
 
         builder->CreateStore(left_arg, pleft_arg);
-        llvm::AllocaInst *pright_arg = llvm_utils->CreateAlloca(*builder, complex_type);
+        llvm::AllocaInst *pright_arg = llvm_utils->CreateAlloca(complex_type);
         builder->CreateStore(right_arg, pright_arg);
-        llvm::AllocaInst *presult = llvm_utils->CreateAlloca(*builder, complex_type);
+        llvm::AllocaInst *presult = llvm_utils->CreateAlloca(complex_type);
         std::vector<llvm::Value*> args = {pleft_arg, pright_arg, presult};
         builder->CreateCall(fn, args);
         return llvm_utils->CreateLoad(presult);
@@ -1695,6 +1737,7 @@ public:
     }
 
     void visit_UnionInstanceMember(const ASR::UnionInstanceMember_t& x) {
+        type_punning = true;
         int64_t ptr_loads_copy = ptr_loads;
         ptr_loads = 0;
         this->visit_expr(*x.m_v);
@@ -4133,10 +4176,11 @@ public:
             if( !compiler_options.stack_arrays && array_size ) {
                 llvm::DataLayout data_layout(module->getDataLayout());
                 uint64_t size = data_layout.getTypeAllocSize(type);
-                array_size = builder->CreateMul(array_size,
-                    llvm::ConstantInt::get(context, llvm::APInt(32, size)));
+                llvm::Value* size_in_bytes = builder->CreateMul(
+                    builder->CreateSExt(array_size, llvm::Type::getInt64Ty(context)),
+                    llvm::ConstantInt::get(context, llvm::APInt(64, size)));
                 llvm::Value* ptr_i8 = LLVMArrUtils::lfortran_malloc(
-                    context, *module, *builder, array_size);
+                    context, *module, *builder, size_in_bytes);
                 heap_arrays.push_back(ptr_i8);
                 ptr = builder->CreateBitCast(ptr_i8, type->getPointerTo());
             } else {
@@ -4383,6 +4427,15 @@ public:
                     std::string arg_s = arg->m_name;
                     llvm_arg.setName(arg_s);
                     llvm_symtab[h] = llvm_sym;
+                    if (emit_alias_info() && llvm_arg.getType()->isPointerTy() &&
+                            is_noalias_dummy(x, *arg)) {
+                        llvm_arg.addAttr(llvm::Attribute::NoAlias);
+                        if (ASRUtils::is_array(arg->m_type) &&
+                                ASRUtils::extract_physical_type(arg->m_type) ==
+                                ASR::array_physical_typeType::DescriptorArray) {
+                            noalias_descriptor_args[&F].push_back(llvm_arg.getArgNo());
+                        }
+                    }
 #if LLVM_VERSION_MAJOR > 16
                     llvm::Type *arg_type = llvm_utils->get_type_from_ttype_t_util(
                         ASRUtils::type_get_past_allocatable(
@@ -4903,6 +4956,7 @@ public:
 
 
     void visit_CPtrToPointer(const ASR::CPtrToPointer_t& x) {
+        type_punning = true;
         ASR::expr_t *cptr = x.m_cptr, *fptr = x.m_ptr, *shape = x.m_shape;
         int reduce_loads = 0;
         if( ASR::is_a<ASR::Var_t>(*cptr) ) {
@@ -5466,6 +5520,87 @@ public:
         this->visit_expr(*x.m_overloaded);
     }
 
+    static ASR::expr_t* get_past_string_physical_cast(ASR::expr_t* x) {
+        while (ASR::is_a<ASR::StringPhysicalCast_t>(*x)) {
+            x = ASR::down_cast<ASR::StringPhysicalCast_t>(x)->m_arg;
+        }
+        return x;
+    }
+
+    /*
+     * Appends in place for `s = s // a // b ...` with an allocatable `s`,
+     * instead of building the concatenation in a temporary and copying it
+     * back. The capacity of `s` grows geometrically, so a loop of appends is
+     * linear in the final length. Returns false if `x` is not of that form.
+     */
+    bool handle_string_append_Assignment(const ASR::Assignment_t &x) {
+        if (!ASR::is_a<ASR::Var_t>(*x.m_target) ||
+            !ASRUtils::is_descriptorString(ASRUtils::expr_type(x.m_target)) ||
+            !ASRUtils::is_allocatable(x.m_target) ) {
+            return false;
+        }
+        ASR::symbol_t* target_sym = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(x.m_target)->m_v);
+        if (!ASR::is_a<ASR::Variable_t>(*target_sym)) {
+            return false;
+        }
+        uint32_t h = get_hash((ASR::asr_t*)ASR::down_cast<ASR::Variable_t>(target_sym));
+        if (llvm_symtab.find(h) == llvm_symtab.end()) {
+            return false;
+        }
+        // Collect the right operands of the left-nested concatenations
+        std::vector<ASR::expr_t*> pieces;
+        ASR::expr_t* left = get_past_string_physical_cast(x.m_value);
+        while (ASR::is_a<ASR::StringConcat_t>(*left) &&
+                ASR::down_cast<ASR::StringConcat_t>(left)->m_value == nullptr) {
+            ASR::StringConcat_t* concat = ASR::down_cast<ASR::StringConcat_t>(left);
+            pieces.push_back(concat->m_right);
+            left = get_past_string_physical_cast(concat->m_left);
+        }
+        if (pieces.empty() || !ASR::is_a<ASR::Var_t>(*left) ||
+            ASRUtils::symbol_get_past_external(
+                ASR::down_cast<ASR::Var_t>(left)->m_v) != target_sym) {
+            return false;
+        }
+        std::reverse(pieces.begin(), pieces.end());
+
+        // In the entry block: the append is usually in a loop
+        llvm::Value* llvm_pieces = llvm_utils->CreateAlloca(character_type,
+            llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), pieces.size()));
+        int ptr_loads_copy = ptr_loads;
+        for (size_t i = 0; i < pieces.size(); i++) {
+            ptr_loads = 2 - LLVM::is_llvm_pointer(*ASRUtils::expr_type(pieces[i]));
+            this->visit_expr_wrapper(pieces[i], true);
+            builder->CreateStore(tmp, llvm_utils->create_ptr_gep2(character_type,
+                llvm_pieces, i));
+        }
+        ptr_loads = ptr_loads_copy;
+
+        llvm::Value* dest = llvm_symtab[h];
+        std::string runtime_func_name = "_lfortran_str_append_descriptor_string";
+        llvm::Function *fn = module->getFunction(runtime_func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                    llvm::Type::getVoidTy(context),
+                    {
+                        character_type->getPointerTo(),
+                        llvm::Type::getInt64Ty(context)->getPointerTo(),
+                        llvm::Type::getInt64Ty(context)->getPointerTo(),
+                        llvm::Type::getInt32Ty(context),
+                        character_type->getPointerTo()
+                    }, false);
+            fn = llvm::Function::Create(function_type,
+                    llvm::Function::ExternalLinkage, runtime_func_name, *module);
+        }
+        builder->CreateCall(fn, {
+            llvm_utils->create_gep2(string_descriptor, dest, 0),
+            llvm_utils->create_gep2(string_descriptor, dest, 1),
+            llvm_utils->create_gep2(string_descriptor, dest, 2),
+            llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), pieces.size()),
+            llvm_pieces});
+        return true;
+    }
+
     void visit_Assignment(const ASR::Assignment_t &x) {
         if (compiler_options.emit_debug_info) debug_emit_loc(x);
         if( x.m_overloaded ) {
@@ -5503,6 +5638,9 @@ public:
             }
             return;
         }
+        if (handle_string_append_Assignment(x)) {
+            return;
+        }
         if( is_target_list && is_value_list ) {
             int64_t ptr_loads_copy = ptr_loads;
             ptr_loads = 0;
@@ -7319,13 +7457,21 @@ public:
         llvm::Value *right_val = tmp;
         LCOMPILERS_ASSERT(ASRUtils::is_integer(*x.m_type) ||
             ASRUtils::is_unsigned_integer(*x.m_type))
+        // Stepping a variable by a constant, as DO loops do, cannot overflow
+        // in a conforming program. Telling LLVM so lets it compute trip
+        // counts and vectorize the loops.
+        bool nsw = signed_int && compiler_options.po.fast && (
+            (ASR::is_a<ASR::Var_t>(*x.m_left) &&
+                ASR::is_a<ASR::IntegerConstant_t>(*x.m_right)) ||
+            (ASR::is_a<ASR::IntegerConstant_t>(*x.m_left) &&
+                ASR::is_a<ASR::Var_t>(*x.m_right)));
         switch (x.m_op) {
             case ASR::binopType::Add: {
-                tmp = builder->CreateAdd(left_val, right_val);
+                tmp = builder->CreateAdd(left_val, right_val, "", false, nsw);
                 break;
             };
             case ASR::binopType::Sub: {
-                tmp = builder->CreateSub(left_val, right_val);
+                tmp = builder->CreateSub(left_val, right_val, "", false, nsw);
                 break;
             };
             case ASR::binopType::Mul: {
@@ -8296,6 +8442,7 @@ public:
             return;
         }
 
+        type_punning = true;
         this->visit_expr_wrapper(x.m_source, true);
         llvm::Value* source = tmp;
         llvm::Type* source_type = llvm_utils->get_type_from_ttype_t_util(ASRUtils::expr_type(x.m_source), module.get());
@@ -8873,6 +9020,11 @@ public:
             this->visit_stmt(*x.m_overloaded);
             return ;
         }
+        if (x.m_id) {
+            // Asynchronous reads are done synchronously, the ID 0 is complete
+            store_transfer_id(x.m_id, llvm::ConstantInt::get(
+                llvm::Type::getInt64Ty(context), 0));
+        }
 
         llvm::Value *unit_val, *iostat, *read_size, *advance;
         bool is_string = false;
@@ -8915,7 +9067,7 @@ public:
             ptr_loads = ptr_copy;
             read_size = tmp;
         } else {
-            read_size = llvm_utils->CreateAlloca(*builder,
+            read_size = llvm_utils->CreateAlloca(
                         llvm::Type::getInt32Ty(context));
         }
 
@@ -8951,6 +9103,29 @@ public:
             }
             builder->CreateCall(fn, args);
         } else {
+            llvm::BasicBlock *read_end = nullptr;
+            if (x.m_iostat && !is_string && x.n_values > 0) {
+                // At the end of the file the items are skipped and IOSTAT=
+                // is set to -1, instead of the read aborting
+                std::string runtime_func_name = "_lfortran_list_read_eof";
+                llvm::Function *fn = module->getFunction(runtime_func_name);
+                if (!fn) {
+                    llvm::FunctionType *function_type = llvm::FunctionType::get(
+                            llvm::Type::getInt1Ty(context), {
+                                llvm::Type::getInt32Ty(context),
+                                llvm::Type::getInt32Ty(context)->getPointerTo()
+                            }, false);
+                    fn = llvm::Function::Create(function_type,
+                            llvm::Function::ExternalLinkage, runtime_func_name,
+                                *module);
+                }
+                llvm::Value *at_eof = builder->CreateCall(fn, {unit_val, iostat});
+                llvm::BasicBlock *read_items = llvm::BasicBlock::Create(context,
+                    "read_items", builder->GetInsertBlock()->getParent());
+                read_end = llvm::BasicBlock::Create(context, "read_end");
+                builder->CreateCondBr(at_eof, read_end, read_items);
+                builder->SetInsertPoint(read_items);
+            }
             llvm::Value* var_to_read_into = nullptr; // Var expression that we'll read into.
             for (size_t i=0; i<x.n_values; i++) {
                 int ptr_copy = ptr_loads;
@@ -9079,6 +9254,9 @@ public:
                             *module);
             }
             builder->CreateCall(fn, {unit_val, iostat});
+            if (read_end) {
+                start_new_block(read_end);
+            }
         }
     }
 
@@ -9227,6 +9405,27 @@ public:
                     llvm::Function::ExternalLinkage, runtime_func_name, *module);
         }
         tmp = builder->CreateCall(fn, {f_name, exist_val, unit, opened_val, size_val, pos_val});
+
+        if (x.m_pending) {
+            llvm::Value *id_val = load_transfer_id(x.m_id);
+            llvm::Function *pending_fn = module->getFunction("_lfortran_async_pending");
+            if (!pending_fn) {
+                llvm::FunctionType *function_type = llvm::FunctionType::get(
+                        llvm::Type::getInt1Ty(context), {
+                            llvm::Type::getInt32Ty(context),
+                            llvm::Type::getInt64Ty(context)
+                        }, false);
+                pending_fn = llvm::Function::Create(function_type,
+                        llvm::Function::ExternalLinkage, "_lfortran_async_pending", *module);
+            }
+            llvm::Value *pending = builder->CreateCall(pending_fn,
+                {llvm_utils->convert_kind(unit, llvm::Type::getInt32Ty(context)), id_val});
+            int ptr_loads_copy = ptr_loads;
+            ptr_loads = 0;
+            this->visit_expr_wrapper(x.m_pending, false);
+            ptr_loads = ptr_loads_copy;
+            builder->CreateStore(pending, tmp);
+        }
     }
 
     void visit_Flush(const ASR::Flush_t& x) {
@@ -9408,19 +9607,23 @@ public:
                 args.push_back(sep);
             }
             if (!x.m_is_formatted) {
+                // The length in bytes is 64-bit, records may exceed 2 GiB
                 int kind = ASRUtils::extract_kind_from_ttype_t(ASRUtils::extract_type(ASRUtils::expr_type(m_values[i])));
-                llvm::Value* kind_val = llvm::ConstantInt::get(context, llvm::APInt(32, kind, true));
+                llvm::Value* kind_val = llvm::ConstantInt::get(context, llvm::APInt(64, kind, true));
                 ASR::ttype_t *type32 = ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 4));
+                ASR::ttype_t *type64 = ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, 8));
                 if (ASRUtils::is_array(ASRUtils::expr_type(m_values[i]))) {
                     ASR::ArraySize_t* array_size = ASR::down_cast2<ASR::ArraySize_t>(ASR::make_ArraySize_t(al, m_values[i]->base.loc,
-                        m_values[i], nullptr, type32, nullptr));
+                        m_values[i], nullptr, type64, nullptr));
                     visit_ArraySize(*array_size);
-                    args.push_back(builder->CreateMul(kind_val, tmp));
+                    args.push_back(builder->CreateMul(kind_val,
+                        builder->CreateSExtOrTrunc(tmp, llvm::Type::getInt64Ty(context))));
                 } else if (ASRUtils::is_character(*ASRUtils::expr_type(m_values[i]))) {
                     ASR::StringLen_t * strlen = ASR::down_cast2<ASR::StringLen_t>(ASR::make_StringLen_t(al,
                         m_values[i]->base.loc, m_values[i], type32, nullptr));
                     visit_StringLen(*strlen);
-                    args.push_back(builder->CreateMul(kind_val, tmp));
+                    args.push_back(builder->CreateMul(kind_val,
+                        builder->CreateSExt(tmp, llvm::Type::getInt64Ty(context))));
                 } else {
                     args.push_back(kind_val);
                     if (ASRUtils::is_value_constant(m_values[i])) {
@@ -9437,7 +9640,7 @@ public:
                 x.base.base.loc);
         }
         if (!x.m_is_formatted) {  // give -1 argument for end of arguments
-            llvm::Value* minus_one = llvm::ConstantInt::get(context, llvm::APInt(32, -1, true));
+            llvm::Value* minus_one = llvm::ConstantInt::get(context, llvm::APInt(64, -1, true));
             args.push_back(minus_one);
         } else if (!is_string) {
             fmt.push_back("%s");
@@ -9467,7 +9670,84 @@ public:
             fn = llvm::Function::Create(function_type,
                     llvm::Function::ExternalLinkage, runtime_func_name, *module);
         }
+        bool is_async = x.m_id && !is_string;
+        if (is_async) {
+            llvm::Function *begin_fn = module->getFunction("_lfortran_async_begin");
+            if (!begin_fn) {
+                llvm::FunctionType *function_type = llvm::FunctionType::get(
+                        llvm::Type::getVoidTy(context), {
+                            llvm::Type::getInt32Ty(context)
+                        }, false);
+                begin_fn = llvm::Function::Create(function_type,
+                        llvm::Function::ExternalLinkage, "_lfortran_async_begin", *module);
+            }
+            builder->CreateCall(begin_fn, {unit});
+        }
         tmp = builder->CreateCall(fn, printf_args);
+        if (is_async) {
+            llvm::Function *end_fn = module->getFunction("_lfortran_async_end");
+            if (!end_fn) {
+                llvm::FunctionType *function_type = llvm::FunctionType::get(
+                        llvm::Type::getInt64Ty(context), {}, false);
+                end_fn = llvm::Function::Create(function_type,
+                        llvm::Function::ExternalLinkage, "_lfortran_async_end", *module);
+            }
+            store_transfer_id(x.m_id, builder->CreateCall(end_fn, {}));
+        } else if (x.m_id) {
+            store_transfer_id(x.m_id, llvm::ConstantInt::get(
+                llvm::Type::getInt64Ty(context), 0));
+        }
+    }
+
+    // Stores the ID of an asynchronous transfer (a 64-bit integer) to `id`
+    void store_transfer_id(ASR::expr_t* id, llvm::Value* value) {
+        int ptr_loads_copy = ptr_loads;
+        ptr_loads = 0;
+        this->visit_expr_wrapper(id, false);
+        ptr_loads = ptr_loads_copy;
+        llvm::Type* id_type = llvm_utils->get_type_from_ttype_t_util(
+            ASRUtils::extract_type(ASRUtils::expr_type(id)), module.get());
+        builder->CreateStore(builder->CreateSExtOrTrunc(value, id_type), tmp);
+    }
+
+    // The ID of an asynchronous transfer as a 64-bit integer, -1 if absent
+    llvm::Value* load_transfer_id(ASR::expr_t* id) {
+        if (!id) {
+            return llvm::ConstantInt::get(context, llvm::APInt(64, -1, true));
+        }
+        this->visit_expr_wrapper(id, true);
+        return builder->CreateSExtOrTrunc(tmp, llvm::Type::getInt64Ty(context));
+    }
+
+    void visit_FileWait(const ASR::FileWait_t &x) {
+        this->visit_expr_wrapper(x.m_unit, true);
+        llvm::Value *unit_val = llvm_utils->convert_kind(tmp,
+            llvm::Type::getInt32Ty(context));
+        llvm::Value *id_val = load_transfer_id(x.m_id);
+        llvm::Value *iostat;
+        if (x.m_iostat) {
+            int ptr_loads_copy = ptr_loads;
+            ptr_loads = 0;
+            this->visit_expr_wrapper(x.m_iostat, false);
+            ptr_loads = ptr_loads_copy;
+            iostat = tmp;
+        } else {
+            iostat = llvm::ConstantPointerNull::get(
+                llvm::Type::getInt32Ty(context)->getPointerTo());
+        }
+        std::string runtime_func_name = "_lfortran_wait";
+        llvm::Function *fn = module->getFunction(runtime_func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                    llvm::Type::getVoidTy(context), {
+                        llvm::Type::getInt32Ty(context),
+                        llvm::Type::getInt64Ty(context),
+                        llvm::Type::getInt32Ty(context)->getPointerTo()
+                    }, false);
+            fn = llvm::Function::Create(function_type,
+                    llvm::Function::ExternalLinkage, runtime_func_name, *module);
+        }
+        tmp = builder->CreateCall(fn, {unit_val, id_val, iostat});
     }
 
     std::string serialize_structType_symbols(ASR::StructType_t* x){
@@ -11662,10 +11942,22 @@ public:
     }
 
     void visit_StringFormat(const ASR::StringFormat_t& x) {
-        // TODO: Handle some things at compile time if possible:
-        //ASR::expr_t* fmt_value = ASRUtils::expr_value(x.m_fmt);
-        // if (fmt_value) ...
         if (x.m_kind == ASR::string_format_kindType::FormatFortran) {
+            // A constant format is parsed by the runtime only once, into a
+            // slot shared by all the uses of that format
+            llvm::GlobalVariable* format_cache = nullptr;
+            ASR::expr_t* fmt_value = x.m_fmt ? ASRUtils::expr_value(x.m_fmt) : nullptr;
+            if (fmt_value && ASR::is_a<ASR::StringConstant_t>(*fmt_value)) {
+                std::string fmt_str = ASR::down_cast<ASR::StringConstant_t>(fmt_value)->m_s;
+                format_cache = format_caches[fmt_str];
+                if (!format_cache) {
+                    llvm::PointerType* i8_ptr = llvm::Type::getInt8Ty(context)->getPointerTo();
+                    format_cache = new llvm::GlobalVariable(*module, i8_ptr, false,
+                        llvm::GlobalValue::PrivateLinkage,
+                        llvm::ConstantPointerNull::get(i8_ptr), "format_cache");
+                    format_caches[fmt_str] = format_cache;
+                }
+            }
             std::vector<llvm::Value *> args;
             // Push fmt string.
             if(x.m_fmt == nullptr){ // default formatting
@@ -11762,7 +12054,12 @@ public:
                 args.push_back(tmp);
                 ptr_loads = ptr_load_copy;
             }
-            tmp = string_format_fortran(context, *module, *builder, args);
+            if (format_cache) {
+                args.insert(args.begin(), format_cache);
+                tmp = string_format_fortran_cached(context, *module, *builder, args);
+            } else {
+                tmp = string_format_fortran(context, *module, *builder, args);
+            }
         } else {
             throw CodeGenError("Only FormatFortran string formatting implemented so far.");
         }
@@ -11810,6 +12107,11 @@ Result<std::unique_ptr<LLVMModule>> asr_to_llvm(ASR::TranslationUnit_t &asr,
     co.po.always_run = false;
     co.po.skip_optimization_func_instantiation = skip_optimization_func_instantiation;
     pass_manager.rtlib = co.rtlib;
+    if (!co.generate_object_code) {
+        // The code of the used modules is generated here, so all their
+        // procedures are needed, also those only called from other languages
+        ASRUtils::load_all_module_symbols(asr);
+    }
     auto t1 = std::chrono::high_resolution_clock::now();
     pass_manager.apply_passes(al, &asr, co.po, diagnostics);
     auto t2 = std::chrono::high_resolution_clock::now();
@@ -11841,6 +12143,10 @@ Result<std::unique_ptr<LLVMModule>> asr_to_llvm(ASR::TranslationUnit_t &asr,
         Error error;
         return error;
     }
+    if (v.emit_alias_info()) {
+        annotate_alias_info(*v.module, v.noalias_descriptor_args,
+            v.type_punning);
+    }
     std::string msg;
     llvm::raw_string_ostream err(msg);
     if (llvm::verifyModule(*v.module, &err)) {
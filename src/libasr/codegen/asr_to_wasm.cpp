@@ -3280,6 +3280,16 @@ class ASRToWASMVisitor : public ASR::BaseVisitor<ASRToWASMVisitor> {
         throw CodeGenAbort();
     }
 
+    void visit_FileWait(const ASR::FileWait_t &x) {
+        // All transfers are synchronous on WebAssembly, so a WAIT has nothing
+        // to wait for and only its IOSTAT= would need to be set
+        if (x.m_iostat != nullptr || x.m_iomsg != nullptr) {
+            diag.codegen_error_label("iostat/iomsg in wait() is not implemented yet",
+                                     {x.base.base.loc}, "not implemented");
+            throw CodeGenAbort();
+        }
+    }
+
     void print_msg(std::string msg) {
         msg += "\n";
         emit_string(msg);
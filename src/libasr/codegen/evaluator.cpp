@@ -28,6 +28,19 @@
 #include <llvm/ADT/APFloat.h>
 #include <llvm/ADT/STLExtras.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/MC/MCSubtargetInfo.h>
+#include <llvm/Analysis/ModuleSummaryAnalysis.h>
+#include <llvm/Analysis/ProfileSummaryInfo.h>
+#include <llvm/BinaryFormat/Magic.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/ModuleSummaryIndex.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Threading.h>
+#if LLVM_VERSION_MAJOR >= 14
+#    include <llvm/LTO/LTO.h>
+#    include <llvm/Support/Caching.h>
+#endif
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Transforms/Scalar.h>
@@ -54,6 +67,8 @@
 #if LLVM_VERSION_MAJOR >= 17
     // TODO: removed from LLVM 17
     #include <llvm/Passes/PassBuilder.h>
+    #include <llvm/Analysis/LazyCallGraph.h>
+    #include <llvm/Analysis/LoopInfo.h>
 #else
 #    include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #endif
@@ -61,8 +76,16 @@
 #if LLVM_VERSION_MAJOR < 18
 #    include <llvm/Transforms/Vectorize.h>
 #    include <llvm/Support/Host.h>
+#else
+#    include <llvm/TargetParser/Host.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <map>
+#include <set>
+
 #include <libasr/codegen/KaleidoscopeJIT.h>
 #include <libasr/codegen/evaluator.h>
 #include <libasr/codegen/asr_to_llvm.h>
@@ -198,6 +221,21 @@ float _lfortran_stan(float x);
 }
 
 LLVMEvaluator::LLVMEvaluator(const std::string &t)
+{
+    initialize(t, "", -1);
+}
+
+LLVMEvaluator::LLVMEvaluator(const CompilerOptions &co)
+    : tune_cpu{co.mtune}, opt_level{co.opt_level < 0 ? 3 : co.opt_level},
+      size_level{co.size_level}, thin_lto_prelink{co.thin_lto_prelink},
+      time_functions{co.time_report}
+{
+    initialize(co.target, co.march, co.opt_level);
+}
+
+// `codegen_opt_level` is the `-O` level, -1 for the default of LLVM
+void LLVMEvaluator::initialize(const std::string &t, const std::string &cpu,
+        int codegen_opt_level)
 {
     llvm::InitializeNativeTarget();
     llvm::InitializeNativeTargetAsmPrinter();
@@ -237,11 +275,45 @@ LLVMEvaluator::LLVMEvaluator(const std::string &t)
     if (!target) {
         throw LCompilersException(Error);
     }
-    std::string CPU = "generic";
+    std::string CPU = cpu.empty() ? "generic" : cpu;
     std::string features = "";
+    if (cpu == "native") {
+        CPU = llvm::sys::getHostCPUName().str();
+#if LLVM_VERSION_MAJOR >= 19
+        llvm::StringMap<bool> host_features = llvm::sys::getHostCPUFeatures();
+#else
+        llvm::StringMap<bool> host_features;
+        llvm::sys::getHostCPUFeatures(host_features);
+#endif
+        for (auto &f : host_features) {
+            if (!features.empty()) features += ",";
+            features += (f.second ? "+" : "-") + f.first().str();
+        }
+    }
     llvm::TargetOptions opt;
     RM_OPTIONAL_TYPE<llvm::Reloc::Model> RM = llvm::Reloc::Model::PIC_;
-    TM = target->createTargetMachine(target_triple, CPU, features, opt, RM);
+#if LLVM_VERSION_MAJOR >= 18
+    using CodeGenOptLevel = llvm::CodeGenOptLevel;
+#else
+    using CodeGenOptLevel = llvm::CodeGenOpt::Level;
+#endif
+    CodeGenOptLevel OL = CodeGenOptLevel::Default;
+    if (codegen_opt_level == 0) {
+        OL = CodeGenOptLevel::None;
+    } else if (codegen_opt_level == 1) {
+        OL = CodeGenOptLevel::Less;
+    } else if (codegen_opt_level == 3) {
+        OL = CodeGenOptLevel::Aggressive;
+    }
+    TM = target->createTargetMachine(target_triple, CPU, features, opt, RM,
+        {}, OL);
+    for (const std::string &c : {CPU, tune_cpu}) {
+        if (!c.empty() && c != "generic"
+                && !TM->getMCSubtargetInfo()->isCPUStringValid(c)) {
+            throw LCompilersException("The CPU '" + c
+                + "' is not supported by the target " + target_triple);
+        }
+    }
 
     // For some reason the JIT requires a different TargetMachine
     jit = cantFail(llvm::orc::KaleidoscopeJIT::Create());
@@ -251,6 +323,8 @@ LLVMEvaluator::LLVMEvaluator(const std::string &t)
 
 LLVMEvaluator::~LLVMEvaluator()
 {
+    // The resource trackers refer to the JIT
+    tiered.reset();
     jit.reset();
     context.reset();
 }
@@ -315,6 +389,242 @@ void LLVMEvaluator::add_module(std::unique_ptr<LLVMModule> m) {
     add_module(std::move(m->m_m));
 }
 
+// A module loaded by add_module_tiered()
+struct JITCell {
+#if LLVM_VERSION_MAJOR >= 12
+    llvm::orc::ResourceTrackerSP tracker;
+#endif
+    // The module as generated, to load it again
+    std::string ir;
+    // Global call counter of the functions defined by the module, or ""
+    std::string counter;
+    // Non-local symbols defined (other than the run function) and declared
+    std::set<std::string> defined;
+    std::set<std::string> referenced;
+    // Defines variables, whose values would be lost by loading it again
+    bool has_state = false;
+    // Promoting it would need to reload a module with state
+    bool pinned = false;
+    int tier = 0;
+};
+
+class TieredSession {
+public:
+    std::list<JITCell> cells;
+    size_t n_counters = 0;
+    size_t released = 0;
+    size_t promoted = 0;
+};
+
+namespace {
+
+    void analyze_cell(llvm::Module &m, const std::string &run_fn,
+            JITCell &cell) {
+        for (llvm::GlobalValue &gv : m.global_values()) {
+            if (!gv.hasName() || gv.getName() == run_fn) continue;
+            if (gv.isDeclaration()) {
+                cell.referenced.insert(gv.getName().str());
+            } else if (!gv.hasLocalLinkage()) {
+                cell.defined.insert(gv.getName().str());
+            }
+        }
+        for (llvm::GlobalVariable &gv : m.globals()) {
+            if (!gv.isDeclaration() && !gv.isConstant()) {
+                cell.has_state = true;
+            }
+        }
+    }
+
+    // Counts the calls of the non-local functions of `m` in `counter`
+    void instrument_calls(llvm::Module &m, const JITCell &cell) {
+        llvm::Type *i64 = llvm::Type::getInt64Ty(m.getContext());
+        llvm::GlobalVariable *counter = new llvm::GlobalVariable(m, i64,
+            false, llvm::GlobalValue::ExternalLinkage,
+            llvm::ConstantInt::get(i64, 0), cell.counter);
+        for (llvm::Function &f : m) {
+            if (f.isDeclaration() || f.hasLocalLinkage()
+                    || cell.defined.find(f.getName().str()) == cell.defined.end()) {
+                continue;
+            }
+            llvm::IRBuilder<> builder(&*f.getEntryBlock().getFirstInsertionPt());
+            llvm::Value *n = builder.CreateLoad(i64, counter);
+            builder.CreateStore(builder.CreateAdd(n,
+                llvm::ConstantInt::get(i64, 1)), counter);
+        }
+    }
+
+    std::string error_to_string(llvm::Error err) {
+        llvm::SmallVector<char, 128> buf;
+        llvm::raw_svector_ostream dest(buf);
+        llvm::logAllUnhandledErrors(std::move(err), dest, "");
+        std::string msg = std::string(dest.str().data(), dest.str().size());
+        if (!msg.empty() && msg[msg.size()-1] == '\n') msg = msg.substr(0, msg.size()-1);
+        return msg;
+    }
+
+    // The cells that call into `cells` (directly or not), excluding them
+    std::vector<JITCell*> dependents(std::list<JITCell> &all,
+            const std::vector<JITCell*> &cells) {
+        std::set<JITCell*> group(cells.begin(), cells.end());
+        std::set<std::string> names;
+        for (JITCell *c : cells) names.insert(c->defined.begin(), c->defined.end());
+        std::vector<JITCell*> result;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (JITCell &c : all) {
+                if (group.count(&c)) continue;
+                for (const std::string &name : c.referenced) {
+                    if (names.count(name)) {
+                        group.insert(&c);
+                        result.push_back(&c);
+                        names.insert(c.defined.begin(), c.defined.end());
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+} // namespace
+
+#if LLVM_VERSION_MAJOR >= 12
+
+// Compiles `m` at the tier of `cell` and adds it under a new tracker
+static void load_cell(llvm::orc::KaleidoscopeJIT &jit,
+        std::unique_ptr<llvm::LLVMContext> &context, LLVMEvaluator &e,
+        JITCell &cell, std::unique_ptr<llvm::Module> m) {
+    if (cell.tier > 0) {
+        e.opt(*m);
+    } else if (!cell.counter.empty()) {
+        instrument_calls(*m, cell);
+    }
+    cell.tracker = jit.createResourceTracker();
+    llvm::Error err = jit.addModule(std::move(m), context, cell.tracker);
+    if (err) {
+        throw LCompilersException("addModule() returned an error: "
+            + error_to_string(std::move(err)));
+    }
+}
+
+static void unload_cell(JITCell &cell) {
+    llvm::Error err = cell.tracker->remove();
+    if (err) {
+        throw LCompilersException("Failed to unload a JIT module: "
+            + error_to_string(std::move(err)));
+    }
+    cell.tracker = nullptr;
+}
+
+void LLVMEvaluator::add_module_tiered(std::unique_ptr<llvm::Module> mod,
+        const std::string &run_fn) {
+    if (!tiered) tiered = std::make_unique<TieredSession>();
+    mod->setTargetTriple(target_triple);
+    mod->setDataLayout(jit->getDataLayout());
+    JITCell cell;
+    analyze_cell(*mod, run_fn, cell);
+    if (!cell.defined.empty() && !cell.has_state) {
+        cell.ir = module_to_string(*mod);
+        cell.counter = "__lfortran_jit_calls_"
+            + std::to_string(tiered->n_counters++);
+    }
+
+    // Unload the modules whose symbols are all redefined, unless a module
+    // that calls them has state (then addModule() reports the duplicates)
+    std::vector<JITCell*> replaced;
+    for (JITCell &c : tiered->cells) {
+        if (!c.defined.empty() && std::includes(cell.defined.begin(),
+                cell.defined.end(), c.defined.begin(), c.defined.end())) {
+            replaced.push_back(&c);
+        }
+    }
+    std::vector<JITCell*> relink = dependents(tiered->cells, replaced);
+    bool can_relink = std::none_of(relink.begin(), relink.end(),
+        [](JITCell *c) { return c->has_state; });
+    if (!replaced.empty() && can_relink) {
+        for (JITCell *c : relink) unload_cell(*c);
+        for (JITCell *c : replaced) unload_cell(*c);
+        tiered->cells.remove_if([&](const JITCell &c) {
+            return std::find(replaced.begin(), replaced.end(), &c)
+                != replaced.end();
+        });
+        tiered->released += replaced.size();
+    }
+
+    tiered->cells.push_back(std::move(cell));
+    load_cell(*jit, context, *this, tiered->cells.back(), std::move(mod));
+    if (!replaced.empty() && can_relink) {
+        // Link the callers of the replaced symbols to the new definitions
+        for (JITCell &c : tiered->cells) {
+            if (!c.tracker) load_cell(*jit, context, *this, c, parse_module(c.ir));
+        }
+    }
+}
+
+void LLVMEvaluator::end_cell(int64_t hot_calls) {
+    if (!tiered) return;
+    // Nobody can call a run function again
+    for (JITCell &c : tiered->cells) {
+        if (c.defined.empty()) {
+            unload_cell(c);
+            tiered->released++;
+        }
+    }
+    tiered->cells.remove_if([](const JITCell &c) { return !c.tracker; });
+
+    for (JITCell &c : tiered->cells) {
+        if (c.tier > 0 || c.counter.empty() || c.pinned) continue;
+        int64_t *calls = (int64_t*)get_symbol_address(c.counter);
+        if (*calls < hot_calls) continue;
+        std::vector<JITCell*> relink = dependents(tiered->cells, {&c});
+        if (std::any_of(relink.begin(), relink.end(),
+                [](JITCell *d) { return d->has_state; })) {
+            c.pinned = true;
+            continue;
+        }
+        for (JITCell *d : relink) unload_cell(*d);
+        unload_cell(c);
+        c.tier = 1;
+        load_cell(*jit, context, *this, c, parse_module(c.ir));
+        // Compile it now rather than on its next call
+        get_symbol_address(*c.defined.begin());
+        for (JITCell *d : relink) {
+            load_cell(*jit, context, *this, *d, parse_module(d->ir));
+        }
+        tiered->promoted++;
+    }
+}
+
+#else
+
+void LLVMEvaluator::add_module_tiered(std::unique_ptr<llvm::Module> mod,
+        const std::string &/*run_fn*/) {
+    // Resource trackers need LLVM 12
+    if (!tiered) tiered = std::make_unique<TieredSession>();
+    add_module(std::move(mod));
+}
+
+void LLVMEvaluator::end_cell(int64_t /*hot_calls*/) {
+}
+
+#endif
+
+void LLVMEvaluator::add_module_tiered(std::unique_ptr<LLVMModule> m,
+        const std::string &run_fn) {
+    add_module_tiered(std::move(m->m_m), run_fn);
+}
+
+LLVMEvaluator::JITStats LLVMEvaluator::get_jit_stats() {
+    JITStats stats;
+    stats.memory = jit->getMemoryUsage();
+    stats.modules = tiered ? tiered->cells.size() : 0;
+    stats.released = tiered ? tiered->released : 0;
+    stats.promoted = tiered ? tiered->promoted : 0;
+    return stats;
+}
+
 intptr_t LLVMEvaluator::get_symbol_address(const std::string &name) {
 #if LLVM_VERSION_MAJOR < 17
     llvm::Expected<llvm::JITEvaluatedSymbol>
@@ -358,6 +668,7 @@ void write_file(const std::string &filename, const std::string &contents)
 
 std::string LLVMEvaluator::get_asm(llvm::Module &m)
 {
+    set_function_attributes(m);
     llvm::legacy::PassManager pass;
 #if LLVM_VERSION_MAJOR < 18
     llvm::CodeGenFileType ft = llvm::CGFT_AssemblyFile;
@@ -381,6 +692,7 @@ void LLVMEvaluator::save_asm_file(llvm::Module &m, const std::string &filename)
 void LLVMEvaluator::save_object_file(llvm::Module &m, const std::string &filename) {
     m.setTargetTriple(target_triple);
     m.setDataLayout(TM->createDataLayout());
+    set_function_attributes(m);
 
     llvm::legacy::PassManager pass;
 #if LLVM_VERSION_MAJOR < 18
@@ -406,50 +718,315 @@ void LLVMEvaluator::create_empty_object_file(const std::string &filename) {
     save_object_file(*module, filename);
 }
 
+void LLVMEvaluator::save_bitcode_file(llvm::Module &m, const std::string &filename) {
+    m.setTargetTriple(target_triple);
+    m.setDataLayout(TM->createDataLayout());
+    set_function_attributes(m);
+
+    std::error_code EC;
+    llvm::raw_fd_ostream dest(filename, EC, llvm::sys::fs::OF_None);
+    if (EC) {
+        throw std::runtime_error("raw_fd_ostream failed");
+    }
+    // The summary tells the ThinLTO link what each function calls and
+    // references, so that it can decide what to import from where
+    llvm::ProfileSummaryInfo PSI(m);
+    llvm::ModuleSummaryIndex index = llvm::buildModuleSummaryIndex(m, nullptr,
+        &PSI);
+    llvm::WriteBitcodeToFile(m, dest, false, &index);
+    dest.flush();
+}
+
+bool LLVMEvaluator::is_bitcode_file(const std::string &filename) {
+    llvm::file_magic magic;
+    return !llvm::identify_magic(filename, magic)
+        && magic == llvm::file_magic::bitcode;
+}
+
+std::vector<std::string> LLVMEvaluator::thin_lto_link(
+        const std::vector<std::string> &bitcode_files,
+        const std::vector<std::string> &native_files, bool shared,
+        const std::string &output_prefix) {
+#if LLVM_VERSION_MAJOR >= 14
+    // The symbols that the other objects use must stay visible to them
+    std::set<std::string> referenced = {"main", "_main"};
+    for (const std::string &file : native_files) {
+        llvm::Expected<llvm::object::OwningBinary<llvm::object::ObjectFile>>
+            obj = llvm::object::ObjectFile::createObjectFile(file);
+        if (!obj) {
+            // Libraries and scripts are left to the linker
+            llvm::consumeError(obj.takeError());
+            continue;
+        }
+        for (const llvm::object::SymbolRef &sym : obj->getBinary()->symbols()) {
+            llvm::Expected<uint32_t> flags = sym.getFlags();
+            if (!flags) {
+                llvm::consumeError(flags.takeError());
+                continue;
+            }
+            if (!(*flags & llvm::object::SymbolRef::SF_Undefined)) continue;
+            llvm::Expected<llvm::StringRef> name = sym.getName();
+            if (!name) {
+                llvm::consumeError(name.takeError());
+                continue;
+            }
+            referenced.insert(name->str());
+        }
+    }
+
+    llvm::lto::Config conf;
+    conf.CPU = TM->getTargetCPU().str();
+    llvm::SmallVector<llvm::StringRef, 32> features;
+    TM->getTargetFeatureString().split(features, ',', -1, false);
+    for (llvm::StringRef f : features) conf.MAttrs.push_back(f.str());
+    conf.Options = TM->Options;
+    conf.RelocModel = llvm::Reloc::Model::PIC_;
+    conf.CGOptLevel = TM->getOptLevel();
+    conf.OptLevel = size_level > 0 ? 2 : opt_level;
+    conf.DefaultTriple = target_triple;
+    llvm::lto::LTO lto(std::move(conf), llvm::lto::createInProcessThinBackend(
+        llvm::heavyweight_hardware_concurrency()));
+
+    // The inputs refer to their buffers until the link is done
+    std::vector<std::unique_ptr<llvm::MemoryBuffer>> buffers;
+    std::set<std::string> defined;
+    for (const std::string &file : bitcode_files) {
+        llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer
+            = llvm::MemoryBuffer::getFile(file);
+        if (!buffer) {
+            throw LCompilersException("Cannot read '" + file + "': "
+                + buffer.getError().message());
+        }
+        llvm::Expected<std::unique_ptr<llvm::lto::InputFile>> input
+            = llvm::lto::InputFile::create((*buffer)->getMemBufferRef());
+        if (!input) {
+            throw LCompilersException("Cannot read '" + file + "': "
+                + error_to_string(input.takeError()));
+        }
+        // The first definition of a symbol is the one that is kept, and
+        // the symbols that nothing outside the bitcode refers to become
+        // internal, so that they can be inlined and removed
+        std::vector<llvm::lto::SymbolResolution> resolutions;
+        for (const llvm::lto::InputFile::Symbol &sym : (*input)->symbols()) {
+            llvm::lto::SymbolResolution r;
+            if (!sym.isUndefined()) {
+                std::string name = sym.getName().str();
+                r.Prevailing = defined.insert(name).second;
+                r.VisibleToRegularObj = shared || sym.isUsed()
+                    || referenced.count(name) > 0;
+                r.FinalDefinitionInLinkageUnit = r.Prevailing && !shared;
+            }
+            resolutions.push_back(r);
+        }
+        llvm::Error err = lto.add(std::move(*input), resolutions);
+        if (err) {
+            throw LCompilersException("Cannot link '" + file + "': "
+                + error_to_string(std::move(err)));
+        }
+        buffers.push_back(std::move(*buffer));
+    }
+
+    // Each task writes its own object, possibly on its own thread. Newer
+    // LLVM also passes the module name, which is not needed.
+    std::vector<std::string> outputs(lto.getMaxTasks());
+    auto add_stream = [&](unsigned task, const auto &...)
+            -> llvm::Expected<std::unique_ptr<llvm::CachedFileStream>> {
+        outputs[task] = output_prefix + "." + std::to_string(task) + ".o";
+        std::error_code EC;
+        auto os = std::make_unique<llvm::raw_fd_ostream>(outputs[task], EC,
+            llvm::sys::fs::OF_None);
+        if (EC) {
+            return llvm::errorCodeToError(EC);
+        }
+        return std::make_unique<llvm::CachedFileStream>(std::move(os));
+    };
+    llvm::Error err = lto.run(add_stream);
+    if (err) {
+        throw LCompilersException("ThinLTO failed: "
+            + error_to_string(std::move(err)));
+    }
+    std::vector<std::string> objects;
+    for (std::string &output : outputs) {
+        if (!output.empty()) objects.push_back(output);
+    }
+    return objects;
+#else
+    (void)bitcode_files; (void)native_files; (void)shared; (void)output_prefix;
+    throw LCompilersException("ThinLTO requires LLVM 14 or newer");
+#endif
+}
+
+namespace {
+
+    // Time spent by the passes on each function. Passes nest (a module pass
+    // runs function passes, which run loop passes), so each pass is only
+    // charged the time that its nested passes did not take.
+    class FunctionOptTimer {
+        using clock = std::chrono::steady_clock;
+        struct Pass {
+            std::string function;
+            clock::time_point start;
+            int64_t nested = 0;
+        };
+        std::vector<Pass> running;
+        std::map<std::string, int64_t> ns;
+
+    public:
+        void begin(const std::string &function) {
+            running.push_back({function, clock::now()});
+        }
+
+        void end() {
+            if (running.empty()) return;
+            Pass pass = std::move(running.back());
+            running.pop_back();
+            int64_t t = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                clock::now() - pass.start).count();
+            ns[pass.function] += t - pass.nested;
+            if (!running.empty()) running.back().nested += t;
+        }
+
+        // Microseconds per function, the slowest first
+        std::vector<std::pair<std::string, int64_t>> times() const {
+            std::vector<std::pair<std::string, int64_t>> result;
+            for (auto &f : ns) result.push_back({f.first, f.second / 1000});
+            std::stable_sort(result.begin(), result.end(),
+                [](const auto &a, const auto &b) { return a.second > b.second; });
+            return result;
+        }
+    };
+
+#if LLVM_VERSION_MAJOR >= 17
+    // The function a pass runs on, or "" for a module or several functions
+    std::string pass_function(const llvm::Any &IR) {
+        if (auto F = llvm::any_cast<const llvm::Function *>(&IR)) {
+            return (*F)->getName().str();
+        }
+        if (auto L = llvm::any_cast<const llvm::Loop *>(&IR)) {
+            return (*L)->getHeader()->getParent()->getName().str();
+        }
+        if (auto C = llvm::any_cast<const llvm::LazyCallGraph::SCC *>(&IR)) {
+            if ((*C)->size() == 1) {
+                return (*C)->begin()->getFunction().getName().str();
+            }
+        }
+        return "";
+    }
+#endif
+
+} // namespace
+
+// The CPU to tune for, unless the frontend already chose one
+void LLVMEvaluator::set_function_attributes(llvm::Module &m) {
+#if LLVM_VERSION_MAJOR >= 12
+    if (tune_cpu.empty()) return;
+    for (llvm::Function &F : m) {
+        if (!F.isDeclaration() && !F.hasFnAttribute("tune-cpu")) {
+            F.addFnAttr("tune-cpu", tune_cpu);
+        }
+    }
+#else
+    (void)m;
+#endif
+}
+
 void LLVMEvaluator::opt(llvm::Module &m) {
     m.setTargetTriple(target_triple);
     m.setDataLayout(TM->createDataLayout());
+    set_function_attributes(m);
+    FunctionOptTimer timer;
 
 #if LLVM_VERSION_MAJOR >= 17
+    llvm::PassInstrumentationCallbacks PIC;
+    if (time_functions) {
+        PIC.registerBeforeNonSkippedPassCallback(
+            [&timer](llvm::StringRef, llvm::Any IR) {
+                timer.begin(pass_function(IR));
+            });
+        PIC.registerAfterPassCallback(
+            [&timer](llvm::StringRef, llvm::Any, const llvm::PreservedAnalyses &) {
+                timer.end();
+            });
+        PIC.registerAfterPassInvalidatedCallback(
+            [&timer](llvm::StringRef, const llvm::PreservedAnalyses &) {
+                timer.end();
+            });
+    }
     llvm::LoopAnalysisManager LAM;
     llvm::FunctionAnalysisManager FAM;
     llvm::CGSCCAnalysisManager CGAM;
     llvm::ModuleAnalysisManager MAM;
-    llvm::PassBuilder PB = llvm::PassBuilder(TM);
+    llvm::PassBuilder PB = llvm::PassBuilder(TM, llvm::PipelineTuningOptions(),
+        std::nullopt, &PIC);
     PB.registerModuleAnalyses(MAM);
     PB.registerCGSCCAnalyses(CGAM);
     PB.registerFunctionAnalyses(FAM);
     PB.registerLoopAnalyses(LAM);
     PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
-    llvm::ModulePassManager MPM = PB.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3);
+    llvm::OptimizationLevel level = llvm::OptimizationLevel::O3;
+    if (size_level == 1) {
+        level = llvm::OptimizationLevel::Os;
+    } else if (size_level == 2) {
+        level = llvm::OptimizationLevel::Oz;
+    } else if (opt_level == 0) {
+        level = llvm::OptimizationLevel::O0;
+    } else if (opt_level == 1) {
+        level = llvm::OptimizationLevel::O1;
+    } else if (opt_level == 2) {
+        level = llvm::OptimizationLevel::O2;
+    }
+    llvm::ModulePassManager MPM;
+    if (level == llvm::OptimizationLevel::O0) {
+        MPM = PB.buildO0DefaultPipeline(level);
+    } else if (thin_lto_prelink) {
+        MPM = PB.buildThinLTOPreLinkDefaultPipeline(level);
+    } else {
+        MPM = PB.buildPerModuleDefaultPipeline(level);
+    }
     MPM.run(m, MAM);
 
 #else
+    // The legacy pass manager only times the function passes per function
     llvm::legacy::PassManager mpm;
     mpm.add(new llvm::TargetLibraryInfoWrapperPass(TM->getTargetTriple()));
     mpm.add(llvm::createTargetTransformInfoWrapperPass(TM->getTargetIRAnalysis()));
     llvm::legacy::FunctionPassManager fpm(&m);
     fpm.add(llvm::createTargetTransformInfoWrapperPass(TM->getTargetIRAnalysis()));
-    int optLevel = 3;
-    int sizeLevel = 0;
+    int optLevel = size_level > 0 ? 2 : opt_level;
+    int sizeLevel = size_level;
+    // The same choices as Clang
     llvm::PassManagerBuilder builder;
     builder.OptLevel = optLevel;
     builder.SizeLevel = sizeLevel;
-    builder.Inliner = llvm::createFunctionInliningPass(optLevel, sizeLevel,
-        false);
-    builder.DisableUnrollLoops = false;
-    builder.LoopVectorize = true;
-    builder.SLPVectorize = true;
+    if (optLevel > 1) {
+        builder.Inliner = llvm::createFunctionInliningPass(optLevel, sizeLevel,
+            false);
+    } else {
+        builder.Inliner = llvm::createAlwaysInlinerLegacyPass();
+    }
+    builder.DisableUnrollLoops = optLevel == 0;
+    builder.LoopVectorize = optLevel > 1 && sizeLevel < 2;
+    builder.SLPVectorize = optLevel > 1 && sizeLevel < 2;
+    builder.PrepareForThinLTO = thin_lto_prelink;
     builder.populateFunctionPassManager(fpm);
     builder.populateModulePassManager(mpm);
     fpm.doInitialization();
     for (llvm::Function &func : m) {
+        if (time_functions) timer.begin(func.getName().str());
         fpm.run(func);
+        if (time_functions) timer.end();
     }
     fpm.doFinalization();
     mpm.add(llvm::createVerifierPass());
+    if (time_functions) timer.begin("");
     mpm.run(m);
+    if (time_functions) timer.end();
 #endif
+    function_opt_times = timer.times();
+}
+
+const std::vector<std::pair<std::string, int64_t>> &LLVMEvaluator::get_function_opt_times() {
+    return function_opt_times;
 }
 
 std::string LLVMEvaluator::module_to_string(llvm::Module &m) {
@@ -4,6 +4,7 @@
 #include <complex>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include <libasr/alloc.h>
 #include <libasr/asr_scopes.h>
@@ -60,6 +61,8 @@ public:
     void mlir_to_llvm(llvm::LLVMContext &ctx);
 };
 
+class TieredSession;
+
 class LLVMEvaluator
 {
 private:
@@ -67,20 +70,84 @@ private:
     std::unique_ptr<llvm::LLVMContext> context;
     std::string target_triple;
     llvm::TargetMachine *TM;
+    std::unique_ptr<TieredSession> tiered;
+    std::string tune_cpu;
+    int opt_level = 3;
+    int size_level = 0;
+    bool thin_lto_prelink = false;
+    bool time_functions = false;
+    std::vector<std::pair<std::string, int64_t>> function_opt_times;
+    void initialize(const std::string &t, const std::string &cpu,
+        int codegen_opt_level);
+    void set_function_attributes(llvm::Module &m);
 public:
+    struct JITStats {
+        size_t memory;      // Bytes of code and data loaded in the JIT
+        size_t modules;     // Modules currently loaded by add_module_tiered()
+        size_t released;    // Modules unloaded after they were run or replaced
+        size_t promoted;    // Modules recompiled at O3
+    };
+
     LLVMEvaluator(const std::string &t = "");
+    // Generates code for the target, `-march` and `-mtune` of `co`, and
+    // `opt()` runs the pipeline of its `-O` level (O3 if not given)
+    LLVMEvaluator(const CompilerOptions &co);
     ~LLVMEvaluator();
     std::unique_ptr<llvm::Module> parse_module(const std::string &source, const std::string &filename);
     std::unique_ptr<LLVMModule> parse_module2(const std::string &source, const std::string &filename);
     void add_module(const std::string &source);
     void add_module(std::unique_ptr<llvm::Module> mod);
     void add_module(std::unique_ptr<LLVMModule> m);
+    /*
+        Tiered compilation, used by the interactive evaluator. Each module
+        gets its own resource tracker and is compiled without optimizations,
+        with a call counter in every function it defines. `run_fn` is the
+        function that runs the input once.
+
+        `end_cell()` is called after `run_fn` has run. It unloads the modules
+        that define nothing else, and recompiles at O3 the modules whose
+        functions were called at least `hot_calls` times (together with the
+        modules that call them, which must be linked again). Modules that
+        define variables keep their state, so they are never recompiled.
+
+        A module that redefines all the symbols of an earlier one replaces
+        it, and the earlier one is unloaded.
+    */
+    void add_module_tiered(std::unique_ptr<llvm::Module> mod,
+        const std::string &run_fn);
+    void add_module_tiered(std::unique_ptr<LLVMModule> m,
+        const std::string &run_fn);
+    void end_cell(int64_t hot_calls);
+    JITStats get_jit_stats();
     intptr_t get_symbol_address(const std::string &name);
     std::string get_asm(llvm::Module &m);
     void save_asm_file(llvm::Module &m, const std::string &filename);
     void save_object_file(llvm::Module &m, const std::string &filename);
     void create_empty_object_file(const std::string &filename);
+    // Saves `m` as LLVM bitcode with a ThinLTO summary, for `thin_lto_link()`
+    void save_bitcode_file(llvm::Module &m, const std::string &filename);
+    static bool is_bitcode_file(const std::string &filename);
+    /*
+        Optimizes and compiles the files written by `save_bitcode_file()`
+        together with the ThinLTO backend, on all cores, and returns the
+        object files it wrote (`output_prefix`.N.o). Procedures are imported
+        and inlined across the files. The symbols that none of the
+        `native_files` refer to become internal, unless the result is a
+        `shared` library.
+    */
+    std::vector<std::string> thin_lto_link(
+        const std::vector<std::string> &bitcode_files,
+        const std::vector<std::string> &native_files, bool shared,
+        const std::string &output_prefix);
     void opt(llvm::Module &m);
+    /*
+        Microseconds the last `opt()` spent on each function, the slowest
+        first, if the evaluator was created with `--time-report`. Passes over
+        the whole module or over several functions at once (global
+        optimizations, the inliner on recursive functions, ...) are reported
+        under the empty name.
+    */
+    const std::vector<std::pair<std::string, int64_t>> &get_function_opt_times();
     static std::string module_to_string(llvm::Module &m);
     static void print_version_message();
     static std::string llvm_version();
@@ -0,0 +1,182 @@
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/MDBuilder.h>
+#include <llvm/IR/Operator.h>
+
+#include <libasr/codegen/llvm_alias_info.h>
+
+namespace LCompilers {
+
+    namespace {
+
+        // `%array`, `%array_call` and `%dimension_descriptor` of
+        // `LLVMArrUtils::SimpleCMODescriptor`. LLVM appends `.N` to the name
+        // of a struct created with a name that is already taken.
+        bool is_descriptor_type(llvm::Type *t) {
+            llvm::StructType *st = llvm::dyn_cast<llvm::StructType>(t);
+            if (!st || !st->hasName()) {
+                return false;
+            }
+            llvm::StringRef name = st->getName().split('.').first;
+            return name == "array" || name == "array_call" ||
+                name == "dimension_descriptor";
+        }
+
+        // Address of a field of an array descriptor
+        bool is_descriptor_field(llvm::Value *ptr) {
+            llvm::GEPOperator *gep = llvm::dyn_cast<llvm::GEPOperator>(ptr);
+            return gep && gep->getNumIndices() >= 2 &&
+                is_descriptor_type(gep->getSourceElementType());
+        }
+
+        // Address of an array element or a derived type component of the
+        // accessed type. Addresses computed from a cast pointer are excluded
+        // unless the cast is of a freshly allocated block, since the memory
+        // could be reinterpreted.
+        bool is_typed_element(llvm::Value *ptr, llvm::Type *type) {
+            llvm::GEPOperator *gep = llvm::dyn_cast<llvm::GEPOperator>(ptr);
+            if (!gep || gep->getResultElementType() != type) {
+                return false;
+            }
+            llvm::Value *base = ptr;
+            while (llvm::GEPOperator *g = llvm::dyn_cast<llvm::GEPOperator>(base)) {
+                if (is_descriptor_type(g->getSourceElementType())) {
+                    return false;
+                }
+                base = g->getPointerOperand();
+            }
+            if (llvm::BitCastOperator *cast = llvm::dyn_cast<llvm::BitCastOperator>(base)) {
+                return llvm::isa<llvm::CallBase>(cast->getOperand(0));
+            }
+            return llvm::Operator::getOpcode(base) != llvm::Instruction::IntToPtr;
+        }
+
+        const char *intrinsic_type_name(llvm::Type *t) {
+            if (t->isFloatTy()) return "real(4)";
+            if (t->isDoubleTy()) return "real(8)";
+            if (t->isIntegerTy(16)) return "integer(2)";
+            if (t->isIntegerTy(32)) return "integer(4)";
+            if (t->isIntegerTy(64)) return "integer(8)";
+            // `integer(1)` is stored like characters, which are used to
+            // access memory of any type, and `logical` is left out as well
+            return nullptr;
+        }
+
+        // The argument whose descriptor the base address of `ptr` was loaded
+        // from, or nullptr. Allocatable arrays pass a pointer to the pointer
+        // to their descriptor.
+        llvm::Argument *data_of_argument(llvm::Value *ptr) {
+            llvm::Value *base = ptr->stripPointerCasts();
+            while (llvm::GEPOperator *g = llvm::dyn_cast<llvm::GEPOperator>(base)) {
+                base = g->getPointerOperand()->stripPointerCasts();
+            }
+            llvm::LoadInst *load = llvm::dyn_cast<llvm::LoadInst>(base);
+            if (!load) {
+                return nullptr;
+            }
+            llvm::GEPOperator *field = llvm::dyn_cast<llvm::GEPOperator>(
+                load->getPointerOperand());
+            if (!field || !is_descriptor_field(field) ||
+                    !field->hasAllZeroIndices()) {
+                return nullptr;
+            }
+            llvm::Value *desc = field->getPointerOperand()->stripPointerCasts();
+            if (llvm::LoadInst *desc_load = llvm::dyn_cast<llvm::LoadInst>(desc)) {
+                desc = desc_load->getPointerOperand()->stripPointerCasts();
+            }
+            return llvm::dyn_cast<llvm::Argument>(desc);
+        }
+
+    }
+
+    void annotate_alias_info(llvm::Module &m,
+            const std::map<llvm::Function*, std::vector<unsigned>> &descriptor_args,
+            bool type_punning) {
+        llvm::LLVMContext &context = m.getContext();
+        llvm::MDBuilder mdb(context);
+        llvm::MDNode *root = mdb.createTBAARoot("Fortran TBAA");
+        llvm::MDNode *descriptor = mdb.createTBAAScalarTypeNode(
+            "array descriptor", root);
+        llvm::MDNode *data = mdb.createTBAAScalarTypeNode("data", root);
+        llvm::MDNode *descriptor_tag = mdb.createTBAAStructTagNode(
+            descriptor, descriptor, 0);
+        llvm::MDNode *data_tag = mdb.createTBAAStructTagNode(data, data, 0);
+        std::map<llvm::Type*, llvm::MDNode*> type_tags;
+        auto get_data_tag = [&](llvm::Type *t) -> llvm::MDNode* {
+            const char *name = intrinsic_type_name(t);
+            if (!name) {
+                return nullptr;
+            }
+            if (type_punning) {
+                return data_tag;
+            }
+            llvm::MDNode *&tag = type_tags[t];
+            if (!tag) {
+                llvm::MDNode *node = mdb.createTBAAScalarTypeNode(name, data);
+                tag = mdb.createTBAAStructTagNode(node, node, 0);
+            }
+            return tag;
+        };
+
+        for (llvm::Function &F : m) {
+            if (F.isDeclaration()) {
+                continue;
+            }
+            // One scope per descriptor argument, for the accesses to its data
+            std::map<llvm::Argument*, llvm::MDNode*> scopes;
+            auto args = descriptor_args.find(&F);
+            if (args != descriptor_args.end() && args->second.size() >= 2) {
+                llvm::MDNode *domain = mdb.createAnonymousAliasScopeDomain(
+                    F.getName());
+                for (unsigned i : args->second) {
+                    if (i < F.arg_size()) {
+                        llvm::Argument *arg = F.getArg(i);
+                        scopes[arg] = mdb.createAnonymousAliasScope(domain,
+                            arg->getName());
+                    }
+                }
+            }
+            for (llvm::BasicBlock &BB : F) {
+                for (llvm::Instruction &I : BB) {
+                    llvm::Value *ptr;
+                    llvm::Type *type;
+                    if (llvm::LoadInst *load = llvm::dyn_cast<llvm::LoadInst>(&I)) {
+                        if (!load->isSimple()) continue;
+                        ptr = load->getPointerOperand();
+                        type = load->getType();
+                    } else if (llvm::StoreInst *store = llvm::dyn_cast<llvm::StoreInst>(&I)) {
+                        if (!store->isSimple()) continue;
+                        ptr = store->getPointerOperand();
+                        type = store->getValueOperand()->getType();
+                    } else {
+                        continue;
+                    }
+                    if (is_descriptor_field(ptr)) {
+                        I.setMetadata(llvm::LLVMContext::MD_tbaa, descriptor_tag);
+                        continue;
+                    }
+                    if (is_typed_element(ptr, type)) {
+                        if (llvm::MDNode *tag = get_data_tag(type)) {
+                            I.setMetadata(llvm::LLVMContext::MD_tbaa, tag);
+                        }
+                    }
+                    if (scopes.empty()) {
+                        continue;
+                    }
+                    auto scope = scopes.find(data_of_argument(ptr));
+                    if (scope == scopes.end()) {
+                        continue;
+                    }
+                    std::vector<llvm::Metadata*> others;
+                    for (auto &s : scopes) {
+                        if (s.first != scope->first) others.push_back(s.second);
+                    }
+                    I.setMetadata(llvm::LLVMContext::MD_alias_scope,
+                        llvm::MDNode::get(context, {scope->second}));
+                    I.setMetadata(llvm::LLVMContext::MD_noalias,
+                        llvm::MDNode::get(context, others));
+                }
+            }
+        }
+    }
+
+} // namespace LCompilers
@@ -0,0 +1,37 @@
+#ifndef LFORTRAN_LLVM_ALIAS_INFO_H
+#define LFORTRAN_LLVM_ALIAS_INFO_H
+
+#include <map>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Module.h>
+
+namespace LCompilers {
+
+    /*
+        Attaches the aliasing guarantees of Fortran to the loads and stores of
+        `m`, so that the optimizer can hoist and vectorize them:
+
+        * `!tbaa` tags from a tree in which the fields of array descriptors
+          never alias array elements or derived type components. Unless
+          `type_punning` is set, elements of different intrinsic types
+          (`real(8)`, `integer(4)`, ...) get tags that do not alias either.
+          Set `type_punning` when the program reinterprets memory as another
+          type (TRANSFER, C_F_POINTER, EQUIVALENCE, unions).
+
+        * `!alias.scope` and `!noalias` metadata telling that the elements of
+          two descriptor dummy arguments of the same procedure do not overlap.
+          `descriptor_args` lists, for each function, the positions of these
+          arguments; only non-pointer, non-target dummies may be listed.
+
+        Only accesses whose type and origin are evident from the IR are
+        tagged, everything else keeps may-alias semantics.
+    */
+    void annotate_alias_info(llvm::Module &m,
+        const std::map<llvm::Function*, std::vector<unsigned>> &descriptor_args,
+        bool type_punning);
+
+} // namespace LCompilers
+
+#endif // LFORTRAN_LLVM_ALIAS_INFO_H
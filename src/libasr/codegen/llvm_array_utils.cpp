@@ -8,35 +8,37 @@ namespace LCompilers {
 
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* arg_size) {
-            std::string func_name = "_lfortran_malloc";
+            std::string func_name = "_lfortran_malloc64";
             llvm::Function *fn = module.getFunction(func_name);
             if (!fn) {
                 llvm::FunctionType *function_type = llvm::FunctionType::get(
                         llvm::Type::getInt8Ty(context)->getPointerTo(), {
-                            llvm::Type::getInt32Ty(context)
+                            llvm::Type::getInt64Ty(context)
                         }, false);
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, module);
             }
-            std::vector<llvm::Value*> args = {arg_size};
+            std::vector<llvm::Value*> args = {
+                builder.CreateSExtOrTrunc(arg_size, llvm::Type::getInt64Ty(context))};
             return builder.CreateCall(fn, args);
         }
 
         llvm::Value* lfortran_realloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* ptr, llvm::Value* arg_size) {
-            std::string func_name = "_lfortran_realloc";
+            std::string func_name = "_lfortran_realloc64";
             llvm::Function *fn = module.getFunction(func_name);
             if (!fn) {
                 llvm::FunctionType *function_type = llvm::FunctionType::get(
                         llvm::Type::getInt8Ty(context)->getPointerTo(), {
                             llvm::Type::getInt8Ty(context)->getPointerTo(),
-                            llvm::Type::getInt32Ty(context)
+                            llvm::Type::getInt64Ty(context)
                         }, false);
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, module);
             }
             std::vector<llvm::Value*> args = {
-                builder.CreateBitCast(ptr, llvm::Type::getInt8Ty(context)->getPointerTo()), arg_size};
+                builder.CreateBitCast(ptr, llvm::Type::getInt8Ty(context)->getPointerTo()),
+                builder.CreateSExtOrTrunc(arg_size, llvm::Type::getInt64Ty(context))};
             return builder.CreateCall(fn, args);
         }
 
@@ -303,11 +305,14 @@ namespace LCompilers {
             if( !co.stack_arrays ) {
                 llvm::DataLayout data_layout(module->getDataLayout());
                 uint64_t size = data_layout.getTypeAllocSize(llvm_data_type);
-                builder->CreateStore(builder->CreateMul(
-                    llvm_utils->CreateLoad(llvm_size),
-                    llvm::ConstantInt::get(context, llvm::APInt(32, size))), llvm_size);
+                // The size in bytes may not fit in 32 bits even if the number
+                // of elements does
+                llvm::Value* llvm_size_in_bytes = builder->CreateMul(
+                    builder->CreateSExt(llvm_utils->CreateLoad(llvm_size),
+                        llvm::Type::getInt64Ty(context)),
+                    llvm::ConstantInt::get(context, llvm::APInt(64, size)));
                 llvm::Value* arr_first_i8 = lfortran_malloc(
-                    context, *module, *builder, llvm_utils->CreateLoad(llvm_size));
+                    context, *module, *builder, llvm_size_in_bytes);
                 heap_arrays.push_back(arr_first_i8);
                 arr_first = builder->CreateBitCast(
                     arr_first_i8, llvm_data_type->getPointerTo());
@@ -375,12 +380,13 @@ namespace LCompilers {
                 prod = builder->CreateMul(prod, dim_size);
             }
             llvm::Value* ptr2firstptr = get_pointer_to_data(arr);
-            llvm::AllocaInst *arg_size = llvm_utils->CreateAlloca(*builder, llvm::Type::getInt32Ty(context));
+            llvm::AllocaInst *arg_size = llvm_utils->CreateAlloca(*builder, llvm::Type::getInt64Ty(context));
             llvm::DataLayout data_layout(module->getDataLayout());
             llvm::Type* ptr_type = llvm_data_type->getPointerTo();
             uint64_t size = data_layout.getTypeAllocSize(llvm_data_type);
-            llvm::Value* llvm_size = llvm::ConstantInt::get(context, llvm::APInt(32, size));
-            prod = builder->CreateMul(prod, llvm_size);
+            llvm::Value* llvm_size = llvm::ConstantInt::get(context, llvm::APInt(64, size));
+            prod = builder->CreateMul(builder->CreateSExt(prod,
+                llvm::Type::getInt64Ty(context)), llvm_size);
             builder->CreateStore(prod, arg_size);
             llvm::Value* ptr_as_char_ptr = nullptr;
             if( realloc ) {
@@ -16,53 +16,56 @@ namespace LCompilers {
 
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* arg_size) {
-            std::string func_name = "_lfortran_malloc";
+            std::string func_name = "_lfortran_malloc64";
             llvm::Function *fn = module.getFunction(func_name);
             if (!fn) {
                 llvm::FunctionType *function_type = llvm::FunctionType::get(
                         llvm::Type::getInt8Ty(context)->getPointerTo(), {
-                            llvm::Type::getInt32Ty(context)
+                            llvm::Type::getInt64Ty(context)
                         }, false);
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, module);
             }
-            std::vector<llvm::Value*> args = {arg_size};
+            std::vector<llvm::Value*> args = {
+                builder.CreateSExtOrTrunc(arg_size, llvm::Type::getInt64Ty(context))};
             return builder.CreateCall(fn, args);
         }
 
         llvm::Value* lfortran_calloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* count, llvm::Value* type_size) {
-            std::string func_name = "_lfortran_calloc";
+            std::string func_name = "_lfortran_calloc64";
             llvm::Function *fn = module.getFunction(func_name);
             if (!fn) {
                 llvm::FunctionType *function_type = llvm::FunctionType::get(
                         llvm::Type::getInt8Ty(context)->getPointerTo(), {
-                            llvm::Type::getInt32Ty(context),
-                            llvm::Type::getInt32Ty(context)
+                            llvm::Type::getInt64Ty(context),
+                            llvm::Type::getInt64Ty(context)
                         }, false);
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, module);
             }
-            std::vector<llvm::Value*> args = {count, type_size};
+            std::vector<llvm::Value*> args = {
+                builder.CreateSExtOrTrunc(count, llvm::Type::getInt64Ty(context)),
+                builder.CreateSExtOrTrunc(type_size, llvm::Type::getInt64Ty(context))};
             return builder.CreateCall(fn, args);
         }
 
         llvm::Value* lfortran_realloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* ptr, llvm::Value* arg_size) {
-            std::string func_name = "_lfortran_realloc";
+            std::string func_name = "_lfortran_realloc64";
             llvm::Function *fn = module.getFunction(func_name);
             if (!fn) {
                 llvm::FunctionType *function_type = llvm::FunctionType::get(
                         llvm::Type::getInt8Ty(context)->getPointerTo(), {
                             llvm::Type::getInt8Ty(context)->getPointerTo(),
-                            llvm::Type::getInt32Ty(context)
+                            llvm::Type::getInt64Ty(context)
                         }, false);
                 fn = llvm::Function::Create(function_type,
                         llvm::Function::ExternalLinkage, func_name, module);
             }
             std::vector<llvm::Value*> args = {
                 builder.CreateBitCast(ptr, llvm::Type::getInt8Ty(context)->getPointerTo()),
-                arg_size
+                builder.CreateSExtOrTrunc(arg_size, llvm::Type::getInt64Ty(context))
             };
             return builder.CreateCall(fn, args);
         }
@@ -1857,8 +1860,8 @@ namespace LCompilers {
 
     void LLVMUtils::initialize_string_heap(llvm::Value* str, llvm::Value* len /*null-char not included*/){
         len = builder->CreateAdd(
-            builder->CreateSExtOrTrunc(len, llvm::Type::getInt32Ty(context)),
-                llvm::ConstantInt::get(context, llvm::APInt(32, 1))); // increment to include null-char. 
+            builder->CreateSExtOrTrunc(len, llvm::Type::getInt64Ty(context)),
+                llvm::ConstantInt::get(context, llvm::APInt(64, 1))); // increment to include null-char. 
         llvm::Value *s_malloc = LLVM::lfortran_malloc(context, *module, *builder, len);
         string_init(len, s_malloc);
         builder->CreateStore(s_malloc, str);
@@ -93,6 +93,26 @@ namespace LCompilers {
         return builder.CreateCall(fn_printf, args);
     }
 
+    // `string_format_fortran` for a constant format, the first argument is
+    // the slot (of type i8**) that caches the parsed format
+    static inline llvm::Value* string_format_fortran_cached(llvm::LLVMContext &context, llvm::Module &module,
+        llvm::IRBuilder<> &builder, const std::vector<llvm::Value*> &args)
+    {
+        llvm::Function *fn_printf = module.getFunction("_lcompilers_string_format_fortran_cached");
+        if (!fn_printf) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                    llvm::Type::getInt8Ty(context)->getPointerTo(),
+                    {llvm::Type::getInt8Ty(context)->getPointerTo()->getPointerTo(),
+                    llvm::Type::getInt8Ty(context)->getPointerTo(),
+                    llvm::Type::getInt8Ty(context)->getPointerTo(),
+                    llvm::Type::getInt32Ty(context),
+                    llvm::Type::getInt32Ty(context)}, true);
+            fn_printf = llvm::Function::Create(function_type,
+                    llvm::Function::ExternalLinkage, "_lcompilers_string_format_fortran_cached", &module);
+        }
+        return builder.CreateCall(fn_printf, args);
+    }
+
     static inline llvm::Value* lfortran_str_copy(llvm::Value* dest, llvm::Value *src, bool is_allocatable,
         llvm::Module &module, llvm::IRBuilder<> &builder, llvm::LLVMContext &context, llvm::Type* string_descriptor ) {
         if(!is_allocatable){
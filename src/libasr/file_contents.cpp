@@ -0,0 +1,21 @@
+#include <libasr/file_contents.h>
+#include <libasr/string_utils.h>
+
+namespace LCompilers {
+
+std::shared_ptr<const FileContents> FileContents::read(
+        const std::string &filename)
+{
+    std::string text;
+    if (!read_file(filename, text)) return nullptr;
+    return from_string(std::move(text));
+}
+
+std::shared_ptr<const FileContents> FileContents::from_string(std::string text)
+{
+    std::shared_ptr<FileContents> file(new FileContents());
+    file->buffer = std::move(text);
+    return file;
+}
+
+} // namespace LCompilers
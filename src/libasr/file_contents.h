@@ -0,0 +1,34 @@
+#ifndef LIBASR_FILE_CONTENTS_H
+#define LIBASR_FILE_CONTENTS_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace LCompilers {
+
+// The read only contents of a whole file, read into memory once and shared by
+// everything that refers into it (e.g. the strings of a deserialized modfile).
+class FileContents {
+public:
+    // Returns nullptr if the file cannot be read
+    static std::shared_ptr<const FileContents> read(const std::string &filename);
+    // Wraps a string that is already in memory
+    static std::shared_ptr<const FileContents> from_string(std::string text);
+
+    FileContents(const FileContents &) = delete;
+    FileContents &operator=(const FileContents &) = delete;
+
+    std::string_view view() const {
+        return buffer;
+    }
+
+private:
+    FileContents() = default;
+
+    std::string buffer;
+};
+
+} // namespace LCompilers
+
+#endif // LIBASR_FILE_CONTENTS_H
@@ -10,15 +10,19 @@
 namespace LCompilers {
 
 const std::string lfortran_modfile_type_string = "LCompilers Modfile";
+// Modfiles whose ASR section is an indexed module (serialize_indexed_module())
+const std::string lfortran_indexed_modfile_type_string = "LCompilers Modfile (indexed)";
 
-inline void save_asr(const ASR::TranslationUnit_t &m, std::string& asr_string, LCompilers::LocationManager lm) {
+inline void save_asr(const ASR::TranslationUnit_t &m, std::string& asr_string,
+        LCompilers::LocationManager lm, bool indexed) {
     #ifdef WITH_LFORTRAN_BINARY_MODFILES
     BinaryWriter b;
 #else
     TextWriter b;
 #endif
     // Header
-    b.write_string(lfortran_modfile_type_string);
+    b.write_string(indexed ? lfortran_indexed_modfile_type_string
+        : lfortran_modfile_type_string);
     b.write_string(LFORTRAN_VERSION);
 
     // AST section: Original module source code:
@@ -98,8 +102,13 @@ inline void save_asr(const ASR::TranslationUnit_t &m, std::string& asr_string, L
         b.write_int32(i);
     }
 
-    // Full ASR:
-    b.write_string(serialize(m));
+    // Full ASR, or the module with an index of its symbols, so that
+    // load_modfile() only deserializes the symbols that are used:
+    if (indexed) {
+        b.write_string(serialize_indexed_module(m));
+    } else {
+        b.write_string(serialize(m));
+    }
 
     asr_string = b.get_str();
 }
@@ -124,25 +133,26 @@ std::string save_modfile(const ASR::TranslationUnit_t &m, LCompilers::LocationMa
     }
 
     std::string asr_string;
-    save_asr(m, asr_string, lm);
+    save_asr(m, asr_string, lm, true);
     return asr_string;
 }
 
 std::string save_pycfile(const ASR::TranslationUnit_t &m, LCompilers::LocationManager lm) {
     std::string asr_string;
-    save_asr(m, asr_string, lm);
+    save_asr(m, asr_string, lm, false);
     return asr_string;
 }
 
-inline void load_serialised_asr(const std::string &s, std::string& asr_binary,
-                                LCompilers::LocationManager &lm) {
+inline void load_serialised_asr(std::string_view s, std::string_view &asr_binary,
+                                LCompilers::LocationManager &lm,
+                                const std::string &type_string) {
 #ifdef WITH_LFORTRAN_BINARY_MODFILES
     BinaryReader b(s);
 #else
     TextReader b(s);
 #endif
     std::string file_type = b.read_string();
-    if (file_type != lfortran_modfile_type_string) {
+    if (file_type != type_string) {
         throw LCompilersException("LCompilers Modfile format not recognized");
     }
     std::string version = b.read_string();
@@ -210,24 +220,33 @@ inline void load_serialised_asr(const std::string &s, std::string& asr_binary,
     lm.files.push_back(serialized_lm.files[0]);
     lm.file_ends.push_back(serialized_lm.file_ends[0] + lm.file_ends.back());
 
-    asr_binary = b.read_string();
+    asr_binary = b.read_string_view();
 }
 
-ASR::TranslationUnit_t* load_modfile(Allocator &al, const std::string &s,
-        bool load_symtab_id, SymbolTable &symtab, LCompilers::LocationManager &lm) {
-    std::string asr_binary;
-    load_serialised_asr(s, asr_binary, lm);
+ASR::TranslationUnit_t* load_modfile(Allocator &al,
+        const std::shared_ptr<const FileContents> &file, bool load_symtab_id,
+        LCompilers::LocationManager &lm) {
+    std::string_view asr_binary;
+    load_serialised_asr(file->view(), asr_binary, lm,
+        lfortran_indexed_modfile_type_string);
     // take offset as last second element of file_ends
     uint32_t offset = lm.file_ends[lm.file_ends.size()-2];
-    ASR::asr_t *asr = deserialize_asr(al, asr_binary, load_symtab_id, symtab, offset);
-    ASR::TranslationUnit_t *tu = ASR::down_cast2<ASR::TranslationUnit_t>(asr);
-    return tu;
+    // The symbols of the module are materialized when they are looked up
+    // in its symbol table (see ASRUtils::load_module()), reading straight
+    // from `file`
+    return deserialize_indexed_module(al, asr_binary, file, load_symtab_id,
+        offset);
+}
+
+ASR::TranslationUnit_t* load_modfile(Allocator &al, const std::string &s,
+        bool load_symtab_id, LCompilers::LocationManager &lm) {
+    return load_modfile(al, FileContents::from_string(s), load_symtab_id, lm);
 }
 
 ASR::TranslationUnit_t* load_pycfile(Allocator &al, const std::string &s,
         bool load_symtab_id, LCompilers::LocationManager &lm) {
-    std::string asr_binary;
-    load_serialised_asr(s, asr_binary, lm);
+    std::string_view asr_binary;
+    load_serialised_asr(s, asr_binary, lm, lfortran_modfile_type_string);
     uint32_t offset = 0;
     ASR::asr_t *asr = deserialize_asr(al, asr_binary, load_symtab_id, offset);
 
@@ -1,7 +1,10 @@
 #ifndef LFORTRAN_MODFILE_H
 #define LFORTRAN_MODFILE_H
 
+#include <memory>
+
 #include <libasr/asr.h>
+#include <libasr/file_contents.h>
 
 namespace LCompilers {
 
@@ -12,7 +15,12 @@ namespace LCompilers {
 
     // Load a module from a modfile
     ASR::TranslationUnit_t* load_modfile(Allocator &al, const std::string &s,
-        bool load_symtab_id, SymbolTable &symtab, LCompilers::LocationManager &lm);
+        bool load_symtab_id, LCompilers::LocationManager &lm);
+    // Same as above, the symbols of the module are deserialized straight from
+    // `file` when they are first used
+    ASR::TranslationUnit_t* load_modfile(Allocator &al,
+        const std::shared_ptr<const FileContents> &file, bool load_symtab_id,
+        LCompilers::LocationManager &lm);
 
     ASR::TranslationUnit_t* load_pycfile(Allocator &al, const std::string &s,
         bool load_symtab_id, LCompilers::LocationManager &lm);
@@ -1314,6 +1314,19 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
 
     void visit_FileWrite(const ASR::FileWrite_t& x) {
         ASR::FileWrite_t& xx = const_cast<ASR::FileWrite_t&>(x);
+        if( !x.m_is_formatted ) {
+            // An unformatted record is written from the data of each
+            // item, so array sections are copied to contiguous temporaries
+            for( size_t i = 0; i < xx.n_values; i++ ) {
+                ASR::expr_t* value = ASRUtils::get_past_array_physical_cast(xx.m_values[i]);
+                if( ASR::is_a<ASR::ArraySection_t>(*value) ) {
+                    visit_expr(*value);
+                    xx.m_values[i] = create_and_allocate_temporary_variable_for_array(
+                        value, "file_write", al, current_body, current_scope,
+                        exprs_with_target);
+                }
+            }
+        }
         visit_IO(xx.m_values, xx.n_values, "file_write");
         CallReplacerOnExpressionsVisitor::visit_FileWrite(x);
     }
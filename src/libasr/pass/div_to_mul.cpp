@@ -81,5 +81,13 @@ void pass_replace_div_to_mul(Allocator &al, ASR::TranslationUnit_t &unit,
     v.visit_TranslationUnit(unit);
 }
 
+void pass_replace_div_to_mul_in_symbol(Allocator &al, ASR::symbol_t &sym,
+                                       const LCompilers::PassOptions& pass_options) {
+    std::string rl_path = pass_options.runtime_library_dir;
+    DivToMulVisitor v(al, rl_path);
+    v.current_scope = ASRUtils::symbol_parent_symtab(&sym);
+    v.visit_symbol(sym);
+}
+
 
 } // namespace LCompilers
@@ -65,18 +65,33 @@ public:
     }
 };
 
-void pass_replace_do_loops(Allocator &al, ASR::TranslationUnit_t &unit,
-                           const LCompilers::PassOptions& pass_options) {
-    DoLoopVisitor v(al, pass_options);
+template <typename Visit>
+void replace_do_loops(DoLoopVisitor &v, const LCompilers::PassOptions& pass_options,
+                      Visit visit) {
     // Each call transforms only one layer of nested loops, so we call it twice
     // to transform doubly nested loops:
     v.asr_changed = true;
     v.use_loop_variable_after_loop = pass_options.use_loop_variable_after_loop;
     while( v.asr_changed ) {
         v.asr_changed = false;
-        v.visit_TranslationUnit(unit);
+        visit();
     }
 }
 
+void pass_replace_do_loops(Allocator &al, ASR::TranslationUnit_t &unit,
+                           const LCompilers::PassOptions& pass_options) {
+    DoLoopVisitor v(al, pass_options);
+    replace_do_loops(v, pass_options, [&]() { v.visit_TranslationUnit(unit); });
+}
+
+void pass_replace_do_loops_in_symbol(Allocator &al, ASR::symbol_t &sym,
+                                     const LCompilers::PassOptions& pass_options) {
+    DoLoopVisitor v(al, pass_options);
+    replace_do_loops(v, pass_options, [&]() {
+        v.current_scope = ASRUtils::symbol_parent_symtab(&sym);
+        v.visit_symbol(sym);
+    });
+}
+
 
 } // namespace LCompilers
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <exception>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/function_local_pass.h>
+
+namespace LCompilers {
+
+namespace {
+
+    struct WorkItem {
+        ASR::symbol_t *sym;
+        bool parallel;
+        // Symbol tables created by the pass, in the order of creation
+        std::vector<SymbolTable*> new_symbol_tables;
+        std::exception_ptr exception;
+    };
+
+    /*
+        Collects the work items in the order in which `visit_TranslationUnit`
+        visits them. Only procedures and programs are rewritten concurrently;
+        `shared_scopes` gets the scopes that they must leave untouched.
+    */
+    void collect_work_items(SymbolTable *symtab, bool parallel,
+            std::vector<WorkItem> &items,
+            std::vector<std::pair<SymbolTable*, size_t>> &shared_scopes) {
+        if (parallel) {
+            shared_scopes.push_back({symtab, symtab->get_scope().size()});
+        }
+        for (auto &item : symtab->get_scope()) {
+            ASR::symbol_t *sym = item.second;
+            if (ASR::is_a<ASR::Module_t>(*sym)) {
+                SymbolTable *module_symtab = ASR::down_cast<ASR::Module_t>(sym)->m_symtab;
+                // Looking up a name in a module that is loaded lazily from
+                // its .mod file modifies the symbol table of the module
+                collect_work_items(module_symtab,
+                    parallel && module_symtab->loader == nullptr, items,
+                    shared_scopes);
+            } else {
+                bool procedure = ASR::is_a<ASR::Function_t>(*sym)
+                    || ASR::is_a<ASR::Program_t>(*sym);
+                items.push_back({sym, parallel && procedure, {}, nullptr});
+            }
+        }
+    }
+
+    // Logs the symbol tables created by the current thread while alive
+    class SymbolTableLog {
+    public:
+        SymbolTableLog(std::vector<SymbolTable*> &log) {
+            SymbolTable::log_new_symbol_tables(&log);
+        }
+        ~SymbolTableLog() {
+            SymbolTable::log_new_symbol_tables(nullptr);
+        }
+    };
+
+} // namespace
+
+void apply_function_local_pass(Allocator &al, ASR::TranslationUnit_t &unit,
+                               function_local_pass_function pass,
+                               const PassOptions &pass_options) {
+    std::vector<WorkItem> items;
+    std::vector<std::pair<SymbolTable*, size_t>> shared_scopes;
+    collect_work_items(unit.m_symtab, true, items, shared_scopes);
+    unsigned int first_counter = SymbolTable::get_global_counter();
+
+    std::vector<WorkItem*> parallel_items;
+    for (auto &item : items) {
+        if (item.parallel) {
+            parallel_items.push_back(&item);
+        } else {
+            SymbolTableLog log(item.new_symbol_tables);
+            pass(al, *item.sym, pass_options);
+        }
+    }
+
+    size_t n_jobs = pass_options.pass_jobs;
+    if (n_jobs == 0) n_jobs = std::max(1u, std::thread::hardware_concurrency());
+    n_jobs = std::min(n_jobs, parallel_items.size());
+    std::vector<std::unique_ptr<Allocator>> allocators;
+    for (size_t j = 0; j < n_jobs; j++) {
+        allocators.push_back(std::make_unique<Allocator>(64*1024));
+    }
+    std::atomic<size_t> next_item{0};
+    auto worker = [&](Allocator &worker_al) {
+        for (size_t i = next_item++; i < parallel_items.size(); i = next_item++) {
+            WorkItem &item = *parallel_items[i];
+            try {
+                SymbolTableLog log(item.new_symbol_tables);
+                pass(worker_al, *item.sym, pass_options);
+            } catch (...) {
+                item.exception = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t j = 1; j < n_jobs; j++) {
+        workers.emplace_back(worker, std::ref(*allocators[j]));
+    }
+    if (n_jobs > 0) worker(*allocators[0]);
+    for (auto &t : workers) t.join();
+    for (auto &worker_al : allocators) al.adopt(*worker_al);
+
+    // Report the error of the first item, like a serial run would
+    for (auto &item : items) {
+        if (item.exception) std::rethrow_exception(item.exception);
+    }
+#if defined(WITH_LFORTRAN_ASSERT)
+    for (auto &scope : shared_scopes) {
+        LCOMPILERS_ASSERT(scope.first->get_scope().size() == scope.second);
+    }
+#endif
+
+    // Give the new symbol tables the IDs of a serial run
+    unsigned int counter = first_counter;
+    for (auto &item : items) {
+        for (SymbolTable *symtab : item.new_symbol_tables) {
+            symtab->counter = ++counter;
+        }
+    }
+    SymbolTable::set_global_counter(counter);
+}
+
+} // namespace LCompilers
@@ -0,0 +1,40 @@
+#ifndef LIBASR_PASS_FUNCTION_LOCAL_PASS_H
+#define LIBASR_PASS_FUNCTION_LOCAL_PASS_H
+
+#include <libasr/asr.h>
+#include <libasr/utils.h>
+
+namespace LCompilers {
+
+    /*
+        A function-local pass rewrites one top level symbol (a procedure, a
+        program, ...) at a time, so that independent procedures can be
+        rewritten concurrently. The pass must:
+
+        * only add symbols to the symbol tables owned by the symbol it is
+          given (and the ones nested in it), never to the enclosing module or
+          translation unit,
+        * allocate only from the allocator it is given,
+        * keep no state between symbols and use no process wide counters
+          (such as `ASRUtils::LabelGenerator`).
+
+        Applying it to every symbol of the translation unit, and to every
+        symbol of each module, must be equivalent to the whole unit pass.
+    */
+    typedef void (*function_local_pass_function)(Allocator&, ASR::symbol_t&,
+                                                 const PassOptions&);
+
+    /*
+        Applies `pass` to every top level symbol of `unit` on
+        `pass_options.pass_jobs` threads. Each worker allocates from its own
+        Allocator, whose memory is handed over to `al` at the end. Symbol
+        tables created by the pass are renumbered in the order a serial run
+        would have created them, so the resulting ASR is identical.
+    */
+    void apply_function_local_pass(Allocator &al, ASR::TranslationUnit_t &unit,
+                                   function_local_pass_function pass,
+                                   const PassOptions &pass_options);
+
+} // namespace LCompilers
+
+#endif // LIBASR_PASS_FUNCTION_LOCAL_PASS_H
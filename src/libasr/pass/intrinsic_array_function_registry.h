@@ -3786,6 +3786,54 @@ namespace MinVal {
 
 } // namespace MinVal
 
+/*
+ * Declares in `fn_symtab` the interface of the runtime function `c_func_name`
+ * and adds it to `dep`. The first `n_value_args` of `arg_types` are passed
+ * by value, the others by reference; `return_type` is the type of its result.
+ */
+static inline ASR::symbol_t* declare_runtime_function(Allocator &al,
+        const Location &loc, SymbolTable *fn_symtab, SetChar &dep,
+        const std::string &c_func_name, const std::vector<std::string> &arg_names,
+        const std::vector<ASR::ttype_t*> &arg_types, size_t n_value_args,
+        ASR::ttype_t *return_type) {
+    ASRBuilder b(al, loc);
+    SymbolTable *symtab = al.make_new<SymbolTable>(fn_symtab);
+    Vec<ASR::expr_t*> args; args.reserve(al, arg_types.size());
+    for (size_t i = 0; i < arg_types.size(); i++) {
+        bool value = i < n_value_args;
+        args.push_back(al, b.Variable(symtab, arg_names[i], arg_types[i],
+            value ? ASR::intentType::In : ASR::intentType::InOut,
+            ASR::abiType::BindC, value));
+    }
+    ASR::expr_t *return_var = b.Variable(symtab, c_func_name, return_type,
+        ASRUtils::intent_return_var, ASR::abiType::BindC, false);
+    SetChar dep_1; dep_1.reserve(al, 1);
+    Vec<ASR::stmt_t*> body_1; body_1.reserve(al, 1);
+    ASR::symbol_t *s = make_ASR_Function_t(c_func_name, symtab, dep_1, args,
+        body_1, return_var, ASR::abiType::BindC, ASR::deftypeType::Interface,
+        s2c(al, c_func_name));
+    fn_symtab->add_symbol(c_func_name, s);
+    dep.push_back(al, s2c(al, c_func_name));
+    return s;
+}
+
+// The prefix of the runtime kernels (`_lfortran_dmatmul`, ...) for arrays of
+// `type`, or "" if there are none
+static inline std::string runtime_kernel_prefix(ASR::ttype_t *type) {
+    type = ASRUtils::type_get_past_array(ASRUtils::type_get_past_allocatable(
+        ASRUtils::type_get_past_pointer(type)));
+    int kind = ASRUtils::extract_kind_from_ttype_t(type);
+    if (kind != 4 && kind != 8) {
+        return "";
+    }
+    if (is_real(*type)) {
+        return kind == 4 ? "s" : "d";
+    } else if (is_complex(*type)) {
+        return kind == 4 ? "c" : "z";
+    }
+    return "";
+}
+
 namespace MatMul {
 
     static inline void verify_args(const ASR::IntrinsicArrayFunction_t &x,
@@ -3798,10 +3846,109 @@ namespace MatMul {
             "cannot be nullptr", x.base.base.loc, diagnostics);
     }
 
-    static inline ASR::expr_t *eval_MatMul(Allocator &,
-        const Location &, ASR::ttype_t *, Vec<ASR::expr_t*>&, diag::Diagnostics&) {
-        // TODO
-        return nullptr;
+    struct ConstantElement {
+        int64_t i;      // integer elements
+        double re, im;  // real and complex elements
+    };
+
+    // The elements of the constant array `arg` in column major order, or
+    // false if `arg` has no constant value
+    static inline bool matmul_constant_elements(Allocator &al, ASR::expr_t *arg,
+            std::vector<ConstantElement> &elements) {
+        ASR::expr_t *value = ASRUtils::expr_value(arg);
+        if (value && ASR::is_a<ASR::ArrayPhysicalCast_t>(*value)) {
+            value = ASRUtils::expr_value(ASR::down_cast<ASR::ArrayPhysicalCast_t>(value)->m_arg);
+        }
+        if (!value || !ASR::is_a<ASR::ArrayConstant_t>(*value) ||
+                !ASRUtils::is_fixed_size_array(expr_type(arg))) {
+            return false;
+        }
+        ASR::ArrayConstant_t *a = ASR::down_cast<ASR::ArrayConstant_t>(value);
+        int64_t n = ASRUtils::get_fixed_size_of_array(expr_type(arg));
+        if (ASRUtils::get_fixed_size_of_array(a->m_type) != n) {
+            return false;
+        }
+        for (int64_t i = 0; i < n; i++) {
+            ASR::expr_t *e = ASRUtils::fetch_ArrayConstant_value(al, a, i);
+            if (ASR::is_a<ASR::IntegerConstant_t>(*e)) {
+                int64_t v = ASR::down_cast<ASR::IntegerConstant_t>(e)->m_n;
+                elements.push_back({v, (double) v, 0.0});
+            } else if (ASR::is_a<ASR::RealConstant_t>(*e)) {
+                elements.push_back({0, ASR::down_cast<ASR::RealConstant_t>(e)->m_r, 0.0});
+            } else if (ASR::is_a<ASR::ComplexConstant_t>(*e)) {
+                ASR::ComplexConstant_t *c = ASR::down_cast<ASR::ComplexConstant_t>(e);
+                elements.push_back({0, c->m_re, c->m_im});
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static inline ASR::expr_t *eval_MatMul(Allocator &al,
+            const Location &loc, ASR::ttype_t *return_type,
+            Vec<ASR::expr_t*>& args, diag::Diagnostics& /*diag*/) {
+        /*
+            r(i, j) = sum over k of a(i, k) * b(k, j), where a vector
+            `matrix_a` is a 1 x k and a vector `matrix_b` a k x 1 matrix
+        */
+        if (!all_args_evaluated(args) || !ASRUtils::is_fixed_size_array(return_type) ||
+                ASRUtils::is_allocatable(return_type)) {
+            return nullptr;
+        }
+        ASR::ttype_t *element_type = ASRUtils::extract_type(return_type);
+        std::vector<ConstantElement> a, b;
+        if (!matmul_constant_elements(al, args[0], a) ||
+                !matmul_constant_elements(al, args[1], b)) {
+            return nullptr;
+        }
+        ASR::dimension_t *a_dims = nullptr, *b_dims = nullptr;
+        int a_rank = extract_dimensions_from_ttype(expr_type(args[0]), a_dims);
+        int b_rank = extract_dimensions_from_ttype(expr_type(args[1]), b_dims);
+        int64_t m = a_rank == 2 ? ASRUtils::get_fixed_size_of_array(a_dims, 1) : 1;
+        int64_t n = b_rank == 2 ? ASRUtils::get_fixed_size_of_array(b_dims + 1, 1) : 1;
+        int64_t k = a_rank == 2 ? ASRUtils::get_fixed_size_of_array(a_dims + 1, 1)
+            : (int64_t) a.size();
+        if (m * n == 0 || m * k != (int64_t) a.size() || k * n != (int64_t) b.size()) {
+            return nullptr;
+        }
+        bool integer = is_integer(*element_type);
+        Vec<ASR::expr_t*> values; values.reserve(al, m * n);
+        for (int64_t j = 0; j < n; j++) {
+            for (int64_t i = 0; i < m; i++) {
+                if (integer) {
+                    // Summed in 64 bits, wrapping around on overflow
+                    uint64_t r = 0;
+                    for (int64_t p = 0; p < k; p++) {
+                        r += (uint64_t) a[i + p*m].i * (uint64_t) b[p + j*k].i;
+                    }
+                    values.push_back(al, EXPR(ASR::make_IntegerConstant_t(al, loc,
+                        (int64_t) r, element_type)));
+                    continue;
+                }
+                double re = 0, im = 0;
+                for (int64_t p = 0; p < k; p++) {
+                    const ConstantElement &x = a[i + p*m], &y = b[p + j*k];
+                    re += x.re * y.re - x.im * y.im;
+                    im += x.re * y.im + x.im * y.re;
+                }
+                if (is_complex(*element_type)) {
+                    values.push_back(al, EXPR(ASR::make_ComplexConstant_t(al, loc,
+                        re, im, element_type)));
+                } else {
+                    values.push_back(al, EXPR(ASR::make_RealConstant_t(al, loc,
+                        re, element_type)));
+                }
+            }
+        }
+        ASR::dimension_t *dims = nullptr;
+        int rank = extract_dimensions_from_ttype(return_type, dims);
+        int64_t n_data = values.n * extract_kind_from_ttype_t(element_type);
+        return EXPR(ASR::make_ArrayConstant_t(al, loc, n_data,
+            ASRUtils::set_ArrayConstant_data(values.p, values.n, element_type),
+            TYPE(ASR::make_Array_t(al, loc, element_type, dims, rank,
+                ASR::array_physical_typeType::FixedSizeArray)),
+            ASR::arraystorageType::ColMajor));
     }
 
     static inline ASR::asr_t* create_MatMul(Allocator& al, const Location& loc,
@@ -4038,14 +4185,78 @@ namespace MatMul {
         } else {
             mul_value = b.Mul(a_ref, b_ref);
         }
-        body.push_back(al, b.DoLoop(i, a_lbound, a_ubound, {
-            b.DoLoop(j, b_lbound, b_ubound, {
-                b.Assign_Constant(res_ref, 0),
-                b.DoLoop(k, LBound(args[1], 1), UBound(args[1], 1), {
+        /*
+            The loops run down the columns of the result and of `matrix_a`,
+            which are contiguous:
+
+            do j = lbound(matrix_b, 2), ubound(matrix_b, 2)
+                r(:, j) = 0
+                do k = lbound(matrix_b, 1), ubound(matrix_b, 1)
+                    r(:, j) = r(:, j) + a(:, k) * b(k, j)
+                end do
+            end do
+        */
+        ASR::stmt_t *loops = b.DoLoop(j, b_lbound, b_ubound, {
+            b.DoLoop(i, a_lbound, a_ubound, {
+                b.Assign_Constant(res_ref, 0)
+            }),
+            b.DoLoop(k, LBound(args[1], 1), UBound(args[1], 1), {
+                b.DoLoop(i, a_lbound, a_ubound, {
                     b.Assignment(res_ref, b.Add(res_ref, mul_value))
-                }),
+                })
             })
-        }));
+        });
+        std::string prefix = runtime_kernel_prefix(return_type);
+        if (overload_id == 3 && !prefix.empty() &&
+                ASRUtils::check_equal_type(ASRUtils::extract_type(arg_types[0]),
+                    ASRUtils::extract_type(return_type)) &&
+                ASRUtils::check_equal_type(ASRUtils::extract_type(arg_types[1]),
+                    ASRUtils::extract_type(return_type))) {
+            /*
+                Contiguous real and complex matrices are multiplied by a
+                blocked kernel of the runtime library:
+
+                if (is_contiguous(a) .and. is_contiguous(b) .and.
+                        is_contiguous(r) .and. size(a) > 0 .and. size(b) > 0) then
+                    n_written = _lfortran_dmatmul(size(a, 1, kind=8),
+                        size(b, 2, kind=8), size(a, 2, kind=8), a(1, 1),
+                        b(1, 1), r(1, 1))
+                else
+                    (the loops above)
+                end if
+            */
+            ASR::ttype_t *element_type = ASRUtils::extract_type(return_type);
+            std::string c_func_name = "_lfortran_" + prefix + "matmul";
+            ASR::symbol_t *s_matmul = declare_runtime_function(al, loc, fn_symtab,
+                dep, c_func_name, {"m", "n", "k", "a", "b", "c"},
+                {int64, int64, int64, element_type, element_type, element_type},
+                3, int64);
+            Vec<ASR::expr_t*> matmul_args; matmul_args.reserve(al, 6);
+            matmul_args.push_back(al, b.ArraySize(args[0], b.i32(1), int64));
+            matmul_args.push_back(al, b.ArraySize(args[1], b.i32(2), int64));
+            matmul_args.push_back(al, b.ArraySize(args[0], b.i32(2), int64));
+            for (ASR::expr_t *x: {args[0], args[1], result}) {
+                matmul_args.push_back(al, b.ArrayItem_01(x,
+                    {LBound(x, 1), LBound(x, 2)}));
+            }
+            ASR::expr_t *is_contiguous = nullptr;
+            for (ASR::expr_t *x: {args[0], args[1], result}) {
+                ASR::expr_t *x_contiguous = ASRUtils::EXPR(
+                    ASR::make_ArrayIsContiguous_t(al, loc, x, logical, nullptr));
+                is_contiguous = is_contiguous ? b.And(is_contiguous, x_contiguous)
+                    : x_contiguous;
+            }
+            ASR::expr_t *n_written = declare("n_written", int64, Local);
+            body.push_back(al, b.If(b.And(is_contiguous, b.And(
+                    b.Gt(b.ArraySize(args[0], nullptr, int32), b.i32(0)),
+                    b.Gt(b.ArraySize(args[1], nullptr, int32), b.i32(0)))), {
+                b.Assignment(n_written, b.Call(s_matmul, matmul_args, int64))
+            }, {
+                loops
+            }));
+        } else {
+            body.push_back(al, loops);
+        }
         body.push_back(al, b.Return());
         ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
                 body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
@@ -5616,10 +5827,42 @@ namespace DotProduct {
                 b.Assignment(result, b.Add(result, EXPR(ASR::make_ComplexBinOp_t(al, loc, func_call_conjg, ASR::binopType::Mul, b.ArrayItem_01(args[1], {i}), return_type, nullptr))))
             }, nullptr));
         } else if (is_real(*return_type)) {
-            body.push_back(al, b.Assignment(result, make_ConstantWithType(make_RealConstant_t, 0.0, return_type, loc)));
-            body.push_back(al, b.DoLoop(i, LBound(args[0], 1), UBound(args[0], 1), {
+            ASR::stmt_t *init = b.Assignment(result, make_ConstantWithType(make_RealConstant_t, 0.0, return_type, loc));
+            ASR::stmt_t *loop = b.DoLoop(i, LBound(args[0], 1), UBound(args[0], 1), {
                 b.Assignment(result, b.Add(result, b.Mul(b.ArrayItem_01(args[0], {i}), b.r2r_t(b.ArrayItem_01(args[1], {i}), ASRUtils::type_get_past_array(arg_types[0])))))
-            }, nullptr));
+            }, nullptr);
+            std::string prefix = runtime_kernel_prefix(return_type);
+            if (!prefix.empty() &&
+                    ASRUtils::check_equal_type(ASRUtils::extract_type(arg_types[0]), return_type) &&
+                    ASRUtils::check_equal_type(ASRUtils::extract_type(arg_types[1]), return_type)) {
+                /*
+                    if (is_contiguous(matrix_a) .and. is_contiguous(matrix_b) .and. size(matrix_a) > 0) then
+                        res = _lfortran_ddot(size(matrix_a, kind=8), matrix_a(lbound(matrix_a, 1)), matrix_b(lbound(matrix_b, 1)))
+                    else
+                        (the loop above)
+                    end if
+                */
+                std::string c_func_name = "_lfortran_" + prefix + "dot";
+                ASR::symbol_t *s_dot = declare_runtime_function(al, loc, fn_symtab,
+                    dep, c_func_name, {"n", "a", "b"},
+                    {int64, return_type, return_type}, 1, return_type);
+                Vec<ASR::expr_t*> dot_args; dot_args.reserve(al, 3);
+                dot_args.push_back(al, b.ArraySize(args[0], nullptr, int64));
+                dot_args.push_back(al, b.ArrayItem_01(args[0], {LBound(args[0], 1)}));
+                dot_args.push_back(al, b.ArrayItem_01(args[1], {LBound(args[1], 1)}));
+                ASR::expr_t *is_contiguous = b.And(
+                    ASRUtils::EXPR(ASR::make_ArrayIsContiguous_t(al, loc, args[0], logical, nullptr)),
+                    ASRUtils::EXPR(ASR::make_ArrayIsContiguous_t(al, loc, args[1], logical, nullptr)));
+                body.push_back(al, b.If(b.And(is_contiguous, b.Gt(b.ArraySize(args[0], nullptr, int32), b.i32(0))), {
+                    b.Assignment(result, b.Call(s_dot, dot_args, return_type))
+                }, {
+                    init,
+                    loop
+                }));
+            } else {
+                body.push_back(al, init);
+                body.push_back(al, loop);
+            }
         } else {
             body.push_back(al, b.Assignment(result, make_ConstantWithType(make_IntegerConstant_t, 0, return_type, loc)));
             body.push_back(al, b.DoLoop(i, LBound(args[0], 1), UBound(args[0], 1), {
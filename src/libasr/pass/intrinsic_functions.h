@@ -813,6 +813,7 @@ namespace Abs {
         if (is_complex(*type)) {
             ASR::ttype_t* real_type = TYPE(ASR::make_Real_t(al, type->base.loc,
                                         ASRUtils::extract_kind_from_ttype_t(type)));
+            type = ASRUtils::type_get_past_allocatable_pointer(type);
             if (ASR::is_a<ASR::Array_t>(*type)) {
                 ASR::Array_t* e = ASR::down_cast<ASR::Array_t>(type);
                 type = TYPE(ASR::make_Array_t(al, type->base.loc, real_type,
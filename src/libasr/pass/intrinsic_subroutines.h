@@ -78,10 +78,14 @@ namespace RandomInit {
         std::string new_name = "_lcompilers_random_init_";
 
         declare_basic_variables(new_name);
-        fill_func_arg_sub("repeatable", arg_types[0], InOut);
-        fill_func_arg_sub("image_distinct", arg_types[1], InOut);
+        fill_func_arg_sub("repeatable", arg_types[0], In);
+        fill_func_arg_sub("image_distinct", arg_types[1], In);
         SymbolTable *fn_symtab_1 = al.make_new<SymbolTable>(fn_symtab);
-        Vec<ASR::expr_t*> args_1; args_1.reserve(al, 0);
+        Vec<ASR::expr_t*> args_1; args_1.reserve(al, 2);
+        args_1.push_back(al, b.Variable(fn_symtab_1, "repeatable", arg_types[0],
+            ASR::intentType::In, ASR::abiType::BindC, true));
+        args_1.push_back(al, b.Variable(fn_symtab_1, "image_distinct", arg_types[1],
+            ASR::intentType::In, ASR::abiType::BindC, true));
         ASR::expr_t *return_var_1 = b.Variable(fn_symtab_1, c_func_name,
            ASRUtils::type_get_past_array(ASRUtils::type_get_past_allocatable(arg_types[0])),
            ASRUtils::intent_return_var, ASR::abiType::BindC, false);
@@ -91,9 +95,11 @@ namespace RandomInit {
             body_1, return_var_1, ASR::abiType::BindC, ASR::deftypeType::Interface, s2c(al, c_func_name));
         fn_symtab->add_symbol(c_func_name, s);
         dep.push_back(al, s2c(al, c_func_name));
-        Vec<ASR::expr_t*> call_args; call_args.reserve(al, 0);
-        body.push_back(al, b.Assignment(args[0], b.Call(s, call_args, arg_types[0])));
-        body.push_back(al, b.Assignment(args[1], b.Call(s, call_args, arg_types[1])));
+        ASR::expr_t* status = declare("status", arg_types[0], Local);
+        Vec<ASR::expr_t*> call_args; call_args.reserve(al, 2);
+        call_args.push_back(al, args[0]);
+        call_args.push_back(al, args[1]);
+        body.push_back(al, b.Assignment(status, b.Call(s, call_args, arg_types[0])));
         ASR::symbol_t *new_symbol = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
             body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
         scope->add_symbol(fn_name, new_symbol);
@@ -132,11 +138,12 @@ namespace RandomSeed {
             Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/) {
 
         std::string c_func_name_1 = "_lfortran_random_seed";
-        std::string c_func_name_2 = "_lfortran_dp_rand_num";
         std::string new_name = "_lcompilers_random_seed_";
         declare_basic_variables(new_name);
-        int flag = 0;
-        if (!is_real(*arg_types[0])) {
+        bool has_size = !is_real(*arg_types[0]);
+        bool has_put = !is_real(*arg_types[1]);
+        bool has_get = !is_real(*arg_types[2]);
+        if (has_size) {
             fill_func_arg_sub("size", arg_types[0], InOut);
             ASR::symbol_t *s_1 = b.create_c_func_subroutines(c_func_name_1, fn_symtab, 1, arg_types[0]);
             fn_symtab->add_symbol(c_func_name_1, s_1);
@@ -148,52 +155,73 @@ namespace RandomSeed {
             fill_func_arg_sub("size", real32, InOut);
             body.push_back(al, b.Assignment(args[0], b.f32(0)));
         }
-        if (!is_real(*arg_types[1])) {
-            flag = 1;
+        ASR::expr_t* status = nullptr;
+        ASR::expr_t* i = nullptr;
+        if (has_put || has_get) {
+            status = declare("status", int32, Local);
+            i = declare("i", int32, Local);
+        }
+        if (has_put) {
+            /*
+                The seed is replaced one element at a time:
+                do i = lbound(put, 1), ubound(put, 1)
+                    status = _lfortran_random_seed_put(i - lbound(put, 1), int(put(i), 8))
+                end do
+            */
             fill_func_arg_sub("put", arg_types[1], InOut);
-            body.push_back(al, b.Assignment(args[1], args[1]));
+            std::string c_func = "_lfortran_random_seed_put";
+            ASR::symbol_t *s_put = b.create_c_func_subroutines_with_return_type(c_func,
+                fn_symtab, 2, {int32, int64}, int32);
+            fn_symtab->add_symbol(c_func, s_put);
+            dep.push_back(al, s2c(al, c_func));
+            ASR::expr_t* value = b.ArrayItem_01(args[1], {i});
+            if (ASRUtils::extract_kind_from_ttype_t(arg_types[1]) != 8) {
+                value = b.i2i_t(value, int64);
+            }
+            Vec<ASR::expr_t*> call_args; call_args.reserve(al, 2);
+            call_args.push_back(al, b.Sub(i, LBound(args[1], 1)));
+            call_args.push_back(al, value);
+            body.push_back(al, b.DoLoop(i, LBound(args[1], 1), UBound(args[1], 1), {
+                b.Assignment(status, b.Call(s_put, call_args, int32))
+            }, nullptr));
         } else {
             fill_func_arg_sub("put", real32, InOut);
             body.push_back(al, b.Assignment(args[1], b.f32(0)));
         }
-        if (!is_real(*arg_types[2])) {
+        if (has_get) {
             fill_func_arg_sub("get", arg_types[2], InOut);
-            if (flag == 1) {
-                body.push_back(al, b.Assignment(args[2], args[1]));
-            } else {
-                std::vector<LCompilers::ASR::expr_t *> vals;
-                std::string c_func = c_func_name_2;
-                int kind = ASRUtils::extract_kind_from_ttype_t(arg_types[2]);
-                if ( is_real(*arg_types[2]) ) {
-                    if (kind == 4) {
-                        c_func = "_lfortran_sp_rand_num";
-                    } else {
-                        c_func = "_lfortran_dp_rand_num";
-                    }
-                } else if ( is_integer(*arg_types[2]) ) {
-                    if (kind == 4) {
-                        c_func = "_lfortran_int32_rand_num";
-                    } else {
-                        c_func = "_lfortran_int64_rand_num";
-                    }
-                }
-                ASR::symbol_t *s_2 = b.create_c_func_subroutines(c_func, fn_symtab, 0, arg_types[2]);
-                fn_symtab->add_symbol(c_func, s_2);
-                dep.push_back(al, s2c(al, c_func));
-                Vec<ASR::expr_t*> call_args2; call_args2.reserve(al, 0);
-                ASR::ttype_t* elem_type = extract_type(arg_types[2]);
-                for (int i = 0; i < 8; i++) {
-                    auto xx = declare("i_" + std::to_string(i), elem_type, Local);
-                    body.push_back(al, b.Assignment(xx, b.Call(s_2, call_args2, int32)));
-                    vals.push_back(xx);
-                }
-                body.push_back(al, b.Assignment(args[2], b.ArrayConstant(vals, extract_type(arg_types[2]), false)));
+            std::string c_func = "_lfortran_random_seed_get";
+            ASR::symbol_t *s_get = b.create_c_func_subroutines_with_return_type(c_func,
+                fn_symtab, 1, {int32}, int32);
+            fn_symtab->add_symbol(c_func, s_get);
+            dep.push_back(al, s2c(al, c_func));
+            Vec<ASR::expr_t*> call_args; call_args.reserve(al, 1);
+            call_args.push_back(al, b.Sub(i, LBound(args[2], 1)));
+            ASR::expr_t* value = b.Call(s_get, call_args, int32);
+            if (ASRUtils::extract_kind_from_ttype_t(arg_types[2]) != 4) {
+                value = b.i2i_t(value, extract_type(arg_types[2]));
             }
+            body.push_back(al, b.DoLoop(i, LBound(args[2], 1), UBound(args[2], 1), {
+                b.Assignment(b.ArrayItem_01(args[2], {i}), value)
+            }, nullptr));
         } else {
             fill_func_arg_sub("get", real32, InOut);
             body.push_back(al, b.Assignment(args[2], b.f32(0)));
         }
-       
+        if (!has_size && !has_put && !has_get) {
+            // `call random_seed()` picks a new processor-dependent seed
+            std::string c_func = "_lfortran_random_init";
+            ASR::symbol_t *s_init = b.create_c_func_subroutines_with_return_type(c_func,
+                fn_symtab, 2, {logical, logical}, logical);
+            fn_symtab->add_symbol(c_func, s_init);
+            dep.push_back(al, s2c(al, c_func));
+            Vec<ASR::expr_t*> call_args; call_args.reserve(al, 2);
+            call_args.push_back(al, b.bool_t(false, logical));
+            call_args.push_back(al, b.bool_t(false, logical));
+            ASR::expr_t* init_status = declare("init_status", logical, Local);
+            body.push_back(al, b.Assignment(init_status, b.Call(s_init, call_args, logical)));
+        }
+
         ASR::symbol_t *new_symbol = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
             body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
         scope->add_symbol(fn_name, new_symbol);
@@ -282,14 +310,17 @@ namespace RandomNumber {
             c_func_name = "_lfortran_dp_rand_num";
         }
         std::string new_name = "_lcompilers_random_number_";
+        // A section, e.g. `b(1:n:2)`, arrives as a pointer to it
+        ASR::ttype_t* arg_type = ASRUtils::type_get_past_pointer(arg_types[0]);
+        ASR::ttype_t* element_type = ASRUtils::type_get_past_array(
+            ASRUtils::type_get_past_allocatable(arg_type));
 
         declare_basic_variables(new_name);
-        fill_func_arg_sub("r", ASRUtils::duplicate_type_with_empty_dims(al, arg_types[0]), InOut);
+        fill_func_arg_sub("r", ASRUtils::duplicate_type_with_empty_dims(al, arg_type), InOut);
         SymbolTable *fn_symtab_1 = al.make_new<SymbolTable>(fn_symtab);
         Vec<ASR::expr_t*> args_1; args_1.reserve(al, 0);
         ASR::expr_t *return_var_1 = b.Variable(fn_symtab_1, c_func_name,
-           ASRUtils::type_get_past_array(ASRUtils::type_get_past_allocatable(arg_types[0])),
-           ASRUtils::intent_return_var, ASR::abiType::BindC, false);
+           element_type, ASRUtils::intent_return_var, ASR::abiType::BindC, false);
         SetChar dep_1; dep_1.reserve(al, 1);
         Vec<ASR::stmt_t*> body_1; body_1.reserve(al, 1);
         ASR::symbol_t *s = make_ASR_Function_t(c_func_name, fn_symtab_1, dep_1, args_1,
@@ -308,20 +339,61 @@ namespace RandomNumber {
                 end do
             */
             ASR::dimension_t* array_dims = nullptr;
-            int array_rank = extract_dimensions_from_ttype(arg_types[0], array_dims);
+            int array_rank = extract_dimensions_from_ttype(arg_type, array_dims);
             std::vector<ASR::expr_t*> do_loop_variables;
             for (int i = 0; i < array_rank; i++) {
                 do_loop_variables.push_back(declare("i_" + std::to_string(i), int32, Local));
             }
-            ASR::stmt_t* func_call = b.CallIntrinsicSubroutine(scope, {ASRUtils::type_get_past_array(ASRUtils::type_get_past_allocatable(arg_types[0]))},
+            ASR::stmt_t* func_call = b.CallIntrinsicSubroutine(scope, {element_type},
                                     {b.ArrayItem_01(args[0], do_loop_variables)}, 0, RandomNumber::instantiate_RandomNumber);
             fn_name = scope->get_unique_name(fn_name, false);
-            body.push_back(al, PassUtils::create_do_loop_helper_random_number(al, loc, do_loop_variables, s, args[0],
-                    ASRUtils::type_get_past_array(ASRUtils::type_get_past_allocatable(arg_types[0])),
-                    b.ArrayItem_01(args[0], do_loop_variables), func_call, 1));
+            ASR::stmt_t* element_loop = PassUtils::create_do_loop_helper_random_number(al, loc, do_loop_variables, s, args[0],
+                    element_type, b.ArrayItem_01(args[0], do_loop_variables), func_call, 1);
+
+            /*
+                A contiguous array is filled in one runtime call, which
+                writes size(b) values from its first element on:
+
+                if (size(b) > 0 .and. is_contiguous(b)) then
+                    n_filled = _lfortran_dp_random_fill(size(b, kind=8), b(lbound(b, 1)))
+                else
+                    (the loop above)
+                end if
+            */
+            std::string fill_func_name = kind == 4 ? "_lfortran_sp_random_fill" : "_lfortran_dp_random_fill";
+            SymbolTable *fn_symtab_2 = al.make_new<SymbolTable>(fn_symtab);
+            Vec<ASR::expr_t*> args_2; args_2.reserve(al, 2);
+            args_2.push_back(al, b.Variable(fn_symtab_2, "n", int64,
+                ASR::intentType::In, ASR::abiType::BindC, true));
+            args_2.push_back(al, b.Variable(fn_symtab_2, "r", element_type,
+                ASR::intentType::InOut, ASR::abiType::BindC, false));
+            ASR::expr_t *return_var_2 = b.Variable(fn_symtab_2, fill_func_name, int64,
+                ASRUtils::intent_return_var, ASR::abiType::BindC, false);
+            SetChar dep_2; dep_2.reserve(al, 1);
+            Vec<ASR::stmt_t*> body_2; body_2.reserve(al, 1);
+            ASR::symbol_t *s_fill = make_ASR_Function_t(fill_func_name, fn_symtab_2, dep_2, args_2,
+                body_2, return_var_2, ASR::abiType::BindC, ASR::deftypeType::Interface, s2c(al, fill_func_name));
+            fn_symtab->add_symbol(fill_func_name, s_fill);
+            dep.push_back(al, s2c(al, fill_func_name));
+
+            std::vector<ASR::expr_t*> first_element;
+            for (int i = 0; i < array_rank; i++) {
+                first_element.push_back(LBound(args[0], i + 1));
+            }
+            Vec<ASR::expr_t*> fill_args; fill_args.reserve(al, 2);
+            fill_args.push_back(al, b.ArraySize(args[0], nullptr, int64));
+            fill_args.push_back(al, b.ArrayItem_01(args[0], first_element));
+            ASR::expr_t* n_filled = declare("n_filled", int64, Local);
+            ASR::expr_t* is_contiguous = ASRUtils::EXPR(ASR::make_ArrayIsContiguous_t(al, loc,
+                args[0], logical, nullptr));
+            body.push_back(al, b.If(b.And(b.Gt(b.ArraySize(args[0], nullptr, int32), b.i32(0)), is_contiguous), {
+                b.Assignment(n_filled, b.Call(s_fill, fill_args, int64))
+            }, {
+                element_loop
+            }));
         } else {
             Vec<ASR::expr_t*> call_args; call_args.reserve(al, 0);
-            body.push_back(al, b.Assignment(args[0], b.Call(s, call_args, arg_types[0])));
+            body.push_back(al, b.Assignment(args[0], b.Call(s, call_args, element_type)));
         }
         ASR::symbol_t *new_symbol = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
             body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
@@ -527,11 +527,21 @@ class DoConcurrentVisitor :
         int current_stmt_index = -1;
         ASR::stmt_t** current_m_body; size_t current_n_body;
         std::vector<std::string> reduction_variables;
+        // Call the LFortran runtime instead of GOMP
+        bool lfortran_runtime;
+        // Hand out the iterations in chunks to the threads that ask for them
+        bool dynamic_schedule;
+        // The interfaces in the global scope called by the function being
+        // outlined, see runtime_function()
+        SetChar runtime_dependencies;
     public:
         DoConcurrentVisitor(Allocator& al_, PassOptions pass_options_) :
-        al(al_), remove_original_statement(false), pass_options(pass_options_) {
+        al(al_), remove_original_statement(false), pass_options(pass_options_),
+        lfortran_runtime(pass_options_.do_concurrent_lfortran_runtime),
+        dynamic_schedule(pass_options_.do_concurrent_dynamic) {
             pass_result.n = 0;
             pass_result_allocatable.n = 0;
+            runtime_dependencies.reserve(al, 1);
         }
 
         void transform_stmts(ASR::stmt_t **&m_body, size_t &n_body) {
@@ -597,6 +607,7 @@ class DoConcurrentVisitor :
         std::string import_all(const ASR::Module_t* m, bool to_submodule=false) {
             // Import all symbols from the module, e.g.:
             //     use a
+            m->m_symtab->load_all_symbols();
             for (auto &item : m->m_symtab->get_scope()) {
                 if( current_scope->get_symbol(item.first) != nullptr ) {
                     continue;
@@ -746,6 +757,101 @@ class DoConcurrentVisitor :
             return module_sym;
         }
 
+        /*
+            Returns the runtime procedure `name` (as named in `omp_lib`, e.g.
+            `gomp_barrier`) to call from `scope`. For GOMP this is the symbol
+            imported from `omp_lib`. The procedures of the LFortran runtime, and
+            those of GOMP that `omp_lib` does not declare, get an interface in
+            the global scope instead.
+        */
+        ASR::symbol_t* runtime_function(SymbolTable* scope, const std::string &name, const Location &loc) {
+            // Arguments: `p` type(c_ptr), `i` integer(c_int), `l` integer(c_long)
+            // passed by value, `o` integer(c_long), intent(out).
+            // Result: `i` integer(c_int), `b` logical(c_bool), ` ` none.
+            struct Signature {
+                std::string gomp_name, lfortran_name, args;
+                char result;
+            };
+            static const std::map<std::string, Signature> signatures = {
+                {"gomp_parallel", {"GOMP_parallel", "_lfortran_parallel", "ppii", ' '}},
+                {"gomp_barrier", {"GOMP_barrier", "_lfortran_barrier", "", ' '}},
+                {"gomp_atomic_start", {"GOMP_atomic_start", "_lfortran_atomic_start", "", ' '}},
+                {"gomp_atomic_end", {"GOMP_atomic_end", "_lfortran_atomic_end", "", ' '}},
+                {"omp_get_max_threads", {"omp_get_max_threads", "_lfortran_get_num_threads", "", 'i'}},
+                {"omp_get_thread_num", {"omp_get_thread_num", "_lfortran_get_thread_num", "", 'i'}},
+                {"gomp_loop_dynamic_start", {"GOMP_loop_dynamic_start", "_lfortran_loop_dynamic_start", "lllloo", 'b'}},
+                {"gomp_loop_dynamic_next", {"GOMP_loop_dynamic_next", "_lfortran_loop_dynamic_next", "oo", 'b'}},
+                {"gomp_loop_end_nowait", {"GOMP_loop_end_nowait", "_lfortran_loop_end_nowait", "", ' '}},
+            };
+            const Signature &signature = signatures.at(name);
+            bool in_omp_lib = name.rfind("gomp_loop_", 0) != 0;
+            if (!lfortran_runtime && in_omp_lib) {
+                ASR::symbol_t* fn = scope->get_symbol(name);
+                LCOMPILERS_ASSERT(fn != nullptr);
+                return fn;
+            }
+            std::string bindc_name = lfortran_runtime ? signature.lfortran_name : signature.gomp_name;
+            std::string fn_name = to_lower(lfortran_runtime ? bindc_name.substr(1) : bindc_name);
+            SymbolTable* global_scope = scope;
+            while (global_scope->parent != nullptr) {
+                global_scope = global_scope->parent;
+            }
+            runtime_dependencies.push_back(al, s2c(al, fn_name));
+            if (ASR::symbol_t* fn = global_scope->get_symbol(fn_name)) {
+                return fn;
+            }
+            ASRUtils::ASRBuilder b(al, loc);
+            SymbolTable* fn_scope = al.make_new<SymbolTable>(global_scope);
+            Vec<ASR::expr_t*> args; args.reserve(al, signature.args.size());
+            for (size_t i = 0; i < signature.args.size(); i++) {
+                char kind = signature.args[i];
+                ASR::ttype_t* type = kind == 'p' ? b.CPtr()
+                    : ASRUtils::TYPE(ASR::make_Integer_t(al, loc, kind == 'i' ? 4 : 8));
+                args.push_back(al, b.Variable(fn_scope, "arg" + std::to_string(i), type,
+                    kind == 'o' ? ASR::intentType::Out : ASR::intentType::In,
+                    ASR::abiType::BindC, kind != 'o'));
+            }
+            ASR::expr_t* return_var = nullptr;
+            if (signature.result != ' ') {
+                ASR::ttype_t* type = signature.result == 'i'
+                    ? ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4))
+                    : ASRUtils::TYPE(ASR::make_Logical_t(al, loc, 1));
+                return_var = b.Variable(fn_scope, fn_name, type,
+                    ASR::intentType::ReturnVar, ASR::abiType::BindC);
+            }
+            ASR::symbol_t* fn = ASR::down_cast<ASR::symbol_t>(ASRUtils::make_Function_t_util(al, loc,
+                fn_scope, s2c(al, fn_name), nullptr, 0, args.p, args.n, nullptr, 0,
+                return_var, ASR::abiType::BindC, ASR::accessType::Public,
+                ASR::deftypeType::Interface, s2c(al, bindc_name), false, false, false, false, false,
+                nullptr, 0, false, false, false, nullptr));
+            global_scope->add_symbol(fn_name, fn);
+            return fn;
+        }
+
+        // Adds the interfaces collected in `runtime_dependencies` to the
+        // dependencies of the function that `scope` belongs to
+        void add_runtime_dependencies(SymbolTable* scope) {
+            while (scope->asr_owner && ASR::is_a<ASR::symbol_t>(*scope->asr_owner)
+                    && (ASR::is_a<ASR::Block_t>(*ASR::down_cast<ASR::symbol_t>(scope->asr_owner))
+                    || ASR::is_a<ASR::AssociateBlock_t>(*ASR::down_cast<ASR::symbol_t>(scope->asr_owner)))) {
+                scope = scope->parent;
+            }
+            if (runtime_dependencies.n == 0 || !scope->asr_owner
+                    || !ASR::is_a<ASR::symbol_t>(*scope->asr_owner)
+                    || !ASR::is_a<ASR::Function_t>(*ASR::down_cast<ASR::symbol_t>(scope->asr_owner))) {
+                return;
+            }
+            ASR::Function_t* fn = ASR::down_cast<ASR::Function_t>(
+                ASR::down_cast<ASR::symbol_t>(scope->asr_owner));
+            SetChar dependencies;
+            dependencies.from_pointer_n_copy(al, fn->m_dependencies, fn->n_dependencies);
+            for (size_t i = 0; i < runtime_dependencies.n; i++) {
+                dependencies.push_back(al, runtime_dependencies.p[i]);
+            }
+            fn->m_dependencies = dependencies.p;
+            fn->n_dependencies = dependencies.size();
+        }
+
         std::pair<std::string, ASR::symbol_t*> create_thread_data_module(std::map<std::string, ASR::ttype_t*> &involved_symbols, const Location& loc) {
             SymbolTable* current_scope_copy = current_scope;
             while (current_scope->parent != nullptr) {
@@ -829,6 +935,7 @@ class DoConcurrentVisitor :
                 current_scope = current_scope->parent;
             }
             current_scope = al.make_new<SymbolTable>(current_scope);
+            runtime_dependencies.reserve(al, 1);
             // load modules
             std::string unsupported_sym_name = import_all(ASR::down_cast<ASR::Module_t>(module_symbols[0]));
             LCOMPILERS_ASSERT(unsupported_sym_name == "");
@@ -932,8 +1039,12 @@ class DoConcurrentVisitor :
             ASR::expr_t* end = b.Variable(current_scope, current_scope->get_unique_name("end"), int_type, ASR::intentType::Local, ASR::abiType::BindC);
             ASR::expr_t* num_threads = b.Variable(current_scope, current_scope->get_unique_name("num_threads"), int_type, ASR::intentType::Local, ASR::abiType::BindC);
             ASR::expr_t* chunk = b.Variable(current_scope, current_scope->get_unique_name("chunk"), int_type, ASR::intentType::Local, ASR::abiType::BindC);
-            ASR::expr_t* leftovers = b.Variable(current_scope, current_scope->get_unique_name("leftovers"), int_type, ASR::intentType::Local, ASR::abiType::BindC);
-            ASR::expr_t* thread_num = b.Variable(current_scope, current_scope->get_unique_name("thread_num"), int_type, ASR::intentType::Local, ASR::abiType::BindC);
+            ASR::expr_t* leftovers = nullptr;
+            ASR::expr_t* thread_num = nullptr;
+            if (!dynamic_schedule) {
+                leftovers = b.Variable(current_scope, current_scope->get_unique_name("leftovers"), int_type, ASR::intentType::Local, ASR::abiType::BindC);
+                thread_num = b.Variable(current_scope, current_scope->get_unique_name("thread_num"), int_type, ASR::intentType::Local, ASR::abiType::BindC);
+            }
 
             // update all expr present in DoConcurrent to use the new symbols
             DoConcurrentStatementVisitor v(al, current_scope);
@@ -974,34 +1085,50 @@ class DoConcurrentVisitor :
             ASR::expr_t* loop_length = total_iterations;
             // ASR::expr_t* loop_length = b.Add(b.Sub(loop_head.m_end, loop_head.m_start), b.i32(1));
             // calculate chunk size
+            ASR::symbol_t* get_num_threads = runtime_function(current_scope, "omp_get_max_threads", loc);
             body.push_back(al, b.Assignment(num_threads,
-                            ASRUtils::EXPR(ASR::make_FunctionCall_t(al, loc, current_scope->get_symbol("omp_get_max_threads"),
-                            current_scope->get_symbol("omp_get_max_threads"), nullptr, 0, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)), nullptr, nullptr))));
-            body.push_back(al, b.Assignment(chunk,
-                            b.Div(loop_length, num_threads)));
-            Vec<ASR::expr_t*> mod_args; mod_args.reserve(al, 2);
-            mod_args.push_back(al, loop_length);
-            mod_args.push_back(al, num_threads);
-            body.push_back(al, b.Assignment(leftovers,
-                            ASRUtils::EXPR(ASRUtils::make_IntrinsicElementalFunction_t_util(al, loc,
-                            2,
-                            mod_args.p, 2, 0, ASRUtils::expr_type(loop_length), nullptr))));
-            body.push_back(al, b.Assignment(thread_num,
-                            ASRUtils::EXPR(ASR::make_FunctionCall_t(al, loc, current_scope->get_symbol("omp_get_thread_num"),
-                            current_scope->get_symbol("omp_get_thread_num"), nullptr, 0, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)), nullptr, nullptr))));
-            body.push_back(al, b.Assignment(start, b.Mul(chunk, thread_num)));
-            body.push_back(al, b.If(b.Lt(thread_num, leftovers), {
-                b.Assignment(start, b.Add(start, thread_num))
-            }, {
-                b.Assignment(start, b.Add(start, leftovers))
-            }));
-            body.push_back(al, b.Assignment(end, b.Add(start, chunk)));
-            body.push_back(al, b.If(b.Lt(thread_num, leftovers), {
-                b.Assignment(end, b.Add(end, b.i32(1)))
-            }, {
-                // do nothing
-            }));
-
+                            ASRUtils::EXPR(ASR::make_FunctionCall_t(al, loc, get_num_threads,
+                            get_num_threads, nullptr, 0, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)), nullptr, nullptr))));
+            if (dynamic_schedule) {
+                // chunk = --do-concurrent-chunk, or enough for 8 chunks per thread
+                if (pass_options.do_concurrent_chunk > 0) {
+                    body.push_back(al, b.Assignment(chunk, b.i32(pass_options.do_concurrent_chunk)));
+                } else {
+                    body.push_back(al, b.Assignment(chunk,
+                                    b.Div(loop_length, b.Mul(num_threads, b.i32(8)))));
+                    body.push_back(al, b.If(b.Lt(chunk, b.i32(1)), {
+                        b.Assignment(chunk, b.i32(1))
+                    }, {
+                        // do nothing
+                    }));
+                }
+            } else {
+                body.push_back(al, b.Assignment(chunk,
+                                b.Div(loop_length, num_threads)));
+                Vec<ASR::expr_t*> mod_args; mod_args.reserve(al, 2);
+                mod_args.push_back(al, loop_length);
+                mod_args.push_back(al, num_threads);
+                body.push_back(al, b.Assignment(leftovers,
+                                ASRUtils::EXPR(ASRUtils::make_IntrinsicElementalFunction_t_util(al, loc,
+                                2,
+                                mod_args.p, 2, 0, ASRUtils::expr_type(loop_length), nullptr))));
+                ASR::symbol_t* get_thread_num = runtime_function(current_scope, "omp_get_thread_num", loc);
+                body.push_back(al, b.Assignment(thread_num,
+                                ASRUtils::EXPR(ASR::make_FunctionCall_t(al, loc, get_thread_num,
+                                get_thread_num, nullptr, 0, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)), nullptr, nullptr))));
+                body.push_back(al, b.Assignment(start, b.Mul(chunk, thread_num)));
+                body.push_back(al, b.If(b.Lt(thread_num, leftovers), {
+                    b.Assignment(start, b.Add(start, thread_num))
+                }, {
+                    b.Assignment(start, b.Add(start, leftovers))
+                }));
+                body.push_back(al, b.Assignment(end, b.Add(start, chunk)));
+                body.push_back(al, b.If(b.Lt(thread_num, leftovers), {
+                    b.Assignment(end, b.Add(end, b.i32(1)))
+                }, {
+                    // do nothing
+                }));
+            }
             // Partioning logic ends
 
             // initialize reduction variables
@@ -1025,7 +1152,7 @@ class DoConcurrentVisitor :
                         if (ASRUtils::is_integer(*ASRUtils::expr_type(red.m_arg))) {
                             body.push_back(al, b.Assignment(red.m_arg, b.i_t(INT_MIN, ASRUtils::expr_type(red.m_arg))));
                         } else if (ASRUtils::is_real(*ASRUtils::expr_type(red.m_arg))) {
-                            body.push_back(al, b.Assignment(red.m_arg, b.f_t(std::numeric_limits<double>::min(), ASRUtils::expr_type(red.m_arg))));
+                            body.push_back(al, b.Assignment(red.m_arg, b.f_t(-std::numeric_limits<double>::max(), ASRUtils::expr_type(red.m_arg))));
                         } else {
                             // handle other types
                             LCOMPILERS_ASSERT(false);
@@ -1094,8 +1221,47 @@ class DoConcurrentVisitor :
             }
             //  Collapse Ends Here
 
-            body.push_back(al, b.DoLoop(I, b.Add(start, b.i32(1)), end, flattened_body, loop_head.m_increment));
-            body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc, current_scope->get_symbol("gomp_barrier"), nullptr, nullptr, 0, nullptr)));
+            ASR::stmt_t* loop = b.DoLoop(I, b.Add(start, b.i32(1)), end, flattened_body, loop_head.m_increment);
+            if (dynamic_schedule) {
+                /*
+                    more = gomp_loop_dynamic_start(0, loop_length, 1, chunk, istart, iend)
+                    do while (more)
+                        start = istart; end = iend
+                        ! ... the loop above ...
+                        more = gomp_loop_dynamic_next(istart, iend)
+                    end do
+                    call gomp_loop_end_nowait()
+                */
+                ASR::ttype_t* long_type = ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 8));
+                ASR::expr_t* istart = b.Variable(current_scope, current_scope->get_unique_name("istart"), long_type, ASR::intentType::Local, ASR::abiType::BindC);
+                ASR::expr_t* iend = b.Variable(current_scope, current_scope->get_unique_name("iend"), long_type, ASR::intentType::Local, ASR::abiType::BindC);
+                ASR::ttype_t* bool_type = ASRUtils::TYPE(ASR::make_Logical_t(al, loc, 1));
+                ASR::expr_t* more = b.Variable(current_scope, current_scope->get_unique_name("more"), bool_type, ASR::intentType::Local, ASR::abiType::BindC);
+                Vec<ASR::expr_t*> start_args; start_args.reserve(al, 6);
+                start_args.push_back(al, b.i64(0));
+                start_args.push_back(al, b.i2i_t(loop_length, long_type));
+                start_args.push_back(al, b.i64(1));
+                start_args.push_back(al, b.i2i_t(chunk, long_type));
+                start_args.push_back(al, istart);
+                start_args.push_back(al, iend);
+                Vec<ASR::expr_t*> next_args; next_args.reserve(al, 2);
+                next_args.push_back(al, istart);
+                next_args.push_back(al, iend);
+                body.push_back(al, b.Assignment(more, b.Call(
+                    runtime_function(current_scope, "gomp_loop_dynamic_start", loc), start_args, bool_type)));
+                body.push_back(al, b.While(more, {
+                    b.Assignment(start, b.i2i_t(istart, int_type)),
+                    b.Assignment(end, b.i2i_t(iend, int_type)),
+                    loop,
+                    b.Assignment(more, b.Call(
+                        runtime_function(current_scope, "gomp_loop_dynamic_next", loc), next_args, bool_type))
+                }));
+                body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
+                        runtime_function(current_scope, "gomp_loop_end_nowait", loc), nullptr, nullptr, 0, nullptr)));
+            } else {
+                body.push_back(al, loop);
+            }
+            body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc, runtime_function(current_scope, "gomp_barrier", loc), nullptr, nullptr, 0, nullptr)));
 
             /*
                 handle reduction variables if any then:
@@ -1105,7 +1271,7 @@ class DoConcurrentVisitor :
             */
             if (do_loop.n_reduction > 0) {
                 body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
-                        current_scope->get_symbol("gomp_atomic_start"), nullptr, nullptr, 0, nullptr)));
+                        runtime_function(current_scope, "gomp_atomic_start", loc), nullptr, nullptr, 0, nullptr)));
             }
             for ( size_t i = 0; i < do_loop.n_reduction; i++ ) {
                 ASR::reduction_expr_t red = do_loop.m_reduction[i];
@@ -1148,11 +1314,11 @@ class DoConcurrentVisitor :
             }
             if (do_loop.n_reduction > 0) {
                 body.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc,
-                        current_scope->get_symbol("gomp_atomic_end"), nullptr, nullptr, 0, nullptr)));
+                        runtime_function(current_scope, "gomp_atomic_end", loc), nullptr, nullptr, 0, nullptr)));
             }
 
             ASR::symbol_t* function = ASR::down_cast<ASR::symbol_t>(ASRUtils::make_Function_t_util(al, loc, current_scope, s2c(al, current_scope->parent->get_unique_name("lcompilers_function")),
-                nullptr, 0,
+                runtime_dependencies.p, runtime_dependencies.n,
                 args.p, args.n,
                 body.p, body.n,
                 nullptr, ASR::abiType::BindC, ASR::accessType::Public,
@@ -1179,7 +1345,7 @@ class DoConcurrentVisitor :
             Vec<ASR::expr_t*> args; args.reserve(al, 1);
             args.push_back(al, data_expr);
             ASR::symbol_t* interface_function = ASR::down_cast<ASR::symbol_t>(ASRUtils::make_Function_t_util(al, func->base.base.loc,
-                    current_scope, func->m_name, func->m_dependencies, func->n_dependencies,
+                    current_scope, func->m_name, nullptr, 0,
                     args.p, args.n, nullptr, 0, nullptr, ASR::abiType::BindC, ASR::accessType::Public,
                     ASR::deftypeType::Interface, nullptr, false, false, false, false, false, nullptr, 0,
                     false, false, false, nullptr));
@@ -1666,8 +1832,10 @@ class DoConcurrentVisitor :
             std::string unsupported_sym_name = import_all(ASR::down_cast<ASR::Module_t>(mod_sym));
             LCOMPILERS_ASSERT(unsupported_sym_name == "");
 
-            pass_result.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc, current_scope->get_symbol("gomp_parallel"), nullptr,
+            runtime_dependencies.reserve(al, 1);
+            pass_result.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc, runtime_function(current_scope, "gomp_parallel", x.base.base.loc), nullptr,
                                 call_args.p, call_args.n, nullptr)));
+            add_runtime_dependencies(current_scope);
 
             for (auto it: reduction_variables) {
                 ASR::symbol_t* actual_sym = current_scope->resolve_symbol(it);
@@ -1755,7 +1923,7 @@ class DoConcurrentVisitor :
 
 void pass_replace_openmp(Allocator &al, ASR::TranslationUnit_t &unit,
                             const PassOptions &pass_options) {
-    if (pass_options.openmp) {
+    if (pass_options.openmp || pass_options.do_concurrent_parallel) {
         DoConcurrentVisitor v(al, pass_options);
         v.visit_TranslationUnit(unit);
     }
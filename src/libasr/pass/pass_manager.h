@@ -59,6 +59,7 @@
 #include <libasr/pass/replace_array_passed_in_function_call.h>
 #include <libasr/pass/replace_openmp.h>
 #include <libasr/pass/replace_with_compile_time_values.h>
+#include <libasr/pass/function_local_pass.h>
 #include <libasr/codegen/asr_to_fortran.h>
 #include <libasr/asr_verify.h>
 #include <libasr/pickle.h>
@@ -121,6 +122,24 @@ namespace LCompilers {
             {"promote_allocatable_to_nonallocatable", &pass_promote_allocatable_to_nonallocatable},
             {"array_struct_temporary", &pass_array_struct_temporary}
         };
+        // Passes that can also be applied to one procedure at a time, on
+        // `pass_options.pass_jobs` threads
+        std::map<std::string, function_local_pass_function> _function_local_passes_db = {
+            {"do_loops", &pass_replace_do_loops_in_symbol},
+            {"where", &pass_replace_where_in_symbol},
+            {"print_arr", &pass_replace_print_arr_in_symbol},
+            {"div_to_mul", &pass_replace_div_to_mul_in_symbol}
+        };
+
+        void apply_pass(Allocator& al, ASR::TranslationUnit_t* asr,
+                        const std::string& pass, const PassOptions& pass_options) {
+            auto it = _function_local_passes_db.find(pass);
+            if (pass_options.pass_jobs != 1 && it != _function_local_passes_db.end()) {
+                apply_function_local_pass(al, *asr, it->second, pass_options);
+            } else {
+                _passes_db[pass](al, *asr, pass_options);
+            }
+        }
 
         bool apply_default_passes;
         bool c_skip_pass; // This will contain the passes that are to be skipped in C
@@ -186,7 +205,7 @@ namespace LCompilers {
                     std::cerr << "ASR Pass starts: '" << passes[i] << "'\n";
                 }
                 auto t1 = std::chrono::high_resolution_clock::now();
-                _passes_db[passes[i]](al, *asr, pass_options);
+                apply_pass(al, asr, passes[i], pass_options);
 #if defined(WITH_LFORTRAN_ASSERT)
                 if (!asr_verify(*asr, true, diagnostics)) {
                     std::cerr << diagnostics.render2();
@@ -360,7 +379,7 @@ namespace LCompilers {
                 if (pass_options.verbose) {
                     std::cerr << "ASR Pass starts: '" << passes[i] << "'\n";
                 }
-                _passes_db[passes[i]](al, *asr, pass_options);
+                apply_pass(al, asr, passes[i], pass_options);
                 if (pass_options.dump_all_passes) {
                     std::string str_i = std::to_string(pass_cnt_asr_dump+1);
                     if ( pass_cnt_asr_dump < 9 )  str_i = "0" + str_i;
@@ -414,6 +433,17 @@ namespace LCompilers {
             }
         }
 
+        // Identifies the configured pipeline: changes whenever the set of
+        // passes that `apply_passes` would run changes
+        std::string get_pipeline_key() const {
+            std::string key = apply_default_passes ? "default" : "none";
+            for (auto &pass : _user_defined_passes) key += ",+" + pass;
+            for (auto &pass : _skip_passes) key += ",-" + pass;
+            if (c_skip_pass) key += ",c_skip";
+            if (rtlib) key += ",rtlib";
+            return key;
+        }
+
         void use_default_passes(bool _c_skip_pass=false) {
             apply_default_passes = true;
             c_skip_pass = _c_skip_pass;
@@ -354,5 +354,13 @@ void pass_replace_print_arr(Allocator &al, ASR::TranslationUnit_t &unit,
     v.visit_TranslationUnit(unit);
 }
 
+void pass_replace_print_arr_in_symbol(Allocator &al, ASR::symbol_t &sym,
+                                      const LCompilers::PassOptions& pass_options) {
+    std::string rl_path = pass_options.runtime_library_dir;
+    PrintArrVisitor v(al, rl_path);
+    v.current_scope = ASRUtils::symbol_parent_symtab(&sym);
+    v.visit_symbol(sym);
+}
+
 
 } // namespace LCompilers
@@ -9,6 +9,10 @@ namespace LCompilers {
     void pass_replace_div_to_mul(Allocator &al, ASR::TranslationUnit_t &unit,
                                 const PassOptions &pass_options);
 
+    // Function-local variant, see `apply_function_local_pass()`
+    void pass_replace_div_to_mul_in_symbol(Allocator &al, ASR::symbol_t &sym,
+                                const PassOptions &pass_options);
+
 } // namespace LCompilers
 
 #endif // LIBASR_PASS_REPLACE_DIV_TO_MUL_H
@@ -9,6 +9,10 @@ namespace LCompilers {
     void pass_replace_print_arr(Allocator &al, ASR::TranslationUnit_t &unit,
                                 const PassOptions &pass_options);
 
+    // Function-local variant, see `apply_function_local_pass()`
+    void pass_replace_print_arr_in_symbol(Allocator &al, ASR::symbol_t &sym,
+                                const PassOptions &pass_options);
+
 } // namespace LCompilers
 
 #endif // LIBASR_PASS_REPLACE_PRINT_ARR_H
@@ -9,7 +9,7 @@
 #include<unordered_set>
 
 
-extern std::string lcompilers_unique_ID;
+extern thread_local std::string lcompilers_unique_ID;
 
 /*
 ASR pass for replacing symbol names with some new name, mostly because
@@ -79,7 +79,12 @@ class ReplaceArrayDimIntrinsicCalls: public ASR::BaseExprReplacer<ReplaceArrayDi
         if( x->m_dim != nullptr ) {
             int64_t dim = -1;
             ASRUtils::extract_value(x->m_dim, dim);
-            *current_expr = dims[dim - 1].m_length;
+            ASR::expr_t* dim_length = dims[dim - 1].m_length;
+            if( !ASRUtils::check_equal_type(ASRUtils::expr_type(dim_length), x->m_type) ) {
+                dim_length = ASRUtils::EXPR(ASR::make_Cast_t(al, x->base.base.loc,
+                    dim_length, ASR::cast_kindType::IntegerToInteger, x->m_type, nullptr));
+            }
+            *current_expr = dim_length;
             return ;
         }
 
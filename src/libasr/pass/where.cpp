@@ -119,5 +119,12 @@ void pass_replace_where(Allocator &al, ASR::TranslationUnit_t &unit,
     v.visit_TranslationUnit(unit);
 }
 
+void pass_replace_where_in_symbol(Allocator &al, ASR::symbol_t &sym,
+                                  const LCompilers::PassOptions& /*pass_options*/) {
+    TransformWhereVisitor v(al);
+    v.current_scope = ASRUtils::symbol_parent_symtab(&sym);
+    v.visit_symbol(sym);
+}
+
 
 } // namespace LCompilers
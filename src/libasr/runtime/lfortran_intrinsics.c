@@ -19,6 +19,8 @@
 #  include <io.h>
 #  define ftruncate _chsize_s
 #else
+#  include <fcntl.h>
+#  include <sys/uio.h>
 #  include <unistd.h>
 #endif
 
@@ -26,7 +28,12 @@
 #  include <sys/time.h>
 #endif
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
 #include <libasr/runtime/lfortran_intrinsics.h>
+#include <libasr/runtime/lfortran_powers_of_five.h>
 #include <libasr/config.h>
 
 #ifdef HAVE_RUNTIME_STACKTRACE
@@ -113,50 +120,302 @@ LFORTRAN_API double _lfortran_sum(int n, double *v)
     return r;
 }
 
-LFORTRAN_API void _lfortran_random_number(int n, double *v)
+/*
+ * Random numbers
+ *
+ * The generator is xoshiro256++. Every thread owns its generator, so
+ * random_number neither contends on shared state nor hands out overlapping
+ * sequences inside OpenMP regions. A generator advances RNG_LANES streams in
+ * lock step, laid out so that the update vectorizes, and hands out values
+ * from a block of RNG_LANES outputs. Filling an array in bulk therefore gives
+ * the same numbers as drawing its elements one at a time.
+ *
+ * All generators derive from one process-wide seed of RNG_SEED_SIZE 32-bit
+ * words, which random_seed(put=), random_init and srand replace. The seed is
+ * a xoshiro256++ state, xor'ed with `rng_seed_mask` so that small or zero
+ * seeds still give a well mixed state. Replacing it bumps a generation
+ * counter and each thread reseeds on its next draw: lane `j` of the `k`-th
+ * thread to draw starts `RNG_LANES*k + j` long jumps (2^192 steps each) past
+ * the seed. A long jump commutes with a step, so the lanes stay that far
+ * apart, and random_seed(get=) returns the live state of lane 0 of the
+ * calling thread: putting it back continues the sequence from there.
+ */
+
+#define RNG_LANES 4
+#define RNG_SEED_SIZE 8
+
+#if defined(_MSC_VER)
+#  define rng_thread_local __declspec(thread)
+#else
+#  define rng_thread_local __thread
+#endif
+
+#if defined(__GNUC__)
+#  define rng_atomic_load(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#  define rng_atomic_add(p, v) __atomic_add_fetch(p, v, __ATOMIC_ACQ_REL)
+#  define rng_atomic_exchange(p, v) __atomic_exchange_n(p, v, __ATOMIC_ACQUIRE)
+#  define rng_atomic_store(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+// All the variables used with these are int64_t
+#  define rng_atomic_load(p) _InterlockedOr64((volatile __int64*)(p), 0)
+#  define rng_atomic_add(p, v) \
+    (_InterlockedExchangeAdd64((volatile __int64*)(p), (v)) + (v))
+#  define rng_atomic_exchange(p, v) \
+    _InterlockedExchange64((volatile __int64*)(p), (v))
+#  define rng_atomic_store(p, v) \
+    ((void)_InterlockedExchange64((volatile __int64*)(p), (v)))
+#else
+#  define rng_atomic_load(p) (*(p))
+#  define rng_atomic_add(p, v) (*(p) += (v))
+#  define rng_atomic_exchange(p, v) (*(p) = (v), 0)
+#  define rng_atomic_store(p, v) (*(p) = (v))
+#endif
+
+struct rng_state {
+    uint64_t s[4][RNG_LANES];   // word `i` of lane `j` is s[i][j]
+    uint64_t out[RNG_LANES];
+    int next;                   // first unused entry of `out`
+    int64_t generation;         // of the seed `s` was expanded from
+    int64_t thread_id;          // 1-based, 0 until the first draw
+};
+
+static rng_thread_local struct rng_state rng_state;
+// `rng_seed_lock` guards `rng_seed`, which changes together with
+// `rng_generation`. Draws only read the generation, without the lock.
+static int64_t rng_seed_lock = 0;
+static uint32_t rng_seed[RNG_SEED_SIZE];
+// The first outputs of splitmix64 from 0
+static const uint64_t rng_seed_mask[4] = { 0xe220a8397b1dcdafULL,
+    0x6e789e6aa1b965f4ULL, 0x06c45d188009454fULL, 0xf88bb8a8724c81ecULL };
+static int64_t rng_generation = 1;
+static int64_t rng_threads = 0;
+
+static inline void rng_lock_seed()
 {
-    int i;
-    for (i=0; i < n; i++) {
-        v[i] = rand() / (double) RAND_MAX;
+    while (rng_atomic_exchange(&rng_seed_lock, 1) != 0) { }
+}
+
+static inline void rng_unlock_seed()
+{
+    rng_atomic_store(&rng_seed_lock, 0);
+}
+
+static inline uint64_t rng_rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t rng_splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static void rng_long_jump(uint64_t s[4])
+{
+    static const uint64_t LONG_JUMP[4] = { 0x76e15d3efefdcbbfULL,
+        0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL };
+    uint64_t t[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (LONG_JUMP[i] & ((uint64_t)1 << b)) {
+                for (int k = 0; k < 4; k++) t[k] ^= s[k];
+            }
+            uint64_t u = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= u;
+            s[3] = rng_rotl(s[3], 45);
+        }
+    }
+    for (int k = 0; k < 4; k++) s[k] = t[k];
+}
+
+// Writes the next output of every lane to `out` and advances the lanes
+static inline void rng_block(uint64_t s[4][RNG_LANES], uint64_t out[RNG_LANES])
+{
+    for (int j = 0; j < RNG_LANES; j++) {
+        out[j] = rng_rotl(s[0][j] + s[3][j], 23) + s[0][j];
+        uint64_t t = s[1][j] << 17;
+        s[2][j] ^= s[0][j];
+        s[3][j] ^= s[1][j];
+        s[1][j] ^= s[2][j];
+        s[0][j] ^= s[3][j];
+        s[2][j] ^= t;
+        s[3][j] = rng_rotl(s[3][j], 45);
+    }
+}
+
+static void rng_reseed(struct rng_state *g)
+{
+    if (g->thread_id == 0) {
+        g->thread_id = rng_atomic_add(&rng_threads, 1);
+    }
+    // Another thread may put a new seed meanwhile: take a consistent copy
+    // of the seed and the generation it belongs to
+    uint32_t seed[RNG_SEED_SIZE];
+    rng_lock_seed();
+    memcpy(seed, rng_seed, sizeof(seed));
+    int64_t generation = rng_generation;
+    rng_unlock_seed();
+    uint64_t s[4];
+    for (int i = 0; i < 4; i++) {
+        s[i] = (((uint64_t)seed[2*i] << 32) | seed[2*i+1]) ^ rng_seed_mask[i];
+    }
+    if ((s[0] | s[1] | s[2] | s[3]) == 0) {
+        // xoshiro256++ never leaves the zero state
+        uint64_t x = 1;
+        for (int i = 0; i < 4; i++) s[i] = rng_splitmix64(&x);
+    }
+    for (int64_t k = 0; k < (g->thread_id - 1) * RNG_LANES; k++) {
+        rng_long_jump(s);
+    }
+    for (int j = 0; j < RNG_LANES; j++) {
+        for (int i = 0; i < 4; i++) g->s[i][j] = s[i];
+        rng_long_jump(s);
+    }
+    g->next = RNG_LANES;
+    g->generation = generation;
+}
+
+static inline struct rng_state* rng_get()
+{
+    struct rng_state *g = &rng_state;
+    if (g->generation != rng_atomic_load(&rng_generation)) {
+        rng_reseed(g);
+    }
+    return g;
+}
+
+static inline uint64_t rng_next()
+{
+    struct rng_state *g = rng_get();
+    if (g->next == RNG_LANES) {
+        rng_block(g->s, g->out);
+        g->next = 0;
+    }
+    return g->out[g->next++];
+}
+
+static void rng_set_seed_locked(const uint32_t words[RNG_SEED_SIZE])
+{
+    memcpy(rng_seed, words, sizeof(rng_seed));
+    rng_atomic_add(&rng_generation, 1);
+}
+
+// Seeds from `n` words of entropy, expanded with splitmix64
+static void rng_set_seed(const uint32_t *words, int n)
+{
+    uint64_t x = 0;
+    uint32_t seed[RNG_SEED_SIZE];
+    for (int i = 0; i < 4; i++) {
+        uint64_t hi = 2*i < n ? words[2*i] : 0;
+        uint64_t lo = 2*i + 1 < n ? words[2*i+1] : 0;
+        x ^= (hi << 32) | lo;
+        uint64_t s = rng_splitmix64(&x) ^ rng_seed_mask[i];
+        seed[2*i] = (uint32_t)(s >> 32);
+        seed[2*i+1] = (uint32_t)s;
     }
+    rng_lock_seed();
+    rng_set_seed_locked(seed);
+    rng_unlock_seed();
+}
+
+// Uniform in [0, 1): the top 53 (24) bits scaled by 2^-53 (2^-24)
+#define rng_to_double(x) ((double)((x) >> 11) * (1.0 / 9007199254740992.0))
+#define rng_to_float(x) ((float)((x) >> 40) * (1.0f / 16777216.0f))
+
+#define RNG_DEFINE_FILL(name, type, convert)                                   \
+static void name(int64_t n, type *v)                                          \
+{                                                                             \
+    struct rng_state *g = rng_get();                                          \
+    int64_t i = 0;                                                            \
+    while (i < n && g->next < RNG_LANES) {                                    \
+        v[i++] = convert(g->out[g->next++]);                                  \
+    }                                                                         \
+    uint64_t s[4][RNG_LANES], r[RNG_LANES];                                   \
+    memcpy(s, g->s, sizeof(s));                                               \
+    for (; i + RNG_LANES <= n; i += RNG_LANES) {                              \
+        rng_block(s, r);                                                      \
+        for (int j = 0; j < RNG_LANES; j++) v[i + j] = convert(r[j]);         \
+    }                                                                         \
+    memcpy(g->s, s, sizeof(s));                                               \
+    if (i < n) {                                                              \
+        rng_block(g->s, g->out);                                              \
+        g->next = 0;                                                          \
+        while (i < n) v[i++] = convert(g->out[g->next++]);                    \
+    }                                                                         \
+}
+
+RNG_DEFINE_FILL(rng_fill_double, double, rng_to_double)
+RNG_DEFINE_FILL(rng_fill_float, float, rng_to_float)
+
+LFORTRAN_API void _lfortran_random_number(int n, double *v)
+{
+    rng_fill_double(n, v);
+}
+
+LFORTRAN_API int64_t _lfortran_sp_random_fill(int64_t n, float *v)
+{
+    rng_fill_float(n, v);
+    return n;
+}
+
+LFORTRAN_API int64_t _lfortran_dp_random_fill(int64_t n, double *v)
+{
+    rng_fill_double(n, v);
+    return n;
 }
 
 LFORTRAN_API int _lfortran_init_random_seed(unsigned seed)
 {
-    srand(seed);
+    uint32_t word = seed;
+    rng_set_seed(&word, 1);
     return seed;
 }
 
 LFORTRAN_API void _lfortran_init_random_clock()
 {
-    unsigned int count;
+    uint32_t words[4];
+    words[0] = (uint32_t)time(NULL);
+    words[1] = (uint32_t)clock();
 #if defined(_WIN32)
-    count = (unsigned int)clock();
+    words[2] = 0;
 #else
     struct timespec ts;
-    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-        count = (unsigned int)(ts.tv_nsec);
-    } else {
-        count = (unsigned int)clock();
-    }
+    words[2] = clock_gettime(CLOCK_MONOTONIC, &ts) == 0 ?
+        (uint32_t)ts.tv_nsec : 0;
 #endif
-    srand(count);
+    // Tells apart processes started within the same clock tick
+    words[3] = (uint32_t)(uintptr_t)&words;
+    rng_set_seed(words, 4);
 }
 
 LFORTRAN_API double _lfortran_random()
 {
-    return (rand() / (double) RAND_MAX);
+    return rng_to_double(rng_next());
+}
+
+// Uniform in [0, range) for 0 < range <= 2^32, by multiplying the top bits
+static inline int64_t rng_below(int64_t range)
+{
+    return (int64_t)(((rng_next() >> 32) * (uint64_t)range) >> 32);
 }
 
 LFORTRAN_API int _lfortran_randrange(int lower, int upper)
 {
-    int rr = lower + (rand() % (upper - lower));
+    int rr = lower + (int)rng_below((int64_t)upper - lower);
     return rr;
 }
 
 LFORTRAN_API int _lfortran_random_int(int lower, int upper)
 {
-    int randint = lower + (rand() % (upper - lower + 1));
+    int randint = lower + (int)rng_below((int64_t)upper - lower + 1);
     return randint;
 }
 
@@ -196,7 +455,335 @@ char* append_to_string(char* str, const char* append) {
     return str;
 }
 
-void handle_integer(char* format, int64_t val, char** result, bool is_signed_plus) {
+/*
+    A growable string that keeps track of its length and capacity, so that
+    appending to it costs amortized O(length of the appended string) instead
+    of a `strlen` and a `realloc` of the whole string each time.
+*/
+typedef struct string_builder {
+    char* str;
+    int64_t len;
+    int64_t capacity;
+} String_Builder;
+
+static void init_string_builder(String_Builder* sb, int64_t capacity) {
+    sb->str = (char*)malloc(capacity + 1);
+    sb->str[0] = '\0';
+    sb->len = 0;
+    sb->capacity = capacity;
+}
+
+// Makes room for `n` more characters (and the null character)
+static void reserve_string_builder(String_Builder* sb, int64_t n) {
+    if (sb->len + n > sb->capacity) {
+        int64_t capacity = 2 * sb->capacity;
+        if (capacity < sb->len + n) capacity = sb->len + n;
+        sb->str = (char*)realloc(sb->str, capacity + 1);
+        sb->capacity = capacity;
+    }
+}
+
+static void append_to_builder_n(String_Builder* sb, const char* append, int64_t n) {
+    reserve_string_builder(sb, n);
+    memcpy(sb->str + sb->len, append, n);
+    sb->len += n;
+    sb->str[sb->len] = '\0';
+}
+
+static void append_to_builder(String_Builder* sb, const char* append) {
+    append_to_builder_n(sb, append, strlen(append));
+}
+
+static void append_repeated_to_builder(String_Builder* sb, char c, int64_t n) {
+    if (n <= 0) return;
+    reserve_string_builder(sb, n);
+    memset(sb->str + sb->len, c, n);
+    sb->len += n;
+    sb->str[sb->len] = '\0';
+}
+
+static void truncate_string_builder(String_Builder* sb, int64_t len) {
+    if (len < sb->len) {
+        sb->len = len;
+        sb->str[len] = '\0';
+    }
+}
+
+/*
+ * Decimal conversion of reals
+ *
+ * `printf` is exact but slow for the conversions done by formatted output,
+ * as it works from the full decimal expansion of the value. Here the digits
+ * are taken from v * 10^s, computed with the 128-bit powers of five of
+ * `lfortran_powers_of_five.h`, whenever the error of that product cannot
+ * change them. The remaining values (the ones within the error of a
+ * rounding boundary) and results of more than 18 digits are left to
+ * `printf`, so the output is always the same as its.
+ */
+
+static inline void full_multiplication(uint64_t a, uint64_t b, uint64_t* hi, uint64_t* lo) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = (unsigned __int128)a * b;
+    *hi = (uint64_t)(r >> 64);
+    *lo = (uint64_t)r;
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    uint64_t p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+    uint64_t middle = (p0 >> 32) + (uint32_t)p1 + (uint32_t)p2;
+    *lo = (middle << 32) | (uint32_t)p0;
+    *hi = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+#endif
+}
+
+static inline int leading_zeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#else
+    int n = 0;
+    while (!(x & 0x8000000000000000ULL)) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+
+// The odd significand and the binary exponent of a finite v > 0
+static inline uint64_t decompose_real(double v, int* e) {
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    uint64_t m = bits & 0xFFFFFFFFFFFFFULL;
+    int biased_exponent = (int)(bits >> 52) & 0x7FF;
+    if (biased_exponent == 0) {
+        *e = -1074;
+    } else {
+        m |= 1ULL << 52;
+        *e = biased_exponent - 1075;
+    }
+    while (!(m & 1)) {
+        m >>= 1;
+        (*e)++;
+    }
+    return m;
+}
+
+/*
+ * floor(v * 10^s) if `round_to_nearest` is false, v * 10^s rounded half to
+ * even otherwise, for a finite v > 0. Returns false if the result is 2^63 or
+ * more, or if the error of the power of five could change it.
+ */
+static bool scale_real(double v, int s, bool round_to_nearest, uint64_t* n) {
+    if (s < LFORTRAN_POW5_MIN || s > LFORTRAN_POW5_MAX) return false;
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    uint64_t m = bits & 0xFFFFFFFFFFFFFULL;
+    int biased_exponent = (int)(bits >> 52) & 0x7FF;
+    int e;
+    if (biased_exponent == 0) {
+        e = -1074;
+    } else {
+        m |= 1ULL << 52;
+        e = biased_exponent - 1075;
+    }
+    int lz = leading_zeros(m);
+    m <<= lz;
+    e -= lz;
+
+    // 5^s = t * 2^(p - 127) with t in [2^127, 2^128) from the table, so
+    // v * 10^s = (m * t) * 2^-shift with the product in [2^190, 2^192)
+    int index = 2 * (s - LFORTRAN_POW5_MIN);
+    int p = (int)(((152170 + 65536) * (int64_t)s) >> 16) - s;
+    int shift = 127 - e - s - p;
+    if (shift < 129) return false;
+    uint64_t hi, lo, hi2, lo2;
+    full_multiplication(m, lfortran_pow5_128[index], &hi, &lo);
+    full_multiplication(m, lfortran_pow5_128[index + 1], &hi2, &lo2);
+    uint64_t middle = lo + hi2;
+    uint64_t upper = hi + (middle < lo);
+    // The product is exact for 0 <= s <= 55; otherwise it is within one unit
+    // of `middle` of the exact one
+    bool exact = (s >= 0 && s <= 55);
+
+    if (shift > 192) {
+        // v * 10^s < 1/2
+        bool near_half = (shift == 193 && upper == UINT64_MAX && middle >= UINT64_MAX - 2);
+        if (round_to_nearest && near_half && !exact) return false;
+        *n = 0;
+        return true;
+    }
+    // The integer part, the high word of the fraction and 1/2 in its units
+    uint64_t q, r, r_max, half;
+    if (shift == 192) {
+        q = 0;
+        r = upper;
+        r_max = UINT64_MAX;
+        half = 1ULL << 63;
+    } else {
+        q = upper >> (shift - 128);
+        r_max = (1ULL << (shift - 128)) - 1;
+        r = upper & r_max;
+        half = 1ULL << (shift - 129);
+    }
+
+    if (!round_to_nearest) {
+        if (!exact && ((r == 0 && middle < 2) || (r == r_max && middle > UINT64_MAX - 2))) {
+            return false;
+        }
+        *n = q;
+        return true;
+    }
+    if (exact) {
+        if (r > half || (r == half && (middle | lo2) != 0)) {
+            q++;
+        } else if (r == half && (q & 1)) {
+            q++;
+        }
+    } else if (r > half || (r == half && middle >= 2)) {
+        q++;
+    } else if (!(r + 1 < half || (r + 1 == half && middle <= UINT64_MAX - 3))) {
+        return false;
+    }
+    *n = q;
+    return true;
+}
+
+static const uint64_t powers_of_ten[19] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL
+};
+
+/*
+ * The first `digits` (1 to 18) significant digits of a finite v > 0, rounded
+ * half to even or truncated, as an integer `n` in [10^(digits-1), 10^digits)
+ * with v ~ n * 10^(exponent - digits + 1).
+ */
+static bool real_to_digits(double v, int digits, bool round_to_nearest,
+        uint64_t* n, int* exponent) {
+    int b;
+    frexp(v, &b);
+    // floor(log10(v)) is e or e + 1
+    int e = ((b - 1) * 78913) >> 18;
+    if (!scale_real(v, digits - 1 - e, round_to_nearest, n)) return false;
+    if (*n >= powers_of_ten[digits]) {
+        e++;
+        if (!scale_real(v, digits - 1 - e, round_to_nearest, n)) return false;
+    }
+    if (*n == powers_of_ten[digits]) {
+        // Rounded up to the next power of ten
+        *n = powers_of_ten[digits - 1];
+        e++;
+    }
+    if (*n < powers_of_ten[digits - 1] || *n >= powers_of_ten[digits]) return false;
+    *exponent = e;
+    return true;
+}
+
+// Writes the `digits` decimal digits of n, with leading zeros
+static inline void write_digits(char* buf, uint64_t n, int digits) {
+    for (int i = digits - 1; i >= 0; i--) {
+        buf[i] = (char)('0' + n % 10);
+        n /= 10;
+    }
+}
+
+static inline int count_digits(uint64_t n) {
+    int digits = 1;
+    while (digits < 19 && n >= powers_of_ten[digits]) digits++;
+    return digits;
+}
+
+// snprintf(buf, size, "%.*f", precision, v)
+static int format_fixed(char* buf, int size, int precision, double v) {
+    uint64_t n = 0;
+    if (isfinite(v) && precision >= 0 && precision + 22 <= size
+            && (v == 0 || scale_real(fabs(v), precision, true, &n))
+            && n < powers_of_ten[18]) {
+        int len = 0;
+        if (signbit(v)) buf[len++] = '-';
+        int digits = count_digits(n);
+        if (digits < precision + 1) digits = precision + 1;
+        write_digits(buf + len, n, digits);
+        len += digits;
+        if (precision > 0) {
+            memmove(buf + len - precision + 1, buf + len - precision, precision);
+            buf[len - precision] = '.';
+            len++;
+        }
+        buf[len] = '\0';
+        return len;
+    }
+    return snprintf(buf, size, "%.*f", precision, v);
+}
+
+// snprintf(buf, size, "%*.*e", width, precision, v)
+static int format_exponential(char* buf, int size, int width, int precision, double v) {
+    uint64_t n = 0;
+    int exponent = 0;
+    if (isfinite(v) && precision >= 0 && precision <= 17
+            && width + precision + 8 <= size
+            && (v == 0 || real_to_digits(fabs(v), precision + 1, true, &n, &exponent))) {
+        char digits[32];
+        int len = 0;
+        if (signbit(v)) digits[len++] = '-';
+        write_digits(digits + len, n, precision + 1);
+        if (precision > 0) {
+            memmove(digits + len + 2, digits + len + 1, precision);
+            digits[len + 1] = '.';
+            len++;
+        }
+        len += precision + 1;
+        digits[len++] = 'e';
+        digits[len++] = exponent < 0 ? '-' : '+';
+        int exponent_digits = abs(exponent) >= 100 ? 3 : 2;
+        write_digits(digits + len, abs(exponent), exponent_digits);
+        len += exponent_digits;
+        int padding = width > len ? width - len : 0;
+        memset(buf, ' ', padding);
+        memcpy(buf + padding, digits, len);
+        buf[padding + len] = '\0';
+        return padding + len;
+    }
+    return snprintf(buf, size, "%*.*e", width, precision, v);
+}
+
+/*
+ * The significant digits of the exact decimal expansion of a finite v > 0,
+ * as `handle_decimal` reads them: their number, and the first
+ * min(count, digits) of them (digits <= 17) in `buf`. Returns false if the
+ * expansion is longer than `max_decimals` decimals.
+ */
+static bool significant_digits(double v, int digits, int max_decimals,
+        char* buf, int* count) {
+    int e;
+    uint64_t m = decompose_real(v, &e);
+    uint64_t n;
+    int exponent;
+    if (e < -max_decimals || !real_to_digits(v, 17, false, &n, &exponent)) return false;
+    if (e < 0) {
+        // m * 2^e = m * 5^-e / 10^-e ends with the digit 5 at 10^e
+        *count = exponent - e + 1;
+    } else {
+        int fives = 0;
+        while (fives < e && m % 5 == 0) {
+            m /= 5;
+            fives++;
+        }
+        *count = exponent + 1 - fives;
+    }
+    char all[17];
+    write_digits(all, n, 17);
+    int len = *count < digits ? *count : digits;
+    memcpy(buf, all, len);
+    buf[len] = '\0';
+    return true;
+}
+
+void handle_integer(char* format, int64_t val, String_Builder* result, bool is_signed_plus) {
     int width = 0, min_width = 0;
     char* dot_pos = strchr(format, '.');
     int len;
@@ -225,26 +812,26 @@ void handle_integer(char* format, int64_t val, char** result, bool is_signed_plu
     if (width >= len + sign_width + sign_plus_exist || width == 0) {
         if (min_width > len) {
             for (int i = 0; i < (width - min_width - sign_width - sign_plus_exist); i++) {
-                *result = append_to_string(*result, " ");
+                append_to_builder(result, " ");
             }
             
             if (val < 0) {
-                *result = append_to_string(*result, "-");
+                append_to_builder(result, "-");
             } else if(sign_plus_exist){
-                *result = append_to_string(*result, "+");
+                append_to_builder(result, "+");
             }
 
             for (int i = 0; i < (min_width - len); i++) {
-                *result = append_to_string(*result, "0");
+                append_to_builder(result, "0");
             }
         } else {
             for (int i = 0; i < (width - len - sign_width - sign_plus_exist); i++) {
-                *result = append_to_string(*result, " ");
+                append_to_builder(result, " ");
             }
             if (val < 0) {
-                *result = append_to_string(*result, "-");
+                append_to_builder(result, "-");
             } else if (sign_plus_exist){
-                *result = append_to_string(*result, "+");
+                append_to_builder(result, "+");
             }
         }
         char str[20];
@@ -253,39 +840,35 @@ void handle_integer(char* format, int64_t val, char** result, bool is_signed_plu
         } else {
             sprintf(str, "%lld", llabs(val));
         }
-        *result = append_to_string(*result, str);
+        append_to_builder(result, str);
     } else {
-        for (int i = 0; i < width; i++) {
-            *result = append_to_string(*result, "*");
-        }
+        append_repeated_to_builder(result, '*', width);
     }
 }
 
-void handle_logical(char* format, bool val, char** result) {
+void handle_logical(char* format, bool val, String_Builder* result) {
     int width = atoi(format + 1);
     for (int i = 0; i < width - 1; i++) {
-        *result = append_to_string(*result, " ");
+        append_to_builder(result, " ");
     }
     if (val) {
-        *result = append_to_string(*result, "T");
+        append_to_builder(result, "T");
     } else {
-        *result = append_to_string(*result, "F");
+        append_to_builder(result, "F");
     }
 }
 
-void handle_float(char* format, double val, int scale, char** result, bool use_sign_plus) {
+void handle_float(char* format, double val, int scale, String_Builder* result, bool use_sign_plus) {
     val = val * pow(10, scale); // scale the value
     if (strcmp(format,"f-64") == 0) { //use c formatting.
-        char* float_str = (char*)malloc(50 * sizeof(char));
-        sprintf(float_str,"%23.17e",val);
-        *result = append_to_string(*result,float_str);
-        free(float_str);
+        char float_str[50];
+        int len = format_exponential(float_str, sizeof(float_str), 23, 17, val);
+        append_to_builder_n(result, float_str, len);
         return;
     } else if(strcmp(format,"f-32") == 0){ //use c formatting.
-        char* float_str = (char*)malloc(40 * sizeof(char));
-        sprintf(float_str,"%13.8e",val);
-        *result = append_to_string(*result,float_str);
-        free(float_str);
+        char float_str[40];
+        int len = format_exponential(float_str, sizeof(float_str), 13, 8, val);
+        append_to_builder_n(result, float_str, len);
         return;
     }
     int width = 0, decimal_digits = 0;
@@ -317,7 +900,7 @@ void handle_float(char* format, double val, int scale, char** result, bool use_s
     // TODO: This will work for up to `F65.60` but will fail for:
     // print "(F67.62)", 1.23456789101112e-62_8
     char dec_str[64];
-    sprintf(dec_str, "%.*f", decimal_digits, decimal_part);
+    format_fixed(dec_str, sizeof(dec_str), decimal_digits, decimal_part);
     // removing the leading "0." from the formatted decimal part
     memmove(dec_str, dec_str + 2, strlen(dec_str));
 
@@ -356,11 +939,9 @@ void handle_float(char* format, double val, int scale, char** result, bool use_s
 
     // checking for overflow
     if (strlen(formatted_value) > width) {
-        for (int i = 0; i < width; i++) {
-            *result = append_to_string(*result, "*");
-        }
+        append_repeated_to_builder(result, '*', width);
     } else {
-        *result = append_to_string(*result, formatted_value);
+        append_to_builder(result, formatted_value);
     }
 }
 
@@ -391,11 +972,9 @@ void parse_decimal_or_en_format(char* format, int* width_digits, int* decimal_di
 /*
 `handle_en` - Formats a floating-point number using a Fortran-style "EN" format.
 
-NOTE: The function allocates memory for the formatted result, which is returned via
-the `result` parameter. It is the responsibility of the caller to free this memory
-using `free(*result)` after it is no longer needed.
+NOTE: The formatted value is appended to `result`.
 */
-void handle_en(char* format, double val, int scale, char** result, char* c, bool is_signed_plus) {
+void handle_en(char* format, double val, int scale, String_Builder* result, char* c, bool is_signed_plus) {
     int width, decimal_digits, exp_digits;
     parse_decimal_or_en_format(format, &width, &decimal_digits, &exp_digits);
 
@@ -411,7 +990,7 @@ void handle_en(char* format, double val, int scale, char** result, char* c, bool
     double abs_val = fabs(val);
     if (is_g0_like) {
         if (abs_val == 0.0 || (abs_val >= 1.0 && abs_val < 1000.0)) {
-            snprintf(formatted_value, sizeof(formatted_value), "%.9f", val);
+            format_fixed(formatted_value, sizeof(formatted_value), 9, val);
         } else {
             // Engineering notation: scale exponent to multiple of 3
             int exponent = (int)floor(log10(abs_val));
@@ -421,7 +1000,7 @@ void handle_en(char* format, double val, int scale, char** result, char* c, bool
             double scaled_val = val / pow(10, exponent);
 
             char val_str[128];
-            snprintf(val_str, sizeof(val_str), "%.9f", scaled_val);
+            format_fixed(val_str, sizeof(val_str), 9, scaled_val);
             snprintf(formatted_value, sizeof(formatted_value),
                     "%s%s%+d", val_str, c, exponent);  // no padding, plain exponent
         }
@@ -436,57 +1015,69 @@ void handle_en(char* format, double val, int scale, char** result, char* c, bool
             scaled_val = val / pow(10, exponent);
         }
         char val_str[128];
-        snprintf(val_str, sizeof(val_str), "%.*f", decimal_digits, scaled_val);
+        format_fixed(val_str, sizeof(val_str), decimal_digits, scaled_val);
         snprintf(formatted_value, sizeof(formatted_value),
                 "%s%s%+0*d", val_str, c, exp_digits, exponent);
     }
 
     // Width == 0, no padding
     if (width == 0) {
-        if (sign_plus_exist) {
-            char* temp = malloc(strlen(formatted_value) + 2);
-            temp[0] = '+';
-            strcpy(temp + 1, formatted_value);
-            *result = append_to_string(*result, temp);
-            free(temp);
-        } else {
-            *result = append_to_string(*result, formatted_value);
-        }
+        if (sign_plus_exist) append_to_builder(result, "+");
+        append_to_builder(result, formatted_value);
         return;
     }
 
-    // Check for overflow
-    int total_len = strlen(formatted_value);
-    if (sign_plus_exist) total_len += 1;
-    
-    if (total_len > width) {
+    int len = strlen(formatted_value);
+    if (len + sign_plus_exist > width) {
         // Overflow: fill with '*'
-        char* final_result = malloc(width + 1);
-        memset(final_result, '*', width);
-        final_result[width] = '\0';
-        *result = append_to_string(*result, final_result);
-        free(final_result);
+        append_repeated_to_builder(result, '*', width);
         return;
     }
+    append_repeated_to_builder(result, ' ', width - len - sign_plus_exist);
+    if (sign_plus_exist) append_to_builder(result, "+");
+    append_to_builder_n(result, formatted_value, len);
+}
 
-    // Allocate and pad properly
-    char* final_result = malloc(width + 1);
-    int padding = width - strlen(formatted_value) - sign_plus_exist;
-    if (padding > 0) {
-        memset(final_result, ' ', padding);
-        if (sign_plus_exist) final_result[padding] = '+';
-        strcpy(final_result + padding + sign_plus_exist, formatted_value);
-    } else {
-        if (sign_plus_exist) final_result[0] = '+';
-        strncpy(final_result + is_signed_plus, formatted_value, width);
-        final_result[width] = '\0';
+#define SIGNIFICANT_DIGITS 17
+
+/*
+ * Writes the significant digits of the decimal expansion of val (rounded to
+ * `decimals` decimals) to `val_str`, without sign, decimal point and leading
+ * or trailing zeros ("0" for zero), and returns their number.
+ */
+static int exact_significant_digits(double val, int decimals, char* val_str) {
+    if (val == 0.0) {
+        strcpy(val_str, "0");
+        return 1;
+    }
+    sprintf(val_str, "%.*lf", decimals, val);
+    // val_str = "11230000128.00..."
+    int i = strlen(val_str) - 1;
+    while (val_str[i] == '0') {
+        val_str[i] = '\0';
+        i--;
+    }
+    // val_str = "11230000128."
+
+    char* ptr = strchr(val_str, '.');
+    if (ptr != NULL) {
+        memmove(ptr, ptr + 1, strlen(ptr));
+    }
+    // val_str = "11230000128"
+
+    if (val < 0) {
+        // removes `-` (negative) sign
+        memmove(val_str, val_str + 1, strlen(val_str));
     }
 
-    *result = append_to_string(*result, final_result);
-    free(final_result);
+    while (val_str[0] == '0') {
+        // Used for the case: 1.123e-10
+        memmove(val_str, val_str + 1, strlen(val_str));
+    }
+    return strlen(val_str);
 }
 
-void handle_decimal(char* format, double val, int scale, char** result, char* c, bool is_signed_plus) {
+void handle_decimal(char* format, double val, int scale, String_Builder* result, char* c, bool is_signed_plus) {
     // Consider an example: write(*, "(es10.2)") 1.123e+10
     // format = "es10.2", val = 11230000128.00, scale = 0, c = "E"
 
@@ -505,34 +1096,12 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
     #define MAX_SIZE 512
     char val_str[MAX_SIZE] = "";
     int avail_len_decimal_digits = MAX_SIZE - integer_length - sign_width - 2 /* 0.*/;
-    sprintf(val_str, "%.*lf", avail_len_decimal_digits, val);
-    // val_str = "11230000128.00..."
-    int i = strlen(val_str) - 1;
-    if (val != 0.0) {
-        while (val_str[i] == '0') {
-            val_str[i] = '\0';
-            i--;
-        }
-    }
-    // val_str = "11230000128."
-
-    char* ptr = strchr(val_str, '.');
-    if (ptr != NULL) {
-        memmove(ptr, ptr + 1, strlen(ptr));
-    }
-    // val_str = "11230000128"
-
-    if (val < 0) {
-        // removes `-` (negative) sign
-        memmove(val_str, val_str + 1, strlen(val_str));
-    }
-
-    int decimal = 1;
-    while (val_str[0] == '0') {
-        // Used for the case: 1.123e-10
-        memmove(val_str, val_str + 1, strlen(val_str));
-        decimal--;
-        // loop end: decimal = -9
+    // The number of significant digits of val; `val_str` holds all of them
+    // or, when there are more, the first SIGNIFICANT_DIGITS
+    int significant_count;
+    if (val == 0.0 || !isfinite(val) || !significant_digits(fabs(val),
+            SIGNIFICANT_DIGITS, avail_len_decimal_digits, val_str, &significant_count)) {
+        significant_count = exact_significant_digits(val, avail_len_decimal_digits, val_str);
     }
     bool is_s_format = false;
     if (tolower(format[1]) == 's') {
@@ -542,7 +1111,6 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
     int exponent_value = 0;
     if (val == 0.0) {
         exponent_value = 0;
-        strcpy(val_str, "0");
         integer_length = 1;
     } else {
         exponent_value = (int)floor(log10(fabs(val))) - scale + 1;
@@ -589,8 +1157,26 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
         goto overflow;
     }
     int val_str_len = strlen(val_str);
-    int zeroes_needed = digits - (val_str_len - integer_length);
-    if (zeroes_needed < 0) zeroes_needed = 0;
+    if (val_str_len < significant_count) {
+        // Only the first SIGNIFICANT_DIGITS are known: enough unless more
+        // of them are copied below
+        int scaled_digits = (scale > 1) ? digits - (scale - 1) : digits;
+        bool enough;
+        if (scale <= 0) {
+            enough = digits + scale <= SIGNIFICANT_DIGITS;
+        } else if (scaled_digits + scale <= 15) {
+            enough = scaled_digits >= 0 && scale + 15 <= SIGNIFICANT_DIGITS;
+        } else {
+            enough = scale + scaled_digits <= SIGNIFICANT_DIGITS;
+        }
+        if (!enough) {
+            significant_count = exact_significant_digits(val, avail_len_decimal_digits, val_str);
+            val_str_len = significant_count;
+        }
+    }
+    int zeroes_needed = digits - (significant_count - integer_length);
+    // The zeros would follow digits that are not read
+    if (zeroes_needed < 0 || val_str_len < significant_count) zeroes_needed = 0;
     if (zeroes_needed > MAX_SIZE - val_str_len - 1) zeroes_needed = MAX_SIZE - val_str_len - 1;
 
     for(int i = 0; i < zeroes_needed && val_str_len + i < MAX_SIZE - 1; i++) {
@@ -633,15 +1219,17 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
         }
         strncat(formatted_value, val_str, digits + scale - zeros);
     } else {
-        char* temp = substring(val_str, 0, scale);
-        strcat(formatted_value, temp);
+        strncat(formatted_value, val_str, scale);
         strcat(formatted_value, ".");
         // formatted_value = "  1."
-        char* new_str = substring(val_str, scale, strlen(val_str));
+        char new_str[MAX_SIZE] = "";
+        if (scale < (int)strlen(val_str)) {
+            strcpy(new_str, val_str + scale);
+        }
         // new_str = "1230000128" case:  1.123e+10
         int zeros = 0;
         if (digits < strlen(new_str) && digits + scale <= 15) {
-            new_str[15] = '\0';
+            if (strlen(new_str) > 15) new_str[15] = '\0';
             zeros = strspn(new_str, "0");
             long long t = (long long)round((long double)atoll(new_str) / (long long) pow(10, (strlen(new_str) - digits)));
             sprintf(new_str, "%lld", t);
@@ -652,11 +1240,9 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
                 new_str[0] = '0';
             }
         }
-        new_str[digits] = '\0';
+        if (digits >= 0 && digits < (int)strlen(new_str)) new_str[digits] = '\0';
         strcat(formatted_value, new_str);
         // formatted_value = "  1.12"
-        free(new_str);
-        free(temp);
     }
 
     if (!(width_digits == 0 && decimal_digits == 0 && exponent_value == 0)) {
@@ -670,21 +1256,19 @@ void handle_decimal(char* format, double val, int scale, char** result, char* c,
     if (strlen(formatted_value) > width) {
         if (strlen(formatted_value) - width == 1 && formatted_value[0] == '0') {
             memmove(formatted_value, formatted_value + 1, strlen(formatted_value));
-            *result = append_to_string(*result, formatted_value);
+            append_to_builder(result, formatted_value);
             return;
         } else {
             goto overflow;
         }
     } else {
-        *result = append_to_string(*result, formatted_value);
+        append_to_builder(result, formatted_value);
         return;
         // result = "  1.12E+10"
     }
 
     overflow:
-    for (int i = 0; i < width; i++) {
-        *result = append_to_string(*result, "*");
-    }
+    append_repeated_to_builder(result, '*', width);
     return;
 }
 
@@ -999,24 +1583,30 @@ bool is_format_match(char format_value, Primitive_Types current_arg_type){
     }
 }
 
+#define STACK_INLINE_SIZE 10
+
 typedef struct stack {
     int64_t* p;
     int32_t stack_size;
     int32_t top_index;
-} Stack;  
+    int64_t inline_storage[STACK_INLINE_SIZE]; // Used until the stack grows
+} Stack;
 
-Stack* create_stack(){
-    Stack* s = (Stack*)malloc(sizeof(Stack));
-    s->stack_size = 10; // intial value
-    s->p = (int64_t*)malloc(s->stack_size * sizeof(int64_t));
+void init_stack(Stack* s){
+    s->stack_size = STACK_INLINE_SIZE;
+    s->p = s->inline_storage;
     s->top_index = -1;
-    return s;
 }
 
 void push_stack(Stack* x, int64_t val){
     if(x->top_index == x->stack_size - 1){ // Check if extending is needed.
         x->stack_size *= 2;
-        x->p = (int64_t*)realloc(x->p, x->stack_size * sizeof(int64_t));
+        if(x->p == x->inline_storage){
+            x->p = (int64_t*)malloc(x->stack_size * sizeof(int64_t));
+            memcpy(x->p, x->inline_storage, sizeof(x->inline_storage));
+        } else {
+            x->p = (int64_t*)realloc(x->p, x->stack_size * sizeof(int64_t));
+        }
     }
     x->p[++x->top_index] = val;
 }
@@ -1037,8 +1627,7 @@ static inline bool stack_empty(Stack* s){
     return s->top_index == -1;
 }
 void free_stack(Stack* x){
-    free(x->p);
-    free(x);
+    if(x->p != x->inline_storage) free(x->p);
 }
 
 
@@ -1058,6 +1647,7 @@ typedef struct serialization_info{
     struct runtime_sizes_lengths{ // Passed array sizes or string legnths.
         int64_t* ptr;
         int32_t current_index;
+        int64_t inline_storage[8]; // Used for `ptr` when they fit
     } array_sizes, string_lengths;
     bool just_peeked; // Flag to indicate if we just peeked the next element.
     char* temp_char_pp; // Dummy container (Should be removed)
@@ -1286,9 +1876,12 @@ void print_into_string(Serialization_Info* s_info,  char* result){
                 double real = *(double*)arg;
                 move_to_next_element(s_info, false);
                 double imag = *(double*)s_info->current_arg_info.current_arg;
-                sprintf(result, "(%23.17e, %23.17e)", real, imag);
+                char real_str[48], imag_str[48];
+                format_exponential(real_str, sizeof(real_str), 23, 17, real);
+                format_exponential(imag_str, sizeof(imag_str), 23, 17, imag);
+                sprintf(result, "(%s, %s)", real_str, imag_str);
             } else {
-                sprintf(result, "%23.17e", *(double*)arg);
+                format_exponential(result, 48, 23, 17, *(double*)arg);
             }
             break;
         case FLOAT_32_TYPE:
@@ -1296,9 +1889,12 @@ void print_into_string(Serialization_Info* s_info,  char* result){
                 float real = *(float*)arg;
                 move_to_next_element(s_info, false);
                 double imag = *(float*)s_info->current_arg_info.current_arg;
-                sprintf(result, "(%13.8e, %13.8e)", real, imag);
+                char real_str[32], imag_str[32];
+                format_exponential(real_str, sizeof(real_str), 13, 8, real);
+                format_exponential(imag_str, sizeof(imag_str), 13, 8, imag);
+                sprintf(result, "(%s, %s)", real_str, imag_str);
             } else {
-                sprintf(result, "%13.8e", *(float*)arg);
+                format_exponential(result, 32, 13, 8, *(float*)arg);
             }
             break;
         case LOGICAL_TYPE:
@@ -1352,13 +1948,10 @@ void strip_outer_parenthesis(const char* str, int len, char* output) {
     }
 }
 
-void default_formatting(char** result, struct serialization_info* s_info){
-    int64_t result_capacity = 100;
-    int64_t result_size = 0;
+void default_formatting(String_Builder* result, struct serialization_info* s_info){
     const int default_spacing_len = 4;
     const char* default_spacing = "    ";
     ASSERT(default_spacing_len == strlen(default_spacing));
-    *result = realloc(*result, result_capacity + 1 /*Null Character*/ );
 
     while(move_to_next_element(s_info, false)){
         int size_to_allocate;
@@ -1369,66 +1962,146 @@ void default_formatting(char** result, struct serialization_info* s_info){
         } else {
             size_to_allocate = (60 + default_spacing_len) * sizeof(char);
         }
-        int64_t old_capacity = result_capacity;
-        while(result_capacity <= size_to_allocate + result_size){ // Check if string extension is needed.
-            if(result_size + size_to_allocate > result_capacity*2){
-                result_capacity = size_to_allocate + result_size ;
-            } else {
-                result_capacity *=2;
-            }
+        reserve_string_builder(result, size_to_allocate);
+        if(result->len > 0){
+            append_to_builder_n(result, default_spacing, default_spacing_len);
         }
-        if(result_capacity != old_capacity){*result = (char*)realloc(*result, result_capacity + 1);}
-        if(result_size > 0){
-            strcpy((*result)+result_size, default_spacing);
-            result_size+=default_spacing_len;
-        }
-        print_into_string(s_info,  (*result) + result_size);
-        int64_t printed_arg_size = strlen((*result) + result_size);
-        result_size += printed_arg_size;
+        print_into_string(s_info, result->str + result->len);
+        result->len += strlen(result->str + result->len);
     }
 }
 void free_serialization_info(Serialization_Info* s_info){
-    free(s_info->array_sizes.ptr);
-    free(s_info->string_lengths.ptr);
+    if(s_info->array_sizes.ptr != s_info->array_sizes.inline_storage){
+        free(s_info->array_sizes.ptr);
+    }
+    if(s_info->string_lengths.ptr != s_info->string_lengths.inline_storage){
+        free(s_info->string_lengths.ptr);
+    }
     free_stack(s_info->array_sizes_stack);
     free_stack(s_info->array_serialiation_start_index);
-    va_end(*s_info->current_arg_info.args);
 }
 
-LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const char* serialization_string, 
-    int32_t array_sizes_cnt, int32_t string_lengths_cnt, ...)
+/*
+    A format string split into its edit descriptors (see
+    `parse_fortran_format`), with every parenthesized group expanded in
+    place, as the first pass over the format would do it. The descriptor of
+    an expanded group is left as NULL, so that `item_start` (where format
+    reversion restarts) stays valid. It does not depend on the items being
+    formatted, so a constant format only has to be parsed once.
+*/
+typedef struct fortran_format {
+    char** values;
+    int64_t count;
+    int64_t item_start;
+} Fortran_Format;
+
+static Fortran_Format* parse_format(const char* format) {
+    Fortran_Format* fmt = (Fortran_Format*)malloc(sizeof(Fortran_Format));
+    char* cleaned_format = remove_spaces_except_quotes(format);
+    strip_outer_parenthesis(cleaned_format, strlen(cleaned_format), cleaned_format);
+    fmt->count = 0;
+    fmt->item_start = 0;
+    fmt->values = parse_fortran_format(cleaned_format, &fmt->count, &fmt->item_start);
+    free(cleaned_format);
+    for (int64_t i = 0; i < fmt->count; i++) {
+        char* value = fmt->values[i];
+        size_t len = strlen(value);
+        if (value[0] != '(' || value[len - 1] != ')') continue;
+        value[len - 1] = '\0';
+        int64_t group_count = 0;
+        char** group = parse_fortran_format(value + 1, &group_count, &fmt->item_start);
+        fmt->values = (char**)realloc(fmt->values, (fmt->count + group_count + 1) * sizeof(char*));
+        memmove(fmt->values + i + 1 + group_count, fmt->values + i + 1,
+            (fmt->count - i - 1) * sizeof(char*));
+        memcpy(fmt->values + i + 1, group, group_count * sizeof(char*));
+        fmt->count += group_count;
+        free(value);
+        fmt->values[i] = NULL;
+        free(group);
+    }
+    return fmt;
+}
+
+static void free_format(Fortran_Format* fmt) {
+    for (int64_t i = 0; i < fmt->count; i++) {
+        free(fmt->values[i]);
+    }
+    free(fmt->values);
+    free(fmt);
+}
+
+static void read_runtime_sizes(struct runtime_sizes_lengths* sizes, int32_t cnt, va_list* args){
+    sizes->current_index = 0;
+    if(cnt <= (int32_t)(sizeof(sizes->inline_storage)/sizeof(int64_t))){
+        sizes->ptr = sizes->inline_storage;
+    } else {
+        sizes->ptr = (int64_t*) malloc(cnt * sizeof(int64_t));
+    }
+    for(int i=0; i<cnt; i++){
+        sizes->ptr[i] = va_arg(*args, int64_t);
+    }
+}
+
+/*
+    A format cache may be filled by several threads at once: each parses the
+    format, and all but the first to publish its result free their own.
+*/
+static inline Fortran_Format* load_format_cache(Fortran_Format** cache) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return (Fortran_Format*)_InterlockedCompareExchangePointer(
+        (void* volatile*)cache, NULL, NULL);
+#else
+    return __atomic_load_n(cache, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static Fortran_Format* publish_format_cache(Fortran_Format** cache,
+    Fortran_Format* fmt) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    Fortran_Format* published = (Fortran_Format*)
+        _InterlockedCompareExchangePointer((void* volatile*)cache, fmt, NULL);
+#else
+    Fortran_Format* published = NULL;
+    __atomic_compare_exchange_n(cache, &published, fmt, false,
+        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+    if (published != NULL) {
+        free_format(fmt);
+        return published;
+    }
+    return fmt;
+}
+
+/*
+    Formats the items in `args` according to `format` (NULL for list
+    directed output). If `cache` is not NULL, it holds the parsed `format`
+    from a previous call (NULL before the first one), and `format` must be
+    the same string on every call.
+*/
+static char* string_format_fortran(const char* format, Fortran_Format** cache,
+    const char* serialization_string, int32_t array_sizes_cnt,
+    int32_t string_lengths_cnt, va_list* args)
 {
-    va_list args;
-    va_start(args, string_lengths_cnt);
-    char* result = (char*)malloc(sizeof(char)); //TODO : the consumer of this string needs to free it.
-    result[0] = '\0';
+    String_Builder result;
+    init_string_builder(&result, 100);
 
     // Setup s_info
     struct serialization_info s_info;
+    Stack array_serialiation_start_index, array_sizes_stack;
+    init_stack(&array_serialiation_start_index);
+    init_stack(&array_sizes_stack);
     s_info.serialization_string = serialization_string;
-    s_info.array_serialiation_start_index = create_stack();
-    s_info.array_sizes_stack = create_stack();
+    s_info.array_serialiation_start_index = &array_serialiation_start_index;
+    s_info.array_sizes_stack = &array_sizes_stack;
     s_info.current_stop = 0;
-    s_info.current_arg_info.args = &args;
+    s_info.current_arg_info.args = args;
     s_info.current_element_type = NONE_TYPE;
     s_info.current_arg_info.is_complex = false;
-    s_info.array_sizes.current_index = 0;
-    s_info.string_lengths.current_index = 0;
     s_info.just_peeked = false;
+    read_runtime_sizes(&s_info.array_sizes, array_sizes_cnt, args);
+    read_runtime_sizes(&s_info.string_lengths, string_lengths_cnt, args);
 
-    int64_t* array_sizes = (int64_t*) malloc(array_sizes_cnt * sizeof(int64_t));
-    for(int i=0; i<array_sizes_cnt; i++){
-        array_sizes[i] = va_arg(args, int64_t);
-    }
-    s_info.array_sizes.ptr = array_sizes;
-
-    int64_t* string_lengths = (int64_t*) malloc(string_lengths_cnt * sizeof(int64_t));
-    for(int i=0; i<string_lengths_cnt; i++){
-        string_lengths[i] = va_arg(args, int64_t);
-    }
-    s_info.string_lengths.ptr = string_lengths;
-
-    s_info.current_arg_info.current_arg = va_arg(args, void*);
+    s_info.current_arg_info.current_arg = va_arg(*args, void*);
 
     if(!s_info.current_arg_info.current_arg && 
         s_info.serialization_string[s_info.current_stop] !='\0')
@@ -1437,23 +2110,21 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
     if(format == NULL){
         default_formatting(&result, &s_info);
         free_serialization_info(&s_info);
-        return result;
+        return result.str;
     }
 
-    int64_t format_values_count = 0,item_start_idx=0;
-    char** format_values;
-    char* modified_input_string;
-    char* cleaned_format = remove_spaces_except_quotes(format);
-    if (!cleaned_format) {
-        free_serialization_info(&s_info);
-        return NULL;
+    Fortran_Format* fmt;
+    if (cache == NULL) {
+        fmt = parse_format(format);
+    } else {
+        fmt = load_format_cache(cache);
+        if (fmt == NULL) {
+            fmt = publish_format_cache(cache, parse_format(format));
+        }
     }
-    int len = strlen(cleaned_format);
-    modified_input_string = (char*)malloc((len+1) * sizeof(char));
-    strncpy(modified_input_string, cleaned_format, len);
-    modified_input_string[len] = '\0';
-    strip_outer_parenthesis(cleaned_format, len, modified_input_string);
-    format_values = parse_fortran_format(modified_input_string, &format_values_count, &item_start_idx);
+    char** format_values = fmt->values;
+    int64_t format_values_count = fmt->count;
+    int64_t item_start_idx = fmt->item_start;
     /*
     is_SP_specifier = false  --> 'S' OR 'SS'
     is_SP_specifier = true  --> 'SP'
@@ -1470,35 +2141,11 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
             char* value;
             if(format_values[i] == NULL) continue;
             value = format_values[i];
-            if (value[0] == '(' && value[strlen(value)-1] == ')') {
-                value[strlen(value)-1] = '\0';
-                int64_t new_fmt_val_count = 0;
-                char** new_fmt_val = parse_fortran_format(++value, &new_fmt_val_count, &item_start_idx);
-                char** ptr = (char**)realloc(format_values, (format_values_count + new_fmt_val_count + 1) * sizeof(char*));
-                if (ptr == NULL) {
-                    perror("Memory allocation failed.\n");
-                    free(format_values);
-                } else {
-                    format_values = ptr;
-                }
-                for (int k = format_values_count - 1; k >= i+1; k--) {
-                    format_values[k + new_fmt_val_count] = format_values[k];
-                }
-                for (int k = 0; k < new_fmt_val_count; k++) {
-                    format_values[i + 1 + k] = new_fmt_val[k];
-                }
-                format_values_count = format_values_count + new_fmt_val_count;
-                free(format_values[i]);
-                format_values[i] = NULL;
-                free(new_fmt_val);
-                continue;
-            }
-
             if (value[0] == ':') {
                 if (!move_to_next_element(&s_info, true)) break;
                 continue;
             } else if (value[0] == '/') {
-                result = append_to_string(result, "\n");
+                append_to_builder(&result, "\n");
             } else if (value[0] == '*') {
                 array = true;
             } else if (isdigit(value[0]) && tolower(value[1]) == 'p') {
@@ -1510,11 +2157,9 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
             } else if ((value[0] == '\"' && value[strlen(value) - 1] == '\"') ||
                 (value[0] == '\'' && value[strlen(value) - 1] == '\'')) {
                 // String
-                value = substring(value, 1, strlen(value) - 1);
-                result = append_to_string(result, value);
-                free(value);
+                append_to_builder_n(&result, value + 1, strlen(value) - 2);
             } else if (tolower(value[strlen(value) - 1]) == 'x') {
-                result = append_to_string(result, " ");
+                append_to_builder(&result, " ");
             } else if (tolower(value[0]) == 's') {
                 is_SP_specifier = ( strlen(value) == 2 /*case 'S' specifier*/ &&
                                     tolower(value[1]) == 'p'); 
@@ -1522,42 +2167,25 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                 if (tolower(value[1]) == 'l') {
                     // handle "TL" format specifier
                     int tab_left_pos = atoi(value + 2);
-                    int current_length = strlen(result);
-                    if (tab_left_pos > current_length) {
-                        result[0] = '\0';
+                    if (tab_left_pos > result.len) {
+                        truncate_string_builder(&result, 0);
                     } else {
-                        result[current_length - tab_left_pos] = '\0';
+                        truncate_string_builder(&result, result.len - tab_left_pos);
                     }
                 } else if (tolower(value[1]) == 'r') {
                     // handle "TR" format specifier
                     int tab_right_pos = atoi(value + 2);
-                    int current_length = strlen(result);
-                    int spaces_needed = tab_right_pos;
-                    if (spaces_needed > 0) {
-                        char* spaces = (char*)malloc((spaces_needed + 1) * sizeof(char));
-                        memset(spaces, ' ', spaces_needed);
-                        spaces[spaces_needed] = '\0';
-                        result = append_to_string(result, spaces);
-                        free(spaces);
-                    }
+                    append_repeated_to_builder(&result, ' ', tab_right_pos);
                 } else {
                     if (!move_to_next_element(&s_info, true)) break;
                     int tab_position = atoi(value + 1);
-                    int current_length = strlen(result);
-                    int spaces_needed = tab_position - current_length - 1;
+                    int spaces_needed = tab_position - result.len - 1;
                     if (spaces_needed > 0) {
-                        char* spaces = (char*)malloc((spaces_needed + 1) * sizeof(char));
-                        memset(spaces, ' ', spaces_needed);
-                        spaces[spaces_needed] = '\0';
-                        result = append_to_string(result, spaces);
-                        free(spaces);
+                        append_repeated_to_builder(&result, ' ', spaces_needed);
                     } else if (spaces_needed < 0) {
-                        // Truncate the string to the length specified by Tn
+                        // Truncate the string at the position specified by Tn
                         // if the current position exceeds it
-                        if (tab_position < current_length) {
-                            // Truncate the string at the position specified by Tn
-                            result[tab_position] = '\0';
-                        }
+                        truncate_string_builder(&result, tab_position);
                     }
                 }
             } else {
@@ -1580,11 +2208,11 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                             type = "CHARACTER";
                             break;
                     }
-                    free(result);
-                    result = (char*)malloc(150 * sizeof(char));
-                    sprintf(result, " Runtime Error : Got argument of type (%s), while the format specifier is (%c)\n", type, value[0]);
+                    truncate_string_builder(&result, 0);
+                    reserve_string_builder(&result, 150);
+                    result.len = sprintf(result.str, " Runtime Error : Got argument of type (%s), while the format specifier is (%c)\n", type, value[0]);
                     // Special indication for error --> "\b" to be handled by `lfortran_print` or `lfortran_file_write`
-                    result[0] = '\b';
+                    result.str[0] = '\b';
                     BreakWhileLoop = true;
                     break;
                 }
@@ -1632,19 +2260,17 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                     char* arg = *(char**)s_info.current_arg_info.current_arg;
                     if (arg == NULL) continue;
                     if (strlen(value) == 1) {
-                        result = append_to_string(result, arg);
+                        append_to_builder(&result, arg);
                     } else {
-                        char* str = (char*)malloc((strlen(value)) * sizeof(char));
-                        memmove(str, value+1, strlen(value));
-                        int buffer_size = 20;
-                        char* s = (char*)malloc(buffer_size * sizeof(char));
-                        snprintf(s, buffer_size, "%%%s.%ss", str, str);
-                        char* string = (char*)malloc((atoi(str) + 1) * sizeof(char));
-                        sprintf(string,s, arg);
-                        result = append_to_string(result, string);
-                        free(str);
-                        free(s);
-                        free(string);
+                        // Aw: the first w characters, right justified
+                        int width = atoi(value + 1);
+                        int arg_len = strlen(arg);
+                        if (arg_len >= width) {
+                            append_to_builder_n(&result, arg, width);
+                        } else {
+                            append_repeated_to_builder(&result, ' ', width - arg_len);
+                            append_to_builder_n(&result, arg, arg_len);
+                        }
                     }
                 } else if (tolower(value[0]) == 'i') {
                     // Integer Editing ( I[w[.m]] )
@@ -1687,7 +2313,7 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                             bit_size = 64;
                         }
                     } else {
-                        result = append_to_string(result, "<unsupported>");
+                        append_to_builder(&result, "<unsupported>");
                         break;
                     }
 
@@ -1712,10 +2338,10 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                     int bin_len = strlen(binary_str);
 
                     if (width == 0) {
-                        result = append_to_string(result, binary_str);
+                        append_to_builder(&result, binary_str);
                     } else if (bin_len > width) {
                         for (int i = 0; i < width; i++) {
-                            result = append_to_string(result, "*");
+                            append_to_builder(&result, "*");
                         }
                     } else {
                         int bin_len = strlen(binary_str);
@@ -1739,10 +2365,10 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                             char* pad = (char*)malloc((padding_needed + 1) * sizeof(char));
                             memset(pad, ' ', padding_needed);
                             pad[padding_needed] = '\0';
-                            result = append_to_string(result, pad);
+                            append_to_builder(&result, pad);
                             free(pad);
                         }
-                        result = append_to_string(result, binary_str);
+                        append_to_builder(&result, binary_str);
                     }
                 } else if (tolower(value[0]) == 'g') {
                     int width = 0;
@@ -1770,7 +2396,7 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                             double scale = pow(10.0, -exp);
                             double final_val = double_val * scale;
                             char mantissa[64], exponent[16];
-                            snprintf(mantissa, sizeof(mantissa), "%.*f", precision, final_val);
+                            format_fixed(mantissa, sizeof(mantissa), precision, final_val);
                             if (width > 0) {
                                 snprintf(exponent, sizeof(exponent), "E%+03d", exp); 
                             } else {
@@ -1785,18 +2411,19 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
                         } else {
                             strcpy(buffer, formatted);
                         }
-                        result = append_to_string(result, buffer);
+                        append_to_builder(&result, buffer);
                     } else if (s_info.current_element_type == INTEGER_8_TYPE ||
                                s_info.current_element_type == INTEGER_16_TYPE ||
                                s_info.current_element_type == INTEGER_32_TYPE ||
                                s_info.current_element_type == INTEGER_64_TYPE) {
-                        snprintf(result, sizeof(buffer), "%"PRId64, integer_val);
+                        snprintf(buffer, sizeof(buffer), "%"PRId64, integer_val);
+                        append_to_builder(&result, buffer);
                     } else if (s_info.current_element_type == CHARACTER_TYPE) {
-                        result = append_to_string(result, char_val);
+                        append_to_builder(&result, char_val);
                     } else if (s_info.current_element_type == LOGICAL_TYPE) {
-                        result = append_to_string(result, bool_val ? "T" : "F");
+                        append_to_builder(&result, bool_val ? "T" : "F");
                     } else {
-                        result = append_to_string(result, "<unsupported>");
+                        append_to_builder(&result, "<unsupported>");
                     }
                 } else if (tolower(value[0]) == 'd') {
                     // D Editing (D[w[.d]])
@@ -1824,20 +2451,45 @@ LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const c
         if(BreakWhileLoop) break;
         if (move_to_next_element(&s_info, true)) {
             if (!array) {
-                result = append_to_string(result, "\n");
+                append_to_builder(&result, "\n");
             }
             item_start = item_start_idx;
         } else {
             break;
         }
     }
-    free(modified_input_string);
-    for (int i = 0;(i<format_values_count);i++) {
-            free(format_values[i]);
+    if (cache == NULL) {
+        free_format(fmt);
     }
-    va_end(args);
-    free(format_values);
     free_serialization_info(&s_info);
+    return result.str;
+}
+
+LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format, const char* serialization_string, 
+    int32_t array_sizes_cnt, int32_t string_lengths_cnt, ...)
+{
+    va_list args;
+    va_start(args, string_lengths_cnt);
+    char* result = string_format_fortran(format, NULL, serialization_string,
+        array_sizes_cnt, string_lengths_cnt, &args);
+    va_end(args);
+    return result;
+}
+
+/*
+    `_lcompilers_string_format_fortran` for a constant `format`: the compiler
+    passes a pointer to a null initialized slot of its own for the format,
+    in which the parsed format is kept for the following calls.
+*/
+LFORTRAN_API char* _lcompilers_string_format_fortran_cached(void** cache,
+    const char* format, const char* serialization_string,
+    int32_t array_sizes_cnt, int32_t string_lengths_cnt, ...)
+{
+    va_list args;
+    va_start(args, string_lengths_cnt);
+    char* result = string_format_fortran(format, (Fortran_Format**)cache,
+        serialization_string, array_sizes_cnt, string_lengths_cnt, &args);
+    va_end(args);
     return result;
 }
 
@@ -2606,30 +3258,102 @@ LFORTRAN_API double _lfortran_zphase(double_complex_t x)
     return atan2(cimag(x), creal(x));
 }
 
+/*
+ * Character kernels
+ *
+ * The string intrinsics below spend their time finding where two strings
+ * first differ and where the trailing blanks of a string start. Both are done
+ * 16 bytes at a time with SSE2, or 32 bytes at a time with AVX2 when the
+ * runtime is compiled for it, and byte by byte on other targets. Copies and
+ * blank padding use memcpy and memset, which the C library already vectorizes.
+ */
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#endif
+static inline int trailing_zeros32(uint32_t x) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return (int)i;
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+static inline int leading_zeros32(uint32_t x) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanReverse(&i, x);
+    return 31 - (int)i;
+#else
+    return __builtin_clz(x);
+#endif
+}
+
+// Index of the first byte where `a` and `b` differ, or `n` if they do not
+static int64_t find_mismatch(const char *a, const char *b, int64_t n) {
+    int64_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+        uint32_t equal = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+        if (equal != 0xFFFFFFFFu) return i + trailing_zeros32(~equal);
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+        uint32_t equal = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb));
+        if (equal != 0xFFFFu) return i + trailing_zeros32(~equal & 0xFFFFu);
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] != b[i]) return i;
+    }
+    return n;
+}
+
+// Length of `s` without its trailing blanks
+static int64_t len_trim_blanks(const char *s, int64_t n) {
+#if defined(__AVX2__)
+    const __m256i blanks32 = _mm256_set1_epi8(' ');
+    for (; n >= 32; n -= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(s + n - 32));
+        uint32_t blank = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, blanks32));
+        if (blank != 0xFFFFFFFFu) return n - leading_zeros32(~blank);
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    const __m128i blanks16 = _mm_set1_epi8(' ');
+    for (; n >= 16; n -= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + n - 16));
+        uint32_t blank = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, blanks16));
+        if (blank != 0xFFFFu) return n - (leading_zeros32(~blank & 0xFFFFu) - 16);
+    }
+#endif
+    while (n > 0 && s[n - 1] == ' ') n--;
+    return n;
+}
+
 // strcat  --------------------------------------------------------------------
 
 LFORTRAN_API void _lfortran_strcat(char** s1, char** s2, char** dest)
 {
-    int cntr = 0;
-    char trmn = '\0';
-    int s1_len = strlen(*s1);
-    int s2_len = strlen(*s2);
-    int trmn_size = sizeof(trmn);
-    char* dest_char = (char*)malloc(s1_len+s2_len+trmn_size);
-    for (int i = 0; i < s1_len; i++) {
-        dest_char[cntr] = (*s1)[i];
-        cntr++;
-    }
-    for (int i = 0; i < s2_len; i++) {
-        dest_char[cntr] = (*s2)[i];
-        cntr++;
-    }
-    dest_char[cntr] = trmn;
-    *dest = &(dest_char[0]);
+    size_t s1_len = strlen(*s1);
+    size_t s2_len = strlen(*s2);
+    char* dest_char = (char*)malloc(s1_len + s2_len + 1);
+    memcpy(dest_char, *s1, s1_len);
+    memcpy(dest_char + s1_len, *s2, s2_len + 1);
+    *dest = dest_char;
 }
 // Allocate_allocatable-strings + Extend String ----------------------------------------------------------- 
 
-void extend_string(char** ptr, int32_t new_size /*Null-Character Counted*/, int64_t* string_capacity){
+void extend_string(char** ptr, int64_t new_size /*Null-Character Counted*/, int64_t* string_capacity){
     ASSERT_MSG(string_capacity != NULL, "%s", "string capacity is NULL");
     int64_t new_capacity;
     if((*string_capacity)*2 < new_size){
@@ -2638,7 +3362,8 @@ void extend_string(char** ptr, int32_t new_size /*Null-Character Counted*/, int6
         new_capacity = (*string_capacity)*2;
     }
 
-    *ptr = realloc(*ptr, new_capacity);
+    // The buffer may come from _lfortran_malloc64
+    *ptr = (char*)_lfortran_realloc64((int8_t*)*ptr, new_capacity);
     ASSERT_MSG(*ptr != NULL, "%s", "pointer reallocation failed!");
 
     *string_capacity = new_capacity;
@@ -2695,14 +3420,55 @@ LFORTRAN_API void _lfortran_strcpy_descriptor_string(char** x, char *y, int64_t*
             extend_string(x, y_len+1, x_string_capacity);
         }
     }
-    int64_t null_character_index = x_len;
-    (*x)[null_character_index] = '\0'; 
-    for (size_t i = 0; i < x_len; i++) {
-        (*x)[i] = y[i];
-    }
+    // `y` may be a part of `x`
+    memmove(*x, y, x_len);
+    (*x)[x_len] = '\0';
     *x_string_size = y_len;
 }
 
+// Appends `n` strings to the allocatable string `x` in place, as in
+// `x = x // a // b`. The pieces are all evaluated before the call, so any of
+// them may point into `x`; they are copied after `x` has grown.
+LFORTRAN_API void _lfortran_str_append_descriptor_string(char** x, int64_t* x_string_size,
+    int64_t* x_string_capacity, int32_t n, char** pieces)
+{
+    ASSERT_MSG(x_string_size != NULL,"%s", "string size is NULL");
+    ASSERT_MSG(x_string_capacity != NULL, "%s", "string capacity is NULL");
+    if (*x == NULL) {
+        fprintf(stderr,
+        "Runtime Error : LHS allocatable-character variable must be allocated before concatenation.\n");
+        exit(1);
+    }
+    int64_t inline_offsets[8], inline_lengths[8];
+    int64_t *offsets = n <= 8 ? inline_offsets : (int64_t*)malloc(n * sizeof(int64_t));
+    int64_t *lengths = n <= 8 ? inline_lengths : (int64_t*)malloc(n * sizeof(int64_t));
+    int64_t new_size = *x_string_size;
+    for (int32_t i = 0; i < n; i++) {
+        if (pieces[i] == NULL) {
+            fprintf(stderr,
+            "Runtime Error : RHS allocatable-character variable must be allocated before assignment.\n");
+            exit(1);
+        }
+        lengths[i] = strlen(pieces[i]);
+        bool inside_x = pieces[i] >= *x && pieces[i] < *x + *x_string_capacity;
+        offsets[i] = inside_x ? pieces[i] - *x : -1;
+        new_size += lengths[i];
+    }
+    if (*x_string_capacity < new_size + 1) {
+        extend_string(x, new_size + 1, x_string_capacity);
+    }
+    int64_t size = *x_string_size;
+    for (int32_t i = 0; i < n; i++) {
+        const char *piece = offsets[i] >= 0 ? *x + offsets[i] : pieces[i];
+        memmove(*x + size, piece, lengths[i]);
+        size += lengths[i];
+    }
+    (*x)[size] = '\0';
+    *x_string_size = size;
+    if (offsets != inline_offsets) free(offsets);
+    if (lengths != inline_lengths) free(lengths);
+}
+
 LFORTRAN_API void _lfortran_strcpy_pointer_string(char** x, char *y)
 {
     if(y == NULL){
@@ -2719,38 +3485,29 @@ LFORTRAN_API void _lfortran_strcpy_pointer_string(char** x, char *y)
         *x = (char*) malloc((y_len + 1) * sizeof(char));
         _lfortran_string_init(y_len + 1, *x);
     }
-    for (size_t i = 0; i < strlen(*x); i++) {
-        if (i < y_len) {
-            x[0][i] = y[i];
-        } else {
-            x[0][i] = ' ';
-        }
+    size_t x_len = strlen(*x);
+    if (y_len < x_len) {
+        memmove(*x, y, y_len);
+        memset(*x + y_len, ' ', x_len - y_len);
+    } else {
+        memmove(*x, y, x_len);
     }
 }
 
 #define MIN(x, y) ((x < y) ? x : y)
 
 int strlen_without_trailing_space(char *str) {
-    int end = strlen(str) - 1;
-    while(end >= 0 && str[end] == ' ') end--;
-    return end + 1;
+    return len_trim_blanks(str, strlen(str));
 }
 
 int str_compare(char **s1, char **s2)
 {
-    int s1_len = strlen_without_trailing_space(*s1);
-    int s2_len = strlen_without_trailing_space(*s2);
-    int lim = MIN(s1_len, s2_len);
-    int res = 0;
-    int i ;
-    for (i = 0; i < lim; i++) {
-        if ((*s1)[i] != (*s2)[i]) {
-            res = (*s1)[i] - (*s2)[i];
-            break;
-        }
-    }
-    res = (i == lim)? s1_len - s2_len : res;
-    return res;
+    int64_t s1_len = len_trim_blanks(*s1, strlen(*s1));
+    int64_t s2_len = len_trim_blanks(*s2, strlen(*s2));
+    int64_t lim = MIN(s1_len, s2_len);
+    int64_t i = find_mismatch(*s1, *s2, lim);
+    if (i < lim) return (*s1)[i] - (*s2)[i];
+    return s1_len == s2_len ? 0 : (s1_len < s2_len ? -1 : 1);
 }
 LFORTRAN_API bool _lpython_str_compare_eq(char **s1, char **s2)
 {
@@ -2785,14 +3542,14 @@ LFORTRAN_API bool _lpython_str_compare_gte(char **s1, char **s2)
 LFORTRAN_API char* _lfortran_float_to_str4(float num)
 {
     char* res = (char*)malloc(40);
-    sprintf(res, "%f", num);
+    format_fixed(res, 40, 6, num);
     return res;
 }
 
 LFORTRAN_API char* _lfortran_float_to_str8(double num)
 {
     char* res = (char*)malloc(40);
-    sprintf(res, "%f", num);
+    format_fixed(res, 40, 6, num);
     return res;
 }
 
@@ -2872,41 +3629,22 @@ LFORTRAN_API int32_t _lpython_bit_length8(int64_t num)
 //repeat str for n time
 LFORTRAN_API void _lfortran_strrepeat(char** s, int32_t n, char** dest)
 {
-    int cntr = 0;
-    char trmn = '\0';
-    int s_len = strlen(*s);
-    int trmn_size = sizeof(trmn);
-    int f_len = s_len*n;
-    if (f_len < 0)
-        f_len = 0;
-    char* dest_char = (char*)malloc(f_len+trmn_size);
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < s_len; j++) {
-            dest_char[cntr] = (*s)[j];
-            cntr++;
-        }
-    }
-    dest_char[cntr] = trmn;
-    *dest = &(dest_char[0]);
+    *dest = _lfortran_strrepeat_c(*s, n);
 }
 
 LFORTRAN_API char* _lfortran_strrepeat_c(char* s, int32_t n)
 {
-    int cntr = 0;
-    char trmn = '\0';
-    int s_len = strlen(s);
-    int trmn_size = sizeof(trmn);
-    int f_len = s_len*n;
-    if (f_len < 0)
-        f_len = 0;
-    char* dest_char = (char*)malloc(f_len+trmn_size);
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < s_len; j++) {
-            dest_char[cntr] = s[j];
-            cntr++;
+    int64_t s_len = strlen(s);
+    int64_t f_len = n > 0 ? s_len * n : 0;
+    char* dest_char = (char*)malloc(f_len + 1);
+    if (f_len > 0) {
+        // Copy once, then keep doubling the part already written
+        memcpy(dest_char, s, s_len);
+        for (int64_t done = s_len; done < f_len; done *= 2) {
+            memcpy(dest_char + done, dest_char, MIN(done, f_len - done));
         }
     }
-    dest_char[cntr] = trmn;
+    dest_char[f_len] = '\0';
     return dest_char;
 }
 
@@ -2941,12 +3679,10 @@ LFORTRAN_API char* _lfortran_str_copy(char* s, int32_t idx1, int32_t idx2) {
     if(idx2 <= 0) {
         idx2 = s_len + idx2;
     }
-    char* dest_char = (char*)malloc(idx2-idx1+2);
-    for (int i=idx1; i <= idx2; i++)
-    {
-        dest_char[i-idx1] = s[i-1];
-    }
-    dest_char[idx2-idx1+1] = '\0';
+    int64_t dest_len = idx2 >= idx1 ? (int64_t)idx2 - idx1 + 1 : 0;
+    char* dest_char = (char*)malloc(dest_len + 1);
+    memcpy(dest_char, s + idx1 - 1, dest_len);
+    dest_char[dest_len] = '\0';
     return dest_char;
 }
 
@@ -2987,6 +3723,11 @@ LFORTRAN_API char* _lfortran_str_slice(char* s, int32_t idx1, int32_t idx2, int3
     }
 
     char* dest_char = (char*)malloc(dest_len);
+    if (step == 1) {
+        memcpy(dest_char, s + idx1, idx2 - idx1);
+        dest_char[idx2 - idx1] = '\0';
+        return dest_char;
+    }
     int s_i = idx1, d_i = 0;
     while((step > 0 && s_i >= idx1 && s_i < idx2) ||
         (step < 0 && s_i <= idx1 && s_i > idx2)) {
@@ -3073,22 +3814,296 @@ LFORTRAN_API void _lfortran_memset(void* s, int32_t c, int32_t size) {
     memset(s, c, size);
 }
 
-LFORTRAN_API void* _lfortran_malloc(int32_t size) {
-    return malloc(size);
+/*
+ * Heap allocation
+ *
+ * Generated code allocates array data, array temporaries and string buffers
+ * through the _lfortran_*64 entry points below. By default they are thin
+ * wrappers around the C allocator.
+ *
+ * With LFORTRAN_ALLOC_POOL=1, requests of up to ALLOC_POOL_MAX_SIZE bytes are
+ * served from power-of-two size classes instead. Each thread keeps a free list
+ * per class, so a temporary that is allocated and freed in a loop is recycled
+ * without going through malloc. The blocks are carved out of ALLOC_SLAB_SIZE
+ * slabs in a single reserved address range, and the slab of a block records
+ * its class. A pointer is a pool block if and only if it lies in that range,
+ * so _lfortran_free and _lfortran_realloc keep accepting buffers that the
+ * runtime obtained from malloc. Pool blocks must not be passed to free() or
+ * realloc() directly, which is why the pool is opt-in. Freed blocks go on the
+ * list of the thread that frees them, and slabs are never returned to the
+ * system.
+ *
+ * With LFORTRAN_ALLOC_STATS=1, the number of calls to each entry point and the
+ * peak number of live bytes are printed to stderr at exit. Live bytes are
+ * counted with the usable size of each block, where the C library provides
+ * it. Buffers the runtime allocated itself and that are freed through
+ * _lfortran_free are subtracted too, so the peak is a lower bound.
+ */
+
+#if defined(__GNUC__) && !defined(_WIN32) && UINTPTR_MAX > 0xffffffffu
+#  define ALLOC_POOL_SUPPORTED
+#  include <sys/mman.h>
+#  ifndef MAP_NORESERVE
+#    define MAP_NORESERVE 0
+#  endif
+#endif
+#if defined(__GLIBC__)
+#  include <malloc.h>
+#  define alloc_usable_size(p) malloc_usable_size(p)
+#elif defined(__APPLE__)
+#  include <malloc/malloc.h>
+#  define alloc_usable_size(p) malloc_size(p)
+#elif defined(_WIN32)
+#  include <malloc.h>
+#  define alloc_usable_size(p) _msize(p)
+#else
+#  define alloc_usable_size(p) ((size_t)0)
+#endif
+
+#if defined(__GNUC__)
+#  define alloc_counter_add(p, v) __atomic_add_fetch(p, v, __ATOMIC_RELAXED)
+#else
+#  define alloc_counter_add(p, v) (*(p) += (v))
+#endif
+
+#define ALLOC_POOL_MIN_SHIFT 4
+#define ALLOC_POOL_MAX_SHIFT 18
+#define ALLOC_POOL_CLASSES (ALLOC_POOL_MAX_SHIFT - ALLOC_POOL_MIN_SHIFT + 1)
+#define ALLOC_POOL_MAX_SIZE ((size_t)1 << ALLOC_POOL_MAX_SHIFT)
+#define ALLOC_SLAB_SHIFT 20
+#define ALLOC_SLAB_SIZE ((size_t)1 << ALLOC_SLAB_SHIFT)
+// Address space reserved for the pool; pages are only committed when touched
+#define ALLOC_POOL_REGION_SIZE ((size_t)16 << 30)
+#define ALLOC_POOL_SLABS (ALLOC_POOL_REGION_SIZE >> ALLOC_SLAB_SHIFT)
+
+static bool alloc_initialized = false;
+static bool alloc_stats_enabled = false;
+
+static struct {
+    int64_t malloc_calls, calloc_calls, realloc_calls, free_calls;
+    int64_t pool_hits, live_bytes, peak_bytes;
+} alloc_stats;
+
+#ifdef ALLOC_POOL_SUPPORTED
+static char *alloc_pool_base = NULL;
+static int64_t alloc_pool_next_slab = 0;
+static uint8_t alloc_pool_slab_class[ALLOC_POOL_SLABS];
+
+struct alloc_pool_cache {
+    void *free_list[ALLOC_POOL_CLASSES];
+    char *next[ALLOC_POOL_CLASSES];
+    char *end[ALLOC_POOL_CLASSES];
+};
+static __thread struct alloc_pool_cache alloc_pool_cache;
+
+static inline bool in_alloc_pool(const void *p) {
+    return alloc_pool_base != NULL && (const char*)p >= alloc_pool_base
+        && (const char*)p < alloc_pool_base + ALLOC_POOL_REGION_SIZE;
 }
 
-LFORTRAN_API int8_t* _lfortran_realloc(int8_t* ptr, int32_t size) {
-    return (int8_t*) realloc(ptr, size);
+static inline int alloc_pool_block_class(const void *p) {
+    return alloc_pool_slab_class[
+        ((const char*)p - alloc_pool_base) >> ALLOC_SLAB_SHIFT];
 }
 
-LFORTRAN_API int8_t* _lfortran_calloc(int32_t count, int32_t size) {
-    return (int8_t*) calloc(count, size);
+// Index of the smallest class holding `size` bytes, size <= ALLOC_POOL_MAX_SIZE
+static inline int alloc_pool_class(size_t size) {
+    if (size <= ((size_t)1 << ALLOC_POOL_MIN_SHIFT)) return 0;
+    return (64 - __builtin_clzll((unsigned long long)(size - 1)))
+        - ALLOC_POOL_MIN_SHIFT;
+}
+
+// Returns NULL once the reserved range is used up; the caller then uses malloc
+static void* alloc_pool_get(int c) {
+    struct alloc_pool_cache *cache = &alloc_pool_cache;
+    void *p = cache->free_list[c];
+    if (p != NULL) {
+        cache->free_list[c] = *(void**)p;
+        return p;
+    }
+    size_t block_size = (size_t)1 << (c + ALLOC_POOL_MIN_SHIFT);
+    if (cache->next[c] == cache->end[c]) {
+        int64_t slab = __atomic_fetch_add(&alloc_pool_next_slab, 1,
+            __ATOMIC_RELAXED);
+        if (slab >= (int64_t)ALLOC_POOL_SLABS) return NULL;
+        alloc_pool_slab_class[slab] = (uint8_t)c;
+        cache->next[c] = alloc_pool_base + ((size_t)slab << ALLOC_SLAB_SHIFT);
+        cache->end[c] = cache->next[c] + ALLOC_SLAB_SIZE;
+    }
+    p = cache->next[c];
+    cache->next[c] += block_size;
+    return p;
+}
+
+static inline void alloc_pool_put(void *p) {
+    int c = alloc_pool_block_class(p);
+    *(void**)p = alloc_pool_cache.free_list[c];
+    alloc_pool_cache.free_list[c] = p;
+}
+#endif
+
+static size_t alloc_block_size(void *p) {
+#ifdef ALLOC_POOL_SUPPORTED
+    if (in_alloc_pool(p)) {
+        return (size_t)1 << (alloc_pool_block_class(p) + ALLOC_POOL_MIN_SHIFT);
+    }
+#endif
+    return alloc_usable_size(p);
+}
+
+static void alloc_stats_update(void *allocated, void *released) {
+    int64_t delta = 0;
+    if (allocated != NULL) delta += (int64_t)alloc_block_size(allocated);
+    if (released != NULL) delta -= (int64_t)alloc_block_size(released);
+    int64_t live = alloc_counter_add(&alloc_stats.live_bytes, delta);
+#if defined(__GNUC__)
+    int64_t peak = __atomic_load_n(&alloc_stats.peak_bytes, __ATOMIC_RELAXED);
+    while (live > peak && !__atomic_compare_exchange_n(&alloc_stats.peak_bytes,
+            &peak, live, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else
+    if (live > alloc_stats.peak_bytes) alloc_stats.peak_bytes = live;
+#endif
+}
+
+static void print_alloc_stats(void) {
+    fprintf(stderr, "LFORTRAN_ALLOC_STATS: malloc %" PRId64 ", calloc %" PRId64
+        ", realloc %" PRId64 ", free %" PRId64 "\n", alloc_stats.malloc_calls,
+        alloc_stats.calloc_calls, alloc_stats.realloc_calls,
+        alloc_stats.free_calls);
+#ifdef ALLOC_POOL_SUPPORTED
+    if (alloc_pool_base != NULL) {
+        int64_t slabs = alloc_pool_next_slab < (int64_t)ALLOC_POOL_SLABS
+            ? alloc_pool_next_slab : (int64_t)ALLOC_POOL_SLABS;
+        fprintf(stderr, "LFORTRAN_ALLOC_STATS: pool hits %" PRId64
+            ", pool slabs %" PRId64 " MiB\n", alloc_stats.pool_hits,
+            slabs * (int64_t)(ALLOC_SLAB_SIZE >> 20));
+    }
+#endif
+    fprintf(stderr, "LFORTRAN_ALLOC_STATS: peak %" PRId64 " bytes\n",
+        alloc_stats.peak_bytes);
+}
+
+static bool env_flag(const char *name) {
+    const char *value = getenv(name);
+    return value != NULL && value[0] != '\0' && strcmp(value, "0") != 0;
+}
+
+static void alloc_init(void) {
+    alloc_initialized = true;
+    alloc_stats_enabled = env_flag("LFORTRAN_ALLOC_STATS");
+    if (alloc_stats_enabled) atexit(print_alloc_stats);
+#ifdef ALLOC_POOL_SUPPORTED
+    if (env_flag("LFORTRAN_ALLOC_POOL")) {
+        // Over-reserve by a slab so that the slabs can be aligned to their size
+        char *region = (char*)mmap(NULL, ALLOC_POOL_REGION_SIZE + ALLOC_SLAB_SIZE,
+            PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+            -1, 0);
+        if (region != MAP_FAILED) {
+            alloc_pool_base = (char*)(((uintptr_t)region + ALLOC_SLAB_SIZE - 1)
+                & ~(uintptr_t)(ALLOC_SLAB_SIZE - 1));
+        }
+    }
+#endif
+}
+
+#if defined(__GNUC__)
+// Programs may allocate from several threads at once; the settings are read
+// before main() so that the lazy initialization below never races
+__attribute__((constructor)) static void alloc_init_at_startup(void) {
+    if (!alloc_initialized) alloc_init();
+}
+#endif
+
+// Allocates from the pool when it is enabled and has room, else from the C
+// allocator
+static void* alloc_block(int64_t count, int64_t size, bool zero) {
+#ifdef ALLOC_POOL_SUPPORTED
+    if (alloc_pool_base != NULL && count >= 0 && size >= 0
+            && (size == 0 || (uint64_t)count <= ALLOC_POOL_MAX_SIZE / size)) {
+        size_t bytes = (size_t)count * (size_t)size;
+        void *p = alloc_pool_get(alloc_pool_class(bytes));
+        if (p != NULL) {
+            if (zero) memset(p, 0, bytes);
+            if (alloc_stats_enabled) {
+                alloc_counter_add(&alloc_stats.pool_hits, 1);
+                alloc_stats_update(p, NULL);
+            }
+            return p;
+        }
+    }
+#endif
+    void *p = zero ? calloc((size_t)count, (size_t)size)
+        : malloc((size_t)count * (size_t)size);
+    if (p != NULL && alloc_stats_enabled) alloc_stats_update(p, NULL);
+    return p;
+}
+
+LFORTRAN_API void* _lfortran_malloc64(int64_t size) {
+    if (!alloc_initialized) alloc_init();
+    if (alloc_stats_enabled) alloc_counter_add(&alloc_stats.malloc_calls, 1);
+    return alloc_block(1, size, false);
+}
+
+LFORTRAN_API int8_t* _lfortran_calloc64(int64_t count, int64_t size) {
+    if (!alloc_initialized) alloc_init();
+    if (alloc_stats_enabled) alloc_counter_add(&alloc_stats.calloc_calls, 1);
+    return (int8_t*)alloc_block(count, size, true);
+}
+
+LFORTRAN_API int8_t* _lfortran_realloc64(int8_t* ptr, int64_t size) {
+    if (!alloc_initialized) alloc_init();
+    if (alloc_stats_enabled) alloc_counter_add(&alloc_stats.realloc_calls, 1);
+    if (ptr == NULL) return (int8_t*)alloc_block(1, size, false);
+#ifdef ALLOC_POOL_SUPPORTED
+    if (in_alloc_pool(ptr)) {
+        size_t block_size = (size_t)1 << (alloc_pool_block_class(ptr)
+            + ALLOC_POOL_MIN_SHIFT);
+        if ((uint64_t)size <= block_size) return ptr;
+        void *p = alloc_block(1, size, false);
+        if (p == NULL) return NULL;
+        memcpy(p, ptr, block_size);
+        if (alloc_stats_enabled) alloc_stats_update(NULL, ptr);
+        alloc_pool_put(ptr);
+        return (int8_t*)p;
+    }
+#endif
+    int64_t old_size = alloc_stats_enabled ? (int64_t)alloc_block_size(ptr) : 0;
+    void *p = realloc(ptr, (size_t)size);
+    if (p != NULL && alloc_stats_enabled) {
+        alloc_counter_add(&alloc_stats.live_bytes, -old_size);
+        alloc_stats_update(p, NULL);
+    }
+    return (int8_t*)p;
 }
 
 LFORTRAN_API void _lfortran_free(char* ptr) {
+    if (ptr == NULL) return;
+    if (alloc_stats_enabled) {
+        alloc_counter_add(&alloc_stats.free_calls, 1);
+        alloc_stats_update(NULL, ptr);
+    }
+#ifdef ALLOC_POOL_SUPPORTED
+    if (in_alloc_pool(ptr)) {
+        alloc_pool_put(ptr);
+        return;
+    }
+#endif
     free((void*)ptr);
 }
 
+// 32-bit entry points, kept for code compiled by earlier versions
+LFORTRAN_API void* _lfortran_malloc(int32_t size) {
+    return _lfortran_malloc64(size);
+}
+
+LFORTRAN_API int8_t* _lfortran_realloc(int8_t* ptr, int32_t size) {
+    return _lfortran_realloc64(ptr, size);
+}
+
+LFORTRAN_API int8_t* _lfortran_calloc(int32_t count, int32_t size) {
+    return _lfortran_calloc64(count, size);
+}
+
 
 // size_plus_one is the size of the string including the null character
 LFORTRAN_API void _lfortran_string_init(int64_t size_plus_one, char *s) {
@@ -3281,7 +4296,8 @@ LFORTRAN_API char* _lfortran_zone() {
 #elif defined(__APPLE__) && !defined(__aarch64__)
     // For non-ARM-based Apple platforms
     time_t t = time(NULL);
-    struct tm* ptm = localtime(&t);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&t, &tm_buf);
 
     // The tm_gmtoff field holds the time zone offset in seconds
     long offset_seconds = ptm->tm_gmtoff;
@@ -3290,7 +4306,8 @@ LFORTRAN_API char* _lfortran_zone() {
 #else
     // For Linux and other platforms
     time_t t = time(NULL);
-    struct tm* ptm = localtime(&t);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&t, &tm_buf);
 
     // The tm_gmtoff field holds the time zone offset in seconds
     long offset_seconds = ptm->tm_gmtoff;
@@ -3318,14 +4335,16 @@ LFORTRAN_API char* _lfortran_time() {
     // For non-ARM-based Apple platforms, use current time functions
     struct timeval tv;
     gettimeofday(&tv, NULL);
-    struct tm* ptm = localtime(&tv.tv_sec);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&tv.tv_sec, &tm_buf);
     int milliseconds = tv.tv_usec / 1000;
     sprintf(result, "%02d%02d%02d.%03d", ptm->tm_hour, ptm->tm_min, ptm->tm_sec, milliseconds);
 #else
     // For Linux and other platforms
     struct timespec ts;
     clock_gettime(CLOCK_REALTIME, &ts);
-    struct tm* ptm = localtime(&ts.tv_sec);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&ts.tv_sec, &tm_buf);
     int milliseconds = ts.tv_nsec / 1000000;
     sprintf(result, "%02d%02d%02d.%03d", ptm->tm_hour, ptm->tm_min, ptm->tm_sec, milliseconds);
 #endif
@@ -3347,12 +4366,14 @@ LFORTRAN_API char* _lfortran_date() {
 #elif defined(__APPLE__) && !defined(__aarch64__)
     // For non-ARM-based Apple platforms
     time_t t = time(NULL);
-    struct tm* ptm = localtime(&t);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&t, &tm_buf);
     sprintf(result, "%04d%02d%02d", ptm->tm_year + 1900, ptm->tm_mon + 1, ptm->tm_mday);
 #else
     // For Linux and other platforms
     time_t t = time(NULL);
-    struct tm* ptm = localtime(&t);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&t, &tm_buf);
     snprintf(result, 32, "%04d%02d%02d", ptm->tm_year + 1900, ptm->tm_mon + 1, ptm->tm_mday);
 #endif
 
@@ -3376,7 +4397,8 @@ LFORTRAN_API int32_t _lfortran_values(int32_t n)
     // For non-ARM-based Apple platforms
     struct timeval tv;
     gettimeofday(&tv, NULL);
-    struct tm* ptm = localtime(&tv.tv_sec);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&tv.tv_sec, &tm_buf);
     int milliseconds = tv.tv_usec / 1000;
     if (n == 1) result = ptm->tm_year + 1900;
     else if (n == 2) result = ptm->tm_mon + 1;
@@ -3389,7 +4411,8 @@ LFORTRAN_API int32_t _lfortran_values(int32_t n)
 #else
     // For Linux and other platforms
     time_t t = time(NULL);
-    struct tm* ptm = localtime(&t);
+    struct tm tm_buf;
+    struct tm* ptm = localtime_r(&t, &tm_buf);
     struct timespec ts;
     clock_gettime(CLOCK_REALTIME, &ts);
     if (n == 1) result = ptm->tm_year + 1900;
@@ -3405,137 +4428,1621 @@ LFORTRAN_API int32_t _lfortran_values(int32_t n)
 }
 
 LFORTRAN_API float _lfortran_sp_rand_num() {
-    return rand() / (float) RAND_MAX;
+    return rng_to_float(rng_next());
 }
 
 LFORTRAN_API double _lfortran_dp_rand_num() {
-    return rand() / (double) RAND_MAX;
+    return rng_to_double(rng_next());
 }
 
 LFORTRAN_API int32_t _lfortran_int32_rand_num() {
-    return rand();
+    return (int32_t)(rng_next() >> 33);
 }
 
 LFORTRAN_API int64_t _lfortran_int64_rand_num() {
-    return rand();
+    return (int64_t)(rng_next() >> 1);
 }
 
 LFORTRAN_API bool _lfortran_random_init(bool repeatable, bool image_distinct) {
+    // There is a single image, so `image_distinct` has no effect
     if (repeatable) {
-            srand(0);
+        rng_set_seed(NULL, 0);
+    } else {
+        _lfortran_init_random_clock();
+    }
+    return false;
+}
+
+LFORTRAN_API int64_t _lfortran_random_seed(unsigned seed)
+{
+    (void)seed;
+    // The seed holds the 256 bits of xoshiro256++ state as 32-bit integers
+    return RNG_SEED_SIZE;
+}
+
+LFORTRAN_API int32_t _lfortran_random_seed_put(int32_t i, int64_t value)
+{
+    if (i < 0 || i >= RNG_SEED_SIZE) return 0;
+    uint32_t words[RNG_SEED_SIZE];
+    rng_lock_seed();
+    memcpy(words, rng_seed, sizeof(words));
+    words[i] = (uint32_t)value;
+    rng_set_seed_locked(words);
+    rng_unlock_seed();
+    return 0;
+}
+
+LFORTRAN_API int32_t _lfortran_random_seed_get(int32_t i)
+{
+    if (i < 0 || i >= RNG_SEED_SIZE) return 0;
+    struct rng_state *g = rng_get();
+    // Drops the values left from the current block, so that the state of
+    // lane 0 alone determines what follows
+    g->next = RNG_LANES;
+    uint64_t word = g->s[i / 2][0] ^ rng_seed_mask[i / 2];
+    return (int32_t)(uint32_t)(i % 2 == 0 ? word >> 32 : word);
+}
+
+LFORTRAN_API int64_t _lpython_open(char *path, char *flags)
+{
+    FILE *fd;
+    fd = fopen(path, flags);
+    if (!fd)
+    {
+        printf("Error in opening the file!\n");
+        perror(path);
+        exit(1);
+    }
+    return (int64_t)fd;
+}
+
+/*
+ * I/O locks
+ *
+ * READ and WRITE statements may run on several threads at once, e.g. inside
+ * an OpenMP parallel region. The unit table and every connected unit have an
+ * `io_lock_t`: a spin lock that yields the processor while it waits, which
+ * needs no thread library. Critical sections are short: a table lookup, or
+ * the transfer of one record.
+ *
+ * Output to the standard units takes no lock of ours: a record is written
+ * with a single stdio call, and stdio locks the stream for it.
+ */
+
+#if defined(_WIN32)
+#  define io_yield() SwitchToThread()
+#else
+#  include <sched.h>
+#  define io_yield() sched_yield()
+#endif
+
+typedef long io_lock_t;
+
+static inline bool io_try_lock(io_lock_t* l) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _InterlockedExchange((volatile long*)l, 1) == 0;
+#else
+    return __atomic_exchange_n(l, 1, __ATOMIC_ACQUIRE) == 0;
+#endif
+}
+
+static void io_lock(io_lock_t* l) {
+    int spins = 0;
+    while (!io_try_lock(l)) {
+        if (++spins >= 64) {
+            io_yield();
+            spins = 0;
+        }
+    }
+}
+
+static inline void io_unlock(io_lock_t* l) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    _InterlockedExchange((volatile long*)l, 0);
+#else
+    __atomic_store_n(l, 0, __ATOMIC_RELEASE);
+#endif
+}
+
+/*
+ * Connected units
+ *
+ * Units live in an open addressing hash table keyed by the unit number, so
+ * looking one up costs O(1) on every READ and WRITE however many units are
+ * open, and the table grows as needed. The last unit looked up is cached,
+ * since consecutive statements usually use the same unit.
+ *
+ * `unit_table_lock` guards the table. A unit's own lock is taken while the
+ * table lock is held and guards its state and the transfer of a record.
+ *
+ * Each unit owns a UNIT_BUFFER_SIZE stdio buffer. Its contents reach the
+ * file on FLUSH, CLOSE, REWIND, BACKSPACE, when the buffer is full and at
+ * program exit.
+ *
+ * A sequential WRITE makes the record written the last one of the file, so
+ * whatever followed it has to be discarded. Instead of truncating the file
+ * after each WRITE, the unit is marked and the file is truncated once, by
+ * the first operation on the unit that is not a WRITE (see `sync_unit`).
+ *
+ * Any other operation on a unit first waits for the asynchronous WRITEs
+ * pending on it (see "Asynchronous transfers" below).
+ */
+
+#define UNIT_BUFFER_SIZE (64*1024)
+
+struct UNIT_FILE {
+    int32_t unit;
+    char* filename;
+    FILE* filep;
+    bool unit_file_bin;
+    int access_id;
+    char* buffer;
+    bool truncate_pending;
+    io_lock_t lock;
+    int64_t async_id;         // The last asynchronous transfer submitted
+};
+
+struct UNIT_TABLE {
+    struct UNIT_FILE** slots; // NULL for an empty slot
+    int64_t capacity;         // A power of two, or 0
+    int64_t size;
+    struct UNIT_FILE* last;   // The unit found by the last lookup
+};
+
+static struct UNIT_TABLE unit_table = {NULL, 0, 0, NULL};
+static io_lock_t unit_table_lock = 0;
+
+static bool async_complete(int64_t id);
+static void async_wait(int64_t id);
+
+static inline uint64_t unit_hash(int32_t unit_num) {
+    // Fibonacci hashing: units are usually small consecutive numbers
+    return (uint64_t)(uint32_t)unit_num * 0x9E3779B97F4A7C15ULL;
+}
+
+// The functions below that take no lock expect `unit_table_lock` to be held
+static int64_t unit_slot(int32_t unit_num) {
+    uint64_t mask = (uint64_t)unit_table.capacity - 1;
+    uint64_t i = unit_hash(unit_num) & mask;
+    while (unit_table.slots[i] != NULL && unit_table.slots[i]->unit != unit_num) {
+        i = (i + 1) & mask;
+    }
+    return (int64_t)i;
+}
+
+static struct UNIT_FILE* find_unit(int32_t unit_num) {
+    if (unit_table.last != NULL && unit_table.last->unit == unit_num) {
+        return unit_table.last;
+    }
+    if (unit_table.size == 0) {
+        return NULL;
+    }
+    struct UNIT_FILE* u = unit_table.slots[unit_slot(unit_num)];
+    if (u != NULL) unit_table.last = u;
+    return u;
+}
+
+static void grow_unit_table() {
+    struct UNIT_FILE** old_slots = unit_table.slots;
+    int64_t old_capacity = unit_table.capacity;
+    unit_table.capacity = old_capacity == 0 ? 16 : 2 * old_capacity;
+    unit_table.slots = (struct UNIT_FILE**) calloc(unit_table.capacity,
+        sizeof(struct UNIT_FILE*));
+    if (unit_table.slots == NULL) {
+        printf("Runtime error: Not enough memory to open a new unit\n");
+        exit(1);
+    }
+    for (int64_t i = 0; i < old_capacity; i++) {
+        if (old_slots[i] != NULL) {
+            unit_table.slots[unit_slot(old_slots[i]->unit)] = old_slots[i];
+        }
+    }
+    free(old_slots);
+}
+
+// Discards the rest of the file after a WRITE and flushes the buffer
+static void sync_unit(struct UNIT_FILE* u) {
+    if (u->truncate_pending) {
+        u->truncate_pending = false;
+        fflush(u->filep);
+        (void)!ftruncate(fileno(u->filep), ftell(u->filep));
+    }
+}
+
+static void sync_all_units() {
+    io_lock(&unit_table_lock);
+    for (int64_t i = 0; i < unit_table.capacity; i++) {
+        struct UNIT_FILE* u = unit_table.slots[i];
+        if (u != NULL && u->filep != NULL) {
+            io_lock(&u->lock);
+            sync_unit(u);
+            fflush(u->filep);
+            io_unlock(&u->lock);
+        }
+    }
+    io_unlock(&unit_table_lock);
+}
+
+/*
+    `sync_all_units` for program exit, which may happen while a lock is held
+    (e.g. a runtime error in the middle of a transfer). Such a unit is left
+    as it is; stdio still flushes it afterwards.
+*/
+static void sync_all_units_at_exit() {
+    if (!io_try_lock(&unit_table_lock)) return;
+    for (int64_t i = 0; i < unit_table.capacity; i++) {
+        struct UNIT_FILE* u = unit_table.slots[i];
+        if (u != NULL && u->filep != NULL && io_try_lock(&u->lock)) {
+            sync_unit(u);
+            fflush(u->filep);
+            io_unlock(&u->lock);
+        }
+    }
+    io_unlock(&unit_table_lock);
+}
+
+void store_unit_file(int32_t unit_num, char* filename, FILE* filep, bool unit_file_bin, int access_id) {
+    static bool sync_at_exit = false;
+    io_lock(&unit_table_lock);
+    if (!sync_at_exit) {
+        // Runs before stdio flushes and closes the streams
+        atexit(sync_all_units_at_exit);
+        sync_at_exit = true;
+    }
+    if (2 * (unit_table.size + 1) > unit_table.capacity) {
+        grow_unit_table();
+    }
+    int64_t i = unit_slot(unit_num);
+    struct UNIT_FILE* u = unit_table.slots[i];
+    if (u == NULL) {
+        u = (struct UNIT_FILE*) malloc(sizeof(struct UNIT_FILE));
+        u->buffer = NULL;
+        u->lock = 0;
+        u->async_id = 0;
+        unit_table.slots[i] = u;
+        unit_table.size++;
+    }
+    u->unit = unit_num;
+    u->filename = filename;
+    u->filep = filep;
+    u->unit_file_bin = unit_file_bin;
+    u->access_id = access_id;
+    u->truncate_pending = false;
+    if (filep != NULL) {
+        if (u->buffer == NULL) u->buffer = (char*) malloc(UNIT_BUFFER_SIZE);
+        if (u->buffer != NULL) {
+            setvbuf(filep, u->buffer, _IOFBF, UNIT_BUFFER_SIZE);
+        }
+    }
+    unit_table.last = u;
+    io_unlock(&unit_table_lock);
+}
+
+/*
+    Looks up the unit once no asynchronous transfer is pending on it. Returns
+    with `unit_table_lock` held and the unit, if any, locked.
+*/
+static struct UNIT_FILE* find_unit_and_wait(int32_t unit_num) {
+    while (true) {
+        io_lock(&unit_table_lock);
+        struct UNIT_FILE* u = find_unit(unit_num);
+        if (u == NULL) return NULL;
+        io_lock(&u->lock);
+        int64_t id = u->async_id;
+        if (async_complete(id)) return u;
+        io_unlock(&u->lock);
+        io_unlock(&unit_table_lock);
+        async_wait(id);
+    }
+}
+
+/*
+    The unit for a WRITE, which may leave the file to be truncated. The unit
+    is returned locked, and must be passed to `release_unit` once the record
+    is written (or, for an asynchronous WRITE, submitted).
+*/
+static struct UNIT_FILE* acquire_unit_for_write(int32_t unit_num, bool async) {
+    struct UNIT_FILE* u;
+    if (async) {
+        io_lock(&unit_table_lock);
+        u = find_unit(unit_num);
+        if (u != NULL) io_lock(&u->lock);
     } else {
-        srand(time(NULL));
+        u = find_unit_and_wait(unit_num);
+    }
+    io_unlock(&unit_table_lock);
+    return u;
+}
+
+static inline void release_unit(struct UNIT_FILE* u) {
+    if (u != NULL) io_unlock(&u->lock);
+}
+
+/*
+    The unit for any operation but a WRITE. The unit is stored in `*unit` and
+    returned locked, so that no other thread can move the file position
+    until it is passed to `release_unit`. Returns NULL, with `*unit` NULL, if
+    the unit is not connected.
+*/
+static FILE* acquire_unit_file(int32_t unit_num, struct UNIT_FILE** unit,
+        bool *unit_file_bin, int *access_id) {
+    if (unit_file_bin) *unit_file_bin = false;
+    struct UNIT_FILE* u = find_unit_and_wait(unit_num);
+    io_unlock(&unit_table_lock);
+    *unit = u;
+    if (u == NULL) {
+        return NULL;
+    }
+    sync_unit(u);
+    if (unit_file_bin) *unit_file_bin = u->unit_file_bin;
+    if (access_id) *access_id = u->access_id;
+    return u->filep;
+}
+
+char* get_file_name_from_unit(int32_t unit_num, bool *unit_file_bin) {
+    *unit_file_bin = false;
+    io_lock(&unit_table_lock);
+    struct UNIT_FILE* u = find_unit(unit_num);
+    char* filename = NULL;
+    if (u != NULL) {
+        *unit_file_bin = u->unit_file_bin;
+        filename = u->filename;
+    }
+    io_unlock(&unit_table_lock);
+    return filename;
+}
+
+/*
+    Removes the unit from the table. Expects `unit_table_lock` to be held and
+    the unit to be locked: nobody else can reach the unit afterwards.
+*/
+static void remove_unit(struct UNIT_FILE* u) {
+    int64_t i = unit_slot(u->unit);
+    free(u->buffer);
+    free(u);
+    unit_table.slots[i] = NULL;
+    unit_table.size--;
+    if (unit_table.last == u) unit_table.last = NULL;
+    // Move back the units that follow in the same probe sequence
+    uint64_t mask = (uint64_t)unit_table.capacity - 1;
+    uint64_t hole = (uint64_t)i;
+    uint64_t j = (hole + 1) & mask;
+    while (unit_table.slots[j] != NULL) {
+        uint64_t home = unit_hash(unit_table.slots[j]->unit) & mask;
+        // Can the unit in `j` move to `hole`, i.e. is `hole` not in (home, j]?
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            unit_table.slots[hole] = unit_table.slots[j];
+            unit_table.slots[j] = NULL;
+            hole = j;
+        }
+        j = (j + 1) & mask;
+    }
+}
+
+/*
+ * Unformatted transfers
+ *
+ * A sequential record is written as its length in 4 bytes, the data and the
+ * length again. Like gfortran and ifort, a record longer than
+ * UNFORMATTED_SUBRECORD_MAX bytes is split into subrecords: a negative
+ * leading length means that another subrecord follows, a negative trailing
+ * length that another one precedes.
+ *
+ * Transfers of UNIT_BUFFER_SIZE bytes or more bypass the stdio buffer: the
+ * pieces of a record (markers included) go to the file with one `writev`,
+ * straight from the variables, and arrays are read with `pread`.
+ */
+
+#define UNFORMATTED_SUBRECORD_MAX INT32_MAX
+
+#if defined(_WIN32)
+struct iovec {
+    void* iov_base;
+    size_t iov_len;
+};
+#endif
+
+#if !defined(IOV_MAX)
+#  define IOV_MAX 1024
+#endif
+
+#if !defined(_WIN32)
+// Writes all of `iov`, which is modified, at the current file offset
+static bool write_fully(int fd, struct iovec* iov, int64_t count) {
+    while (count > 0) {
+        int n = count < IOV_MAX ? (int)count : IOV_MAX;
+        ssize_t written = writev(fd, iov, n);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        while (count > 0 && (size_t)written >= iov->iov_len) {
+            written -= iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = (char*)iov->iov_base + written;
+            iov->iov_len -= written;
+        }
+    }
+    return true;
+}
+#endif
+
+/*
+ * Writes the `count` pieces of data of one record, `total_size` bytes in
+ * all, at the current position; with record markers if `sequential`.
+ */
+static bool write_unformatted_record(FILE* filep, bool sequential,
+        const struct iovec* data, int64_t count, int64_t total_size) {
+    int64_t subrecords = 0;
+    if (sequential) {
+        subrecords = total_size == 0 ? 1
+            : (total_size + UNFORMATTED_SUBRECORD_MAX - 1) / UNFORMATTED_SUBRECORD_MAX;
+    }
+    // Each subrecord adds two markers and splits at most one piece
+    int64_t capacity = count + 3 * subrecords;
+    struct iovec inline_pieces[64];
+    int32_t inline_markers[8];
+    struct iovec* pieces = capacity <= 64 ? inline_pieces
+        : (struct iovec*) malloc(capacity * sizeof(struct iovec));
+    int32_t* markers = 2 * subrecords <= 8 ? inline_markers
+        : (int32_t*) malloc(2 * subrecords * sizeof(int32_t));
+    if (pieces == NULL || markers == NULL) {
+        printf("Runtime error: Not enough memory to write the record\n");
+        exit(1);
+    }
+
+    int64_t n = 0;
+    int64_t subrecord = 0;
+    int64_t left = 0;      // Data left in the current subrecord
+    int64_t remaining = total_size;
+    if (sequential) {
+        left = remaining < UNFORMATTED_SUBRECORD_MAX ? remaining : UNFORMATTED_SUBRECORD_MAX;
+        markers[0] = (int32_t)(subrecords > 1 ? -left : left);
+        pieces[n].iov_base = &markers[0];
+        pieces[n++].iov_len = sizeof(int32_t);
+    }
+    for (int64_t i = 0; i < count; i++) {
+        char* ptr = (char*)data[i].iov_base;
+        int64_t len = data[i].iov_len;
+        while (len > 0) {
+            int64_t take = (!sequential || len < left) ? len : left;
+            pieces[n].iov_base = ptr;
+            pieces[n++].iov_len = take;
+            ptr += take;
+            len -= take;
+            remaining -= take;
+            if (!sequential) continue;
+            left -= take;
+            if (left == 0 && remaining > 0) {
+                // Close this subrecord and open the next one
+                int32_t length = markers[2 * subrecord];
+                if (length < 0) length = -length;
+                markers[2 * subrecord + 1] = subrecord > 0 ? -length : length;
+                pieces[n].iov_base = &markers[2 * subrecord + 1];
+                pieces[n++].iov_len = sizeof(int32_t);
+                subrecord++;
+                left = remaining < UNFORMATTED_SUBRECORD_MAX ? remaining : UNFORMATTED_SUBRECORD_MAX;
+                markers[2 * subrecord] = (int32_t)(subrecord < subrecords - 1 ? -left : left);
+                pieces[n].iov_base = &markers[2 * subrecord];
+                pieces[n++].iov_len = sizeof(int32_t);
+            }
+        }
+    }
+    if (sequential) {
+        int32_t length = markers[2 * subrecord];
+        if (length < 0) length = -length;
+        markers[2 * subrecord + 1] = subrecord > 0 ? -length : length;
+        pieces[n].iov_base = &markers[2 * subrecord + 1];
+        pieces[n++].iov_len = sizeof(int32_t);
+    }
+
+    bool ok = true;
+#if !defined(_WIN32)
+    if (total_size >= UNIT_BUFFER_SIZE) {
+        ok = fflush(filep) == 0 && write_fully(fileno(filep), pieces, n);
+        // The stream does not know about the data written to its descriptor
+        fseek(filep, 0, SEEK_END);
+    } else
+#endif
+    {
+        for (int64_t i = 0; i < n && ok; i++) {
+            ok = fwrite(pieces[i].iov_base, 1, pieces[i].iov_len, filep) == pieces[i].iov_len;
+        }
+    }
+    if (pieces != inline_pieces) free(pieces);
+    if (markers != inline_markers) free(markers);
+    return ok;
+}
+
+// Reads up to `size` bytes at the current position, returns the number read
+static int64_t read_unformatted(FILE* filep, void* p, int64_t size) {
+#if !defined(_WIN32)
+    if (size >= UNIT_BUFFER_SIZE) {
+        off_t offset = ftello(filep);
+        if (offset >= 0) {
+            int fd = fileno(filep);
+            int64_t done = 0;
+            while (done < size) {
+                ssize_t n = pread(fd, (char*)p + done, size - done, offset + done);
+                if (n < 0 && errno == EINTR) continue;
+                if (n <= 0) break;
+                done += n;
+            }
+            // Also drops what the stream had read ahead
+            fseeko(filep, offset + done, SEEK_SET);
+            return done;
+        }
+    }
+#endif
+    return fread(p, 1, size, filep);
+}
+
+/*
+ * Reads `size` bytes of data from the next record, following it into its
+ * next subrecords if needed, and moves past the rest of the record and its
+ * trailing marker. Returns the number of bytes of data read.
+ */
+static int64_t read_unformatted_record(FILE* filep, void* p, int64_t size) {
+    int32_t marker;
+    if (fread(&marker, sizeof(int32_t), 1, filep) != 1) return 0;
+    int64_t done = 0;
+    while (true) {
+        int64_t length = marker < 0 ? -(int64_t)marker : marker;
+        int64_t n = size - done < length ? size - done : length;
+        int64_t read = read_unformatted(filep, (char*)p + done, n);
+        done += read;
+        // Skip the unread data and the trailing marker, then read the
+        // leading marker of the next subrecord, if any
+        if (read != n
+                || fseeko(filep, length - n + sizeof(int32_t), SEEK_CUR) != 0
+                || marker >= 0
+                || fread(&marker, sizeof(int32_t), 1, filep) != 1) {
+            return done;
+        }
+    }
+}
+
+/*
+ * Asynchronous transfers
+ *
+ * A WRITE with ID= to a connected file only copies its record to a queue and
+ * returns; an I/O thread, started by the first such WRITE, writes the queued
+ * records in order. Transfers are numbered from 1 in the order they are
+ * queued and complete in that order, so a transfer is complete once
+ * `async_done` has reached its ID, and the last transfer queued for a unit
+ * (`UNIT_FILE.async_id`) completes after all its others. The ID 0 stands for
+ * a transfer that was done synchronously.
+ *
+ * Every other operation on a unit first waits for the transfers pending on
+ * it, and program exit waits for all of them. Once ASYNC_QUEUE_LIMIT bytes
+ * are queued, a new asynchronous WRITE waits for the I/O thread to catch up.
+ * A failed transfer is recorded until a WAIT for it, or for its unit,
+ * reports it.
+ *
+ * Without threads (WebAssembly), or if the I/O thread cannot be started,
+ * transfers are done synchronously.
+ */
+
+#define ASYNC_QUEUE_LIMIT ((int64_t)256*1024*1024)
+
+#if defined(COMPILE_TO_WASM)
+typedef int async_mutex_t;
+typedef int async_cond_t;
+#  define ASYNC_MUTEX_INIT 0
+#  define ASYNC_COND_INIT 0
+#  define async_mutex_lock(m) ((void)0)
+#  define async_mutex_unlock(m) ((void)0)
+#  define async_cond_wait(c, m) ((void)0)
+#  define async_cond_broadcast(c) ((void)0)
+#elif defined(_WIN32)
+typedef SRWLOCK async_mutex_t;
+typedef CONDITION_VARIABLE async_cond_t;
+#  define ASYNC_MUTEX_INIT SRWLOCK_INIT
+#  define ASYNC_COND_INIT CONDITION_VARIABLE_INIT
+#  define async_mutex_lock(m) AcquireSRWLockExclusive(m)
+#  define async_mutex_unlock(m) ReleaseSRWLockExclusive(m)
+#  define async_cond_wait(c, m) SleepConditionVariableSRW(c, m, INFINITE, 0)
+#  define async_cond_broadcast(c) WakeAllConditionVariable(c)
+#else
+#  include <pthread.h>
+typedef pthread_mutex_t async_mutex_t;
+typedef pthread_cond_t async_cond_t;
+#  define ASYNC_MUTEX_INIT PTHREAD_MUTEX_INITIALIZER
+#  define ASYNC_COND_INIT PTHREAD_COND_INITIALIZER
+#  define async_mutex_lock(m) pthread_mutex_lock(m)
+#  define async_mutex_unlock(m) pthread_mutex_unlock(m)
+#  define async_cond_wait(c, m) pthread_cond_wait(c, m)
+#  define async_cond_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+struct async_transfer {
+    struct UNIT_FILE* u;
+    int64_t id;
+    bool unformatted;
+    char* data;
+    int64_t size;
+    struct async_transfer* next;
+};
+
+struct async_error {
+    int32_t unit;
+    int64_t id;
+    int32_t iostat;
+    struct async_error* next;
+};
+
+// `async_mutex` guards the queue and the variables below it
+static async_mutex_t async_mutex = ASYNC_MUTEX_INIT;
+static async_cond_t async_queued = ASYNC_COND_INIT;
+static async_cond_t async_completed = ASYNC_COND_INIT;
+static struct async_transfer* async_head = NULL;
+static struct async_transfer* async_tail = NULL;
+static int64_t async_bytes = 0;     // Queued, not yet written
+static int64_t async_ids = 0;       // The last ID handed out
+static int64_t async_done = 0;      // The last transfer completed
+static bool async_thread_started = false;
+static struct async_error* async_errors = NULL;
+
+// Set by `_lfortran_async_begin` for the WRITE that follows it
+static rng_thread_local bool async_requested = false;
+static rng_thread_local int32_t async_unit = 0;
+static rng_thread_local int64_t async_last = 0;
+
+static bool async_complete(int64_t id) {
+    if (id == 0) return true;
+    async_mutex_lock(&async_mutex);
+    bool complete = async_done >= id;
+    async_mutex_unlock(&async_mutex);
+    return complete;
+}
+
+// Must be called with no unit locked, as the I/O thread may need the lock
+static void async_wait(int64_t id) {
+    async_mutex_lock(&async_mutex);
+    while (async_done < id) {
+        async_cond_wait(&async_completed, &async_mutex);
+    }
+    async_mutex_unlock(&async_mutex);
+}
+
+#if !defined(COMPILE_TO_WASM)
+static void async_wait_all_at_exit() {
+    async_mutex_lock(&async_mutex);
+    int64_t id = async_ids;
+    async_mutex_unlock(&async_mutex);
+    async_wait(id);
+}
+
+static int32_t async_execute(struct async_transfer* t) {
+    struct UNIT_FILE* u = t->u;
+    bool written;
+    io_lock(&u->lock);
+    if (t->unformatted) {
+        struct iovec data;
+        data.iov_base = t->data;
+        data.iov_len = (size_t)t->size;
+        fseek(u->filep, 0, SEEK_END);
+        written = write_unformatted_record(u->filep, u->access_id != 1,
+            &data, 1, t->size);
+    } else {
+        written = fwrite(t->data, 1, t->size, u->filep) == (size_t)t->size;
+    }
+    u->truncate_pending = true;
+    io_unlock(&u->lock);
+    return written ? 0 : 11;
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI async_thread(LPVOID arg)
+#else
+static void* async_thread(void* arg)
+#endif
+{
+    (void)arg;
+    async_mutex_lock(&async_mutex);
+    while (true) {
+        while (async_head == NULL) {
+            async_cond_wait(&async_queued, &async_mutex);
+        }
+        struct async_transfer* t = async_head;
+        async_mutex_unlock(&async_mutex);
+        int32_t iostat = async_execute(t);
+        struct async_error* e = NULL;
+        if (iostat != 0) {
+            e = (struct async_error*) malloc(sizeof(struct async_error));
+        }
+        async_mutex_lock(&async_mutex);
+        async_head = t->next;
+        if (async_head == NULL) async_tail = NULL;
+        async_bytes -= t->size;
+        async_done = t->id;
+        if (e != NULL) {
+            e->unit = t->u->unit;
+            e->id = t->id;
+            e->iostat = iostat;
+            e->next = async_errors;
+            async_errors = e;
+        }
+        async_cond_broadcast(&async_completed);
+        free(t->data);
+        free(t);
+    }
+    return 0;
+}
+#endif
+
+// Expects `async_mutex` to be held
+static bool async_start_thread() {
+#if defined(COMPILE_TO_WASM)
+    return false;
+#else
+#  if defined(_WIN32)
+    HANDLE thread = CreateThread(NULL, 0, async_thread, NULL, 0, NULL);
+    if (thread == NULL) return false;
+    CloseHandle(thread);
+#  else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, async_thread, NULL) != 0) return false;
+    pthread_detach(thread);
+#  endif
+    atexit(async_wait_all_at_exit);
+    return true;
+#endif
+}
+
+/*
+ * Queues a copy of the `count` pieces of a record, `size` bytes in all, for
+ * the unit `u`, which is locked. Returns the ID of the transfer, or 0 if it
+ * must be done synchronously (the queue is then empty).
+ */
+static int64_t async_submit(struct UNIT_FILE* u, bool unformatted,
+        const struct iovec* data, int64_t count, int64_t size) {
+    async_mutex_lock(&async_mutex);
+    if (!async_thread_started) {
+        async_thread_started = async_start_thread();
+    }
+    bool started = async_thread_started;
+    async_mutex_unlock(&async_mutex);
+    if (!started) return 0;
+
+    struct async_transfer* t = (struct async_transfer*)
+        malloc(sizeof(struct async_transfer));
+    char* copy = (char*) malloc(size > 0 ? size : 1);
+    if (t == NULL || copy == NULL) {
+        io_unlock(&u->lock);
+        printf("Runtime error: Not enough memory to write the record\n");
+        exit(1);
+    }
+    int64_t offset = 0;
+    for (int64_t i = 0; i < count; i++) {
+        memcpy(copy + offset, data[i].iov_base, data[i].iov_len);
+        offset += data[i].iov_len;
+    }
+    t->u = u;
+    t->unformatted = unformatted;
+    t->data = copy;
+    t->size = size;
+    t->next = NULL;
+
+    async_mutex_lock(&async_mutex);
+    t->id = ++async_ids;
+    if (async_tail == NULL) {
+        async_head = t;
+    } else {
+        async_tail->next = t;
+    }
+    async_tail = t;
+    async_bytes += size;
+    async_cond_broadcast(&async_queued);
+    async_mutex_unlock(&async_mutex);
+    u->async_id = t->id;
+    return t->id;
+}
+
+/*
+ * Makes the next WRITE of the calling thread to `unit_num` asynchronous.
+ * `_lfortran_async_end` returns the ID of its transfer.
+ */
+LFORTRAN_API void _lfortran_async_begin(int32_t unit_num) {
+    async_mutex_lock(&async_mutex);
+    while (async_bytes > ASYNC_QUEUE_LIMIT) {
+        async_cond_wait(&async_completed, &async_mutex);
+    }
+    async_mutex_unlock(&async_mutex);
+    async_requested = true;
+    async_unit = unit_num;
+    async_last = 0;
+}
+
+LFORTRAN_API int64_t _lfortran_async_end() {
+    async_requested = false;
+    return async_last;
+}
+
+// The last transfer queued for the unit, for an `id` < 0
+static int64_t async_resolve_id(int32_t unit_num, int64_t id) {
+    if (id >= 0) return id;
+    io_lock(&unit_table_lock);
+    struct UNIT_FILE* u = find_unit(unit_num);
+    if (u != NULL) {
+        io_lock(&u->lock);
+        id = u->async_id;
+        io_unlock(&u->lock);
+    } else {
+        id = 0;
+    }
+    io_unlock(&unit_table_lock);
+    return id;
+}
+
+/*
+ * WAIT: waits for the transfer `id` or, if `id` < 0, for all the transfers
+ * pending on the unit, and reports the first of their errors.
+ */
+LFORTRAN_API void _lfortran_wait(int32_t unit_num, int64_t id, int32_t* iostat) {
+    bool all = id < 0;
+    id = async_resolve_id(unit_num, id);
+    async_wait(id);
+    int32_t status = 0;
+    async_mutex_lock(&async_mutex);
+    struct async_error** e = &async_errors;
+    while (*e != NULL) {
+        if ((*e)->unit == unit_num && (all ? (*e)->id <= id : (*e)->id == id)) {
+            struct async_error* next = (*e)->next;
+            status = (*e)->iostat;
+            free(*e);
+            *e = next;
+        } else {
+            e = &(*e)->next;
+        }
+    }
+    async_mutex_unlock(&async_mutex);
+    if (iostat != NULL) {
+        *iostat = status;
+    } else if (status != 0) {
+        fprintf(stderr, "Runtime error: Asynchronous WRITE to unit %d failed\n",
+            unit_num);
+        exit(1);
+    }
+}
+
+// INQUIRE(PENDING=): whether the transfer `id`, or any on the unit, is pending
+LFORTRAN_API bool _lfortran_async_pending(int32_t unit_num, int64_t id) {
+    return !async_complete(async_resolve_id(unit_num, id));
+}
+
+/*
+ * Parallel loops
+ *
+ * With `--do-concurrent-runtime=lfortran` a `do concurrent` loop calls the
+ * entry points below instead of their GOMP counterparts: the loop body is
+ * outlined into a procedure that `_lfortran_parallel` runs on every thread
+ * of a team, and which either partitions the iterations by its thread number
+ * (static schedule) or takes them in chunks from `_lfortran_loop_dynamic_*`
+ * (dynamic schedule).
+ *
+ * A team is the calling thread and workers of a pool, which are started on
+ * first use and wait on a condition variable between regions. Its size is
+ * LFORTRAN_NUM_THREADS, else OMP_NUM_THREADS, else the number of processors.
+ * A region started inside another region, or while another thread runs one,
+ * runs on the calling thread alone.
+ *
+ * The dynamic schedule steals work: every thread starts with an equal,
+ * contiguous share of the iterations and takes chunks from its front. Once
+ * its share is used up, a thread takes the upper half of what is left of
+ * another share and makes it its own, so that threads keep working on
+ * contiguous iterations while the load balances. A team distributes one
+ * loop at a time: all threads must be done with a loop before any starts
+ * the next, which the barrier the compiler emits after each loop ensures.
+ */
+
+#define PAR_MAX_THREADS 256
+
+// The iterations of a share not yet handed out, on a cache line of its own
+struct par_share {
+    io_lock_t lock;
+    int64_t next;
+    int64_t end;
+    char pad[64 - sizeof(io_lock_t) - 2*sizeof(int64_t)];
+};
+
+struct par_team {
+    int32_t size;
+    void (*fn)(void*);
+    void* data;
+    int64_t barrier_waiting;
+    int64_t barrier_generation;
+    // The loop of the dynamic schedule, set up by the first thread to start it
+    io_lock_t loop_lock;
+    int64_t loops;              // loops started
+    int64_t loop_start;
+    int64_t loop_incr;
+    int64_t loop_chunk;
+    struct par_share* shares;   // one per thread
+};
+
+// The team of the calling thread, NULL outside of parallel regions
+static rng_thread_local struct par_team* par_team = NULL;
+static rng_thread_local int32_t par_thread_num = 0;
+static rng_thread_local int64_t par_loops = 0;      // loops started in the team
+static rng_thread_local int32_t par_victim = 0;     // last share stolen from
+
+static io_lock_t par_atomic_lock = 0;
+
+static void par_run(struct par_team* team, int32_t thread_num) {
+    struct par_team* outer_team = par_team;
+    int32_t outer_thread_num = par_thread_num;
+    int64_t outer_loops = par_loops;
+    par_team = team;
+    par_thread_num = thread_num;
+    par_loops = 0;
+    team->fn(team->data);
+    par_team = outer_team;
+    par_thread_num = outer_thread_num;
+    par_loops = outer_loops;
+}
+
+static int32_t par_default_threads() {
+    const char* names[] = {"LFORTRAN_NUM_THREADS", "OMP_NUM_THREADS"};
+    for (int i = 0; i < 2; i++) {
+        const char* value = getenv(names[i]);
+        if (value != NULL && atoi(value) > 0) return atoi(value);
+    }
+#if defined(COMPILE_TO_WASM)
+    return 1;
+#elif defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int32_t)info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int32_t)n : 1;
+#endif
+}
+
+#if !defined(COMPILE_TO_WASM)
+// `par_mutex` guards the variables below it
+static async_mutex_t par_mutex = ASYNC_MUTEX_INIT;
+static async_cond_t par_started = ASYNC_COND_INIT;
+static int32_t par_workers = 0;
+static int64_t par_generation = 0;          // regions started
+static struct par_team* par_current = NULL; // the team of the last region
+static int64_t par_running = 0;             // workers still in the region
+static io_lock_t par_region_lock = 0;       // held while a region runs
+static struct par_team par_pool_team;
+static struct par_share par_pool_shares[PAR_MAX_THREADS];
+
+#if defined(_WIN32)
+static DWORD WINAPI par_worker(LPVOID arg)
+#else
+static void* par_worker(void* arg)
+#endif
+{
+    int32_t thread_num = (int32_t)(intptr_t)arg;
+    int64_t generation = 0;
+    async_mutex_lock(&par_mutex);
+    while (true) {
+        while (par_generation == generation) {
+            async_cond_wait(&par_started, &par_mutex);
+        }
+        generation = par_generation;
+        struct par_team* team = par_current;
+        if (thread_num >= team->size) continue;
+        async_mutex_unlock(&par_mutex);
+        par_run(team, thread_num);
+        rng_atomic_add(&par_running, -1);
+        async_mutex_lock(&par_mutex);
+    }
+    return 0;
+}
+
+// Expects `par_mutex` to be held
+static bool par_start_worker(int32_t thread_num) {
+    void* arg = (void*)(intptr_t)thread_num;
+#  if defined(_WIN32)
+    HANDLE thread = CreateThread(NULL, 0, par_worker, arg, 0, NULL);
+    if (thread == NULL) return false;
+    CloseHandle(thread);
+#  else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, par_worker, arg) != 0) return false;
+    pthread_detach(thread);
+#  endif
+    return true;
+}
+#endif
+
+// Runs `fn(data)` on each thread of a team of `num_threads` threads (0: the
+// default) and returns once all are done
+LFORTRAN_API void _lfortran_parallel(void (*fn)(void*), void* data,
+        int32_t num_threads, int32_t flags) {
+    (void)flags;
+    struct par_share share;
+    struct par_team serial;
+    memset(&share, 0, sizeof(share));
+    memset(&serial, 0, sizeof(serial));
+    serial.size = 1;
+    serial.fn = fn;
+    serial.data = data;
+    serial.shares = &share;
+#if defined(COMPILE_TO_WASM)
+    (void)num_threads;
+    par_run(&serial, 0);
+#else
+    if (par_team != NULL || !io_try_lock(&par_region_lock)) {
+        par_run(&serial, 0);
+        return;
+    }
+    int32_t size = num_threads > 0 ? num_threads : par_default_threads();
+    if (size > PAR_MAX_THREADS) size = PAR_MAX_THREADS;
+    async_mutex_lock(&par_mutex);
+    while (par_workers < size - 1 && par_start_worker(par_workers + 1)) {
+        par_workers++;
+    }
+    if (size > par_workers + 1) size = par_workers + 1;
+    if (size == 1) {
+        async_mutex_unlock(&par_mutex);
+        par_run(&serial, 0);
+        io_unlock(&par_region_lock);
+        return;
+    }
+    struct par_team* team = &par_pool_team;
+    memset(team, 0, sizeof(*team));
+    team->size = size;
+    team->fn = fn;
+    team->data = data;
+    team->shares = par_pool_shares;
+    par_current = team;
+    par_running = size - 1;
+    par_generation++;
+    async_cond_broadcast(&par_started);
+    async_mutex_unlock(&par_mutex);
+    par_run(team, 0);
+    int spins = 0;
+    while (rng_atomic_load(&par_running) != 0) {
+        if (++spins >= 64) {
+            io_yield();
+            spins = 0;
+        }
+    }
+    io_unlock(&par_region_lock);
+#endif
+}
+
+LFORTRAN_API int32_t _lfortran_get_num_threads() {
+    return par_team != NULL ? par_team->size : 1;
+}
+
+LFORTRAN_API int32_t _lfortran_get_thread_num() {
+    return par_team != NULL ? par_thread_num : 0;
+}
+
+LFORTRAN_API void _lfortran_barrier() {
+    struct par_team* team = par_team;
+    if (team == NULL || team->size == 1) return;
+    int64_t generation = rng_atomic_load(&team->barrier_generation);
+    if (rng_atomic_add(&team->barrier_waiting, 1) == team->size) {
+        team->barrier_waiting = 0;
+        rng_atomic_add(&team->barrier_generation, 1);
+        return;
+    }
+    int spins = 0;
+    while (rng_atomic_load(&team->barrier_generation) == generation) {
+        if (++spins >= 64) {
+            io_yield();
+            spins = 0;
+        }
     }
-    return false;
 }
 
-LFORTRAN_API int64_t _lfortran_random_seed(unsigned seed)
-{
-    srand(seed);
-    // The seed array size is typically 8 elements because Fortran's RNG often uses a seed with a fixed length of 8 integers to ensure sufficient randomness and repeatability in generating sequences of random numbers.
-    return 8;
+// Serializes the updates of reduction variables
+LFORTRAN_API void _lfortran_atomic_start() {
+    io_lock(&par_atomic_lock);
+}
 
+LFORTRAN_API void _lfortran_atomic_end() {
+    io_unlock(&par_atomic_lock);
 }
 
-LFORTRAN_API int64_t _lpython_open(char *path, char *flags)
-{
-    FILE *fd;
-    fd = fopen(path, flags);
-    if (!fd)
-    {
-        printf("Error in opening the file!\n");
-        perror(path);
-        exit(1);
+/*
+ * Hands out the iterations `start`, `start + incr`, ... before `end` to the
+ * threads of the team in chunks of `chunk` iterations. Each call stores the
+ * next chunk of the calling thread in [*istart, *iend) and returns true, or
+ * returns false once no iterations are left.
+ */
+LFORTRAN_API bool _lfortran_loop_dynamic_start(int64_t start, int64_t end,
+        int64_t incr, int64_t chunk, int64_t* istart, int64_t* iend) {
+    struct par_team* team = par_team;
+    int64_t count = incr > 0 ? (end - start + incr - 1) / incr
+        : (start - end - incr - 1) / -incr;
+    if (count < 0) count = 0;
+    if (team == NULL) {
+        *istart = start;
+        *iend = start + count * incr;
+        return count > 0;
+    }
+    par_loops++;
+    io_lock(&team->loop_lock);
+    if (team->loops < par_loops) {
+        team->loops = par_loops;
+        team->loop_start = start;
+        team->loop_incr = incr;
+        team->loop_chunk = chunk > 0 ? chunk : 1;
+        int64_t share = count / team->size, extra = count % team->size;
+        int64_t next = 0;
+        for (int32_t i = 0; i < team->size; i++) {
+            team->shares[i].next = next;
+            next += share + (i < extra ? 1 : 0);
+            team->shares[i].end = next;
+        }
+    }
+    io_unlock(&team->loop_lock);
+    par_victim = par_thread_num;
+    return _lfortran_loop_dynamic_next(istart, iend);
+}
+
+LFORTRAN_API bool _lfortran_loop_dynamic_next(int64_t* istart, int64_t* iend) {
+    struct par_team* team = par_team;
+    if (team == NULL) return false;
+    struct par_share* own = &team->shares[par_thread_num];
+    int64_t chunk = team->loop_chunk;
+    io_lock(&own->lock);
+    int64_t first = own->next;
+    int64_t last = own->end - first > chunk ? first + chunk : own->end;
+    own->next = last;
+    io_unlock(&own->lock);
+    if (first == last) {
+        bool stolen = false;
+        for (int32_t i = 0; i < team->size && !stolen; i++) {
+            int32_t victim = (par_victim + i) % team->size;
+            if (victim == par_thread_num) continue;
+            struct par_share* share = &team->shares[victim];
+            io_lock(&share->lock);
+            int64_t left = share->end - share->next;
+            if (left > 0) {
+                int64_t taken = left > chunk ? (left + 1) / 2 : left;
+                first = share->end - taken;
+                last = share->end;
+                share->end = first;
+                stolen = true;
+                par_victim = victim;
+            }
+            io_unlock(&share->lock);
+        }
+        if (!stolen) return false;
+        if (last - first > chunk) {
+            io_lock(&own->lock);
+            own->next = first + chunk;
+            own->end = last;
+            io_unlock(&own->lock);
+            last = first + chunk;
+        }
     }
-    return (int64_t)fd;
+    *istart = team->loop_start + first * team->loop_incr;
+    *iend = team->loop_start + last * team->loop_incr;
+    return true;
 }
 
-#define MAXUNITS 1000
+// The team may start the next loop once every thread called this and passed
+// a barrier
+LFORTRAN_API void _lfortran_loop_end_nowait() {
+}
 
-struct UNIT_FILE {
-    int32_t unit;
-    char* filename;
-    FILE* filep;
-    bool unit_file_bin;
-    int access_id;
-};
+/*
+ * Matrix multiplication
+ *
+ * `matmul` of contiguous real(4), real(8), complex(4) and complex(8)
+ * matrices calls `_lfortran_{s,d,c,z}matmul`, and `dot_product` of
+ * contiguous real vectors `_lfortran_{s,d}dot`. The operands are column
+ * major: A is m x k, B is k x n and C = A B is m x n.
+ *
+ * When the program links a BLAS, its `?gemm_` does the work. Otherwise the
+ * product is blocked as in GotoBLAS: a KC x NC block of B and an MC x KC
+ * block of A are copied ("packed") into buffers of MR row and NR column
+ * panels, so that a micro-kernel can keep an MR x NR block of C in vector
+ * registers while it streams the panels from the caches. The packing takes
+ * the strides of both dimensions, so transposed or interleaved operands
+ * cost no more than contiguous ones; a complex product is computed as four
+ * real products of the real and imaginary parts. Products of at least
+ * MM_PARALLEL_FLOPS multiply-adds split the columns of C among the threads
+ * of `_lfortran_parallel`; LFORTRAN_NUM_THREADS=1 keeps them serial.
+ */
 
-int32_t last_index_used = -1;
+#if defined(__GNUC__)
+#  if defined(__AVX__)
+#    define MM_VECTOR_BYTES 32
+#  else
+#    define MM_VECTOR_BYTES 16
+#  endif
+typedef float mm_vfloat __attribute__((vector_size(MM_VECTOR_BYTES)));
+typedef double mm_vdouble __attribute__((vector_size(MM_VECTOR_BYTES)));
+#else
+#  define MM_VECTOR_BYTES 16
+#endif
 
-struct UNIT_FILE unit_to_file[MAXUNITS];
+// The micro-kernel computes a block of two vectors by MM_NR columns of C
+#define MM_NR 4
+#define MM_KC 256
+#define MM_MC 96
+#define MM_NC 2048
+#define MM_SMALL_FLOPS 8192
+#define MM_PARALLEL_FLOPS ((int64_t)1 << 22)
+
+#if defined(__ELF__) && !defined(COMPILE_TO_WASM)
+// Resolved if the program links a BLAS, else NULL
+#  define MM_HAVE_BLAS
+extern void sgemm_(const char*, const char*, const int*, const int*,
+    const int*, const float*, const float*, const int*, const float*,
+    const int*, const float*, float*, const int*) __attribute__((weak));
+extern void dgemm_(const char*, const char*, const int*, const int*,
+    const int*, const double*, const double*, const int*, const double*,
+    const int*, const double*, double*, const int*) __attribute__((weak));
+extern void cgemm_(const char*, const char*, const int*, const int*,
+    const int*, const float*, const float*, const int*, const float*,
+    const int*, const float*, float*, const int*) __attribute__((weak));
+extern void zgemm_(const char*, const char*, const int*, const int*,
+    const int*, const double*, const double*, const int*, const double*,
+    const int*, const double*, double*, const int*) __attribute__((weak));
+#endif
 
-void store_unit_file(int32_t unit_num, char* filename, FILE* filep, bool unit_file_bin, int access_id) {
-    for( int i = 0; i <= last_index_used; i++ ) {
-        if( unit_to_file[i].unit == unit_num ) {
-            unit_to_file[i].unit = unit_num;
-            unit_to_file[i].filep = filep;
-            unit_to_file[i].unit_file_bin = unit_file_bin;
-            unit_to_file[i].access_id = access_id;
-        }
-    }
-    last_index_used += 1;
-    if( last_index_used >= MAXUNITS ) {
-        printf("Only %d units can be opened for now\n.", MAXUNITS);
-        exit(1);
+/*
+ * Defines, for the element type T and its vector type VT:
+ *
+ * NAME_gemm(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc, csc)
+ *     C = alpha A B + beta C, where element (i, j) of X is at
+ *     x[i*rsx + j*csx] and beta is 0 (C is not read) or 1
+ */
+#if defined(__GNUC__)
+// The accumulators are named so that they stay in registers at -O2, and
+// `x - 0` (unlike `x + 0`) broadcasts x without an addition
+#define MM_KERNEL(T, VT, MR)                                                   \
+    VT c00 = {0}, c01 = {0}, c10 = {0}, c11 = {0};                             \
+    VT c20 = {0}, c21 = {0}, c30 = {0}, c31 = {0};                             \
+    for (int64_t p = 0; p < kc; p++) {                                         \
+        VT a0, a1;                                                             \
+        memcpy(&a0, ap, sizeof(VT));                                           \
+        memcpy(&a1, ap + MR/2, sizeof(VT));                                    \
+        VT b0 = bp[0] - (VT){0}, b1 = bp[1] - (VT){0};                         \
+        VT b2 = bp[2] - (VT){0}, b3 = bp[3] - (VT){0};                         \
+        c00 += a0 * b0; c01 += a1 * b0;                                        \
+        c10 += a0 * b1; c11 += a1 * b1;                                        \
+        c20 += a0 * b2; c21 += a1 * b2;                                        \
+        c30 += a0 * b3; c31 += a1 * b3;                                        \
+        ap += MR;                                                              \
+        bp += MM_NR;                                                           \
+    }                                                                          \
+    VT c[MM_NR][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}};         \
+    memcpy(ab, c, sizeof(c));
+
+// y(1:n) += alpha * x(1:n)
+#define MM_AXPY(T, VT, n, alpha, x, y)                                         \
+    {                                                                          \
+        enum { lanes = MM_VECTOR_BYTES / sizeof(T) };                          \
+        VT alpha_v = alpha - (VT){0};                                          \
+        int64_t i = 0;                                                         \
+        for (; i + lanes <= n; i += lanes) {                                   \
+            VT xv, yv;                                                         \
+            memcpy(&xv, x + i, sizeof(VT));                                    \
+            memcpy(&yv, y + i, sizeof(VT));                                    \
+            yv += xv * alpha_v;                                                \
+            memcpy(y + i, &yv, sizeof(VT));                                    \
+        }                                                                      \
+        for (; i < n; i++) y[i] += x[i] * alpha;                               \
     }
-    unit_to_file[last_index_used].unit = unit_num;
-    unit_to_file[last_index_used].filename = filename;
-    unit_to_file[last_index_used].filep = filep;
-    unit_to_file[last_index_used].unit_file_bin = unit_file_bin;
-    unit_to_file[last_index_used].access_id = access_id;
+#else
+#define MM_KERNEL(T, VT, MR)                                                   \
+    T c[MM_NR][MR];                                                            \
+    memset(c, 0, sizeof(c));                                                   \
+    for (int64_t p = 0; p < kc; p++) {                                         \
+        for (int j = 0; j < MM_NR; j++) {                                      \
+            for (int i = 0; i < MR; i++) c[j][i] += ap[i] * bp[j];             \
+        }                                                                      \
+        ap += MR;                                                              \
+        bp += MM_NR;                                                           \
+    }                                                                          \
+    memcpy(ab, c, sizeof(c));
+
+#define MM_AXPY(T, VT, n, alpha, x, y)                                         \
+    for (int64_t i = 0; i < n; i++) y[i] += x[i] * alpha;
+#endif
+
+#define MM_DEFINE_GEMM(NAME, T, VT)                                            \
+enum { NAME##_mr = 2 * MM_VECTOR_BYTES / sizeof(T) };                          \
+                                                                               \
+/* ab (column major, MR x MM_NR) = the packed panels ap (kc x MR) bp (kc x    \
+   MM_NR) */                                                                   \
+static void NAME##_kernel(int64_t kc, const T* ap, const T* bp, T* ab) {       \
+    MM_KERNEL(T, VT, NAME##_mr)                                                \
+}                                                                              \
+                                                                               \
+static void NAME##_pack_a(int64_t mc, int64_t kc, const T* a, int64_t rsa,     \
+        int64_t csa, T* ap) {                                                  \
+    const int mr = NAME##_mr;                                                  \
+    for (int64_t ir = 0; ir < mc; ir += mr) {                                  \
+        int64_t rows = mc - ir < mr ? mc - ir : mr;                            \
+        for (int64_t p = 0; p < kc; p++) {                                     \
+            const T* ai = a + ir*rsa + p*csa;                                  \
+            int64_t i = 0;                                                     \
+            for (; i < rows; i++) ap[i] = ai[i*rsa];                           \
+            for (; i < mr; i++) ap[i] = 0;                                     \
+            ap += mr;                                                          \
+        }                                                                      \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+static void NAME##_pack_b(int64_t kc, int64_t nc, const T* b, int64_t rsb,     \
+        int64_t csb, T* bp) {                                                  \
+    for (int64_t jr = 0; jr < nc; jr += MM_NR) {                               \
+        int64_t cols = nc - jr < MM_NR ? nc - jr : MM_NR;                      \
+        for (int64_t p = 0; p < kc; p++) {                                     \
+            const T* bj = b + p*rsb + jr*csb;                                  \
+            int64_t j = 0;                                                     \
+            for (; j < cols; j++) bp[j] = bj[j*csb];                           \
+            for (; j < MM_NR; j++) bp[j] = 0;                                  \
+            bp += MM_NR;                                                       \
+        }                                                                      \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+static void NAME##_small(int64_t m, int64_t n, int64_t k, T alpha,            \
+        const T* a, int64_t rsa, int64_t csa, const T* b, int64_t rsb,         \
+        int64_t csb, T beta, T* c, int64_t rsc, int64_t csc) {                 \
+    for (int64_t j = 0; j < n; j++) {                                          \
+        T* cj = c + j*csc;                                                     \
+        if (beta == 0) {                                                       \
+            for (int64_t i = 0; i < m; i++) cj[i*rsc] = 0;                     \
+        }                                                                      \
+        for (int64_t p = 0; p < k; p++) {                                      \
+            T bpj = alpha * b[p*rsb + j*csb];                                  \
+            const T* ap = a + p*csa;                                           \
+            if (rsa == 1 && rsc == 1) {                                        \
+                MM_AXPY(T, VT, m, bpj, ap, cj)                                 \
+            } else {                                                           \
+                for (int64_t i = 0; i < m; i++) cj[i*rsc] += ap[i*rsa] * bpj;  \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+static void NAME##_blocked(int64_t m, int64_t n, int64_t k, T alpha,          \
+        const T* a, int64_t rsa, int64_t csa, const T* b, int64_t rsb,         \
+        int64_t csb, T beta, T* c, int64_t rsc, int64_t csc) {                 \
+    const int mr = NAME##_mr;                                                  \
+    int64_t nc_max = n < MM_NC ? (n + MM_NR - 1) / MM_NR * MM_NR : MM_NC;      \
+    int64_t mc_max = m < MM_MC ? (m + mr - 1) / mr * mr : MM_MC;               \
+    T* bp = (T*)malloc(MM_KC * nc_max * sizeof(T));                            \
+    T* ap = (T*)malloc(MM_KC * mc_max * sizeof(T));                            \
+    if (bp == NULL || ap == NULL) {                                            \
+        free(ap);                                                              \
+        free(bp);                                                              \
+        NAME##_small(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc,   \
+            csc);                                                              \
+        return;                                                                \
+    }                                                                          \
+    T ab[MM_NR * NAME##_mr];                                                   \
+    for (int64_t jc = 0; jc < n; jc += MM_NC) {                                \
+        int64_t nc = n - jc < MM_NC ? n - jc : MM_NC;                          \
+        for (int64_t pc = 0; pc < k; pc += MM_KC) {                            \
+            int64_t kc = k - pc < MM_KC ? k - pc : MM_KC;                      \
+            T beta_block = pc == 0 ? beta : 1;                                 \
+            NAME##_pack_b(kc, nc, b + pc*rsb + jc*csb, rsb, csb, bp);          \
+            for (int64_t ic = 0; ic < m; ic += MM_MC) {                        \
+                int64_t mc = m - ic < MM_MC ? m - ic : MM_MC;                  \
+                NAME##_pack_a(mc, kc, a + ic*rsa + pc*csa, rsa, csa, ap);      \
+                for (int64_t jr = 0; jr < nc; jr += MM_NR) {                   \
+                    int64_t cols = nc - jr < MM_NR ? nc - jr : MM_NR;          \
+                    for (int64_t ir = 0; ir < mc; ir += mr) {                  \
+                        int64_t rows = mc - ir < mr ? mc - ir : mr;            \
+                        NAME##_kernel(kc, ap + ir*kc, bp + jr*kc, ab);         \
+                        T* cij = c + (ic + ir)*rsc + (jc + jr)*csc;            \
+                        for (int64_t j = 0; j < cols; j++) {                   \
+                            for (int64_t i = 0; i < rows; i++) {               \
+                                T v = alpha * ab[j*mr + i];                    \
+                                if (beta_block != 0) v += cij[i*rsc + j*csc];  \
+                                cij[i*rsc + j*csc] = v;                        \
+                            }                                                  \
+                        }                                                      \
+                    }                                                          \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+    free(ap);                                                                  \
+    free(bp);                                                                  \
+}                                                                              \
+                                                                               \
+struct NAME##_args {                                                           \
+    int64_t m, n, k;                                                           \
+    T alpha, beta;                                                             \
+    const T* a; int64_t rsa, csa;                                              \
+    const T* b; int64_t rsb, csb;                                              \
+    T* c; int64_t rsc, csc;                                                    \
+};                                                                             \
+                                                                               \
+/* Multiplies the columns of C of the calling thread */                        \
+static void NAME##_columns(void* data) {                                       \
+    struct NAME##_args* x = (struct NAME##_args*)data;                         \
+    int64_t threads = _lfortran_get_num_threads();                             \
+    int64_t thread = _lfortran_get_thread_num();                               \
+    int64_t panels = (x->n + MM_NR - 1) / MM_NR;                               \
+    int64_t first = panels * thread / threads * MM_NR;                         \
+    int64_t last = panels * (thread + 1) / threads * MM_NR;                    \
+    if (last > x->n) last = x->n;                                              \
+    if (first >= last) return;                                                 \
+    NAME##_blocked(x->m, last - first, x->k, x->alpha, x->a, x->rsa, x->csa,   \
+        x->b + first*x->csb, x->rsb, x->csb, x->beta, x->c + first*x->csc,     \
+        x->rsc, x->csc);                                                       \
+}                                                                              \
+                                                                               \
+static void NAME##_gemm(int64_t m, int64_t n, int64_t k, T alpha,             \
+        const T* a, int64_t rsa, int64_t csa, const T* b, int64_t rsb,         \
+        int64_t csb, T beta, T* c, int64_t rsc, int64_t csc) {                 \
+    if (m <= 0 || n <= 0) return;                                              \
+    double flops = (double)m * (double)n * (double)k;                          \
+    if (k <= 0 || flops < MM_SMALL_FLOPS) {                                    \
+        NAME##_small(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc,   \
+            csc);                                                              \
+    } else if (flops >= (double)MM_PARALLEL_FLOPS && n >= 2 * MM_NR) {         \
+        struct NAME##_args x = {m, n, k, alpha, beta, a, rsa, csa, b, rsb,     \
+            csb, c, rsc, csc};                                                 \
+        _lfortran_parallel(NAME##_columns, &x, 0, 0);                          \
+    } else {                                                                   \
+        NAME##_blocked(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc, \
+            csc);                                                              \
+    }                                                                          \
+}
+
+#if defined(__GNUC__)
+MM_DEFINE_GEMM(mm_float, float, mm_vfloat)
+MM_DEFINE_GEMM(mm_double, double, mm_vdouble)
+#else
+MM_DEFINE_GEMM(mm_float, float, float)
+MM_DEFINE_GEMM(mm_double, double, double)
+#endif
+
+#if defined(MM_HAVE_BLAS)
+// Whether the dimensions fit the `integer` arguments of the BLAS
+static bool mm_blas_fits(int64_t m, int64_t n, int64_t k) {
+    return m <= INT_MAX && n <= INT_MAX && k <= INT_MAX;
 }
 
-FILE* get_file_pointer_from_unit(int32_t unit_num, bool *unit_file_bin, int *access_id) {
-    if (unit_file_bin) *unit_file_bin = false;
-    for( int i = 0; i <= last_index_used; i++ ) {
-        if( unit_to_file[i].unit == unit_num ) {
-            if (unit_file_bin) *unit_file_bin = unit_to_file[i].unit_file_bin;
-            if (access_id) *access_id = unit_to_file[i].access_id;
-            return unit_to_file[i].filep;
-        }
+// `alpha` and `beta` are complex for ?gemm_ of complex matrices
+#define MM_CALL_BLAS(gemm, T)                                                  \
+    if (gemm != NULL && mm_blas_fits(m, n, k)) {                               \
+        int m_ = (int)m, n_ = (int)n, k_ = (int)k;                             \
+        T alpha[] = {1, 0}, beta[] = {0, 0};                                   \
+        gemm("N", "N", &m_, &n_, &k_, alpha, (const void*)a, &m_,              \
+            (const void*)b, &k_, beta, (void*)c, &m_);                         \
+        return m * n;                                                          \
     }
-    return NULL;
+#else
+#define MM_CALL_BLAS(gemm, T)
+#endif
+
+// c(m, n) = matmul(a(m, k), b(k, n)) for contiguous a, b and c; returns the
+// number of elements of c written
+LFORTRAN_API int64_t _lfortran_smatmul(int64_t m, int64_t n, int64_t k,
+        float* a, float* b, float* c) {
+    if (m <= 0 || n <= 0) return 0;
+    MM_CALL_BLAS(sgemm_, float)
+    mm_float_gemm(m, n, k, 1, a, 1, m, b, 1, k, 0, c, 1, m);
+    return m * n;
 }
 
-char* get_file_name_from_unit(int32_t unit_num, bool *unit_file_bin) {
-    *unit_file_bin = false;
-    for (int i = 0; i <= last_index_used; i++) {
-        if (unit_to_file[i].unit == unit_num) {
-            *unit_file_bin = unit_to_file[i].unit_file_bin;
-            return unit_to_file[i].filename;
-        }
-    }
-    return NULL;
+LFORTRAN_API int64_t _lfortran_dmatmul(int64_t m, int64_t n, int64_t k,
+        double* a, double* b, double* c) {
+    if (m <= 0 || n <= 0) return 0;
+    MM_CALL_BLAS(dgemm_, double)
+    mm_double_gemm(m, n, k, 1, a, 1, m, b, 1, k, 0, c, 1, m);
+    return m * n;
 }
 
-void remove_from_unit_to_file(int32_t unit_num) {
-    int index = -1;
-    for( int i = 0; i <= last_index_used; i++ ) {
-        if( unit_to_file[i].unit == unit_num ) {
-            index = i;
-            break;
-        }
-    }
-    if( index == -1 ) {
-        return ;
-    }
-    for( int i = index; i < last_index_used; i++ ) {
-        unit_to_file[i].unit = unit_to_file[i + 1].unit;
-        unit_to_file[i].filename = unit_to_file[i + 1].filename;
-        unit_to_file[i].filep = unit_to_file[i + 1].filep;
-        unit_to_file[i].unit_file_bin = unit_to_file[i + 1].unit_file_bin;
-    }
-    last_index_used -= 1;
+/*
+ * With the real and imaginary parts interleaved, the real parts of an m x k
+ * complex matrix form a real matrix with strides 2 and 2m, and so do the
+ * imaginary parts, one element further:
+ *
+ *     Re C = Re A Re B - Im A Im B
+ *     Im C = Re A Im B + Im A Re B
+ */
+#define MM_COMPLEX_GEMM(gemm, T)                                               \
+    T* ar = (T*)a; T* ai = ar + 1;                                             \
+    T* br = (T*)b; T* bi = br + 1;                                             \
+    T* cr = (T*)c; T* ci = cr + 1;                                             \
+    gemm(m, n, k, 1, ar, 2, 2*m, br, 2, 2*k, 0, cr, 2, 2*m);                   \
+    gemm(m, n, k, -1, ai, 2, 2*m, bi, 2, 2*k, 1, cr, 2, 2*m);                  \
+    gemm(m, n, k, 1, ar, 2, 2*m, bi, 2, 2*k, 0, ci, 2, 2*m);                   \
+    gemm(m, n, k, 1, ai, 2, 2*m, br, 2, 2*k, 1, ci, 2, 2*m);
+
+LFORTRAN_API int64_t _lfortran_cmatmul(int64_t m, int64_t n, int64_t k,
+        struct _lfortran_complex_32* a, struct _lfortran_complex_32* b,
+        struct _lfortran_complex_32* c) {
+    if (m <= 0 || n <= 0) return 0;
+    MM_CALL_BLAS(cgemm_, float)
+    MM_COMPLEX_GEMM(mm_float_gemm, float)
+    return m * n;
+}
+
+LFORTRAN_API int64_t _lfortran_zmatmul(int64_t m, int64_t n, int64_t k,
+        struct _lfortran_complex_64* a, struct _lfortran_complex_64* b,
+        struct _lfortran_complex_64* c) {
+    if (m <= 0 || n <= 0) return 0;
+    MM_CALL_BLAS(zgemm_, double)
+    MM_COMPLEX_GEMM(mm_double_gemm, double)
+    return m * n;
+}
+
+/*
+ * dot_product(a(1:n), b(1:n)) for contiguous a and b. The sum is split into
+ * independent partial sums, which the scalar loop the compiler emits may
+ * not do without -ffast-math, so that the multiply-adds can overlap.
+ */
+#if defined(__GNUC__)
+#define MM_DEFINE_DOT(NAME, T, VT)                                             \
+LFORTRAN_API T NAME(int64_t n, T* a, T* b) {                                   \
+    enum { lanes = MM_VECTOR_BYTES / sizeof(T) };                              \
+    VT s0 = {0}, s1 = {0}, s2 = {0}, s3 = {0};                                 \
+    int64_t i = 0;                                                             \
+    for (; i + 4*lanes <= n; i += 4*lanes) {                                   \
+        VT a0, a1, a2, a3, b0, b1, b2, b3;                                     \
+        memcpy(&a0, a + i, sizeof(VT));                                        \
+        memcpy(&a1, a + i + lanes, sizeof(VT));                                \
+        memcpy(&a2, a + i + 2*lanes, sizeof(VT));                              \
+        memcpy(&a3, a + i + 3*lanes, sizeof(VT));                              \
+        memcpy(&b0, b + i, sizeof(VT));                                        \
+        memcpy(&b1, b + i + lanes, sizeof(VT));                                \
+        memcpy(&b2, b + i + 2*lanes, sizeof(VT));                              \
+        memcpy(&b3, b + i + 3*lanes, sizeof(VT));                              \
+        s0 += a0 * b0;                                                         \
+        s1 += a1 * b1;                                                         \
+        s2 += a2 * b2;                                                         \
+        s3 += a3 * b3;                                                         \
+    }                                                                          \
+    s0 = (s0 + s1) + (s2 + s3);                                                \
+    T s = 0;                                                                   \
+    for (int j = 0; j < lanes; j++) s += s0[j];                                \
+    for (; i < n; i++) s += a[i] * b[i];                                       \
+    return s;                                                                  \
+}
+#else
+#define MM_DEFINE_DOT(NAME, T, VT)                                             \
+LFORTRAN_API T NAME(int64_t n, T* a, T* b) {                                   \
+    T s[4] = {0, 0, 0, 0};                                                     \
+    int64_t i = 0;                                                             \
+    for (; i + 4 <= n; i += 4) {                                               \
+        for (int j = 0; j < 4; j++) s[j] += a[i + j] * b[i + j];               \
+    }                                                                          \
+    for (; i < n; i++) s[0] += a[i] * b[i];                                    \
+    return (s[0] + s[1]) + (s[2] + s[3]);                                      \
 }
+#endif
+
+MM_DEFINE_DOT(_lfortran_sdot, float, mm_vfloat)
+MM_DEFINE_DOT(_lfortran_ddot, double, mm_vdouble)
 
 // Note: The length 25 was chosen to be at least as good as UUID
 //       which has 32 hex digits (36^24 < 16^32 < 36^25).
 #define ID_LEN 25
 void get_unique_ID(char buffer[ID_LEN + 1]) {
     const char v[36] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    // Does not draw from the random_number generator, so that its sequence
+    // does not depend on how many scratch files were opened
+    static int64_t ids = 0;
+    uint64_t x = (uint64_t)time(NULL) ^ ((uint64_t)clock() << 32)
+        ^ (uint64_t)(uintptr_t)buffer;
+#if !defined(_WIN32)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_REALTIME, &ts) == 0) x ^= (uint64_t)ts.tv_nsec << 16;
+#endif
+    x += (uint64_t)rng_atomic_add(&ids, 1) << 48;
+    uint64_t r = 0;
     for (int i = 0; i < ID_LEN; i++) {
-        int index = rand() % 36;
-        buffer[i] = v[index];
+        if (i % 12 == 0) r = rng_splitmix64(&x); // 36^12 < 2^64
+        buffer[i] = v[r % 36];
+        r /= 36;
     }
     buffer[ID_LEN] = '\0';
 }
@@ -3566,7 +6073,9 @@ LFORTRAN_API int64_t _lfortran_open(int32_t unit_num, char *f_name, char *status
         access = "sequential";
     }
     bool file_exists[1] = {false};
-    FILE *already_open = get_file_pointer_from_unit(unit_num, NULL, NULL);
+    struct UNIT_FILE* unit;
+    FILE *already_open = acquire_unit_file(unit_num, &unit, NULL, NULL);
+    release_unit(unit);
 
     size_t len = strlen(f_name);
     if (*(f_name + len - 1) == ' ') {
@@ -3736,6 +6245,13 @@ LFORTRAN_API int64_t _lfortran_open(int32_t unit_num, char *f_name, char *status
             perror(f_name);
             exit(1);
         }
+#if defined(POSIX_FADV_SEQUENTIAL)
+        if (fd != NULL && unit_file_bin) {
+            // Unformatted files are mostly read front to back: a larger
+            // read-ahead keeps the disk busy during a restart
+            (void)posix_fadvise(fileno(fd), 0, 0, POSIX_FADV_SEQUENTIAL);
+        }
+#endif
         store_unit_file(unit_num, f_name, fd, unit_file_bin, access_id);
         return (int64_t)fd;
     }
@@ -3746,14 +6262,11 @@ LFORTRAN_API void _lfortran_flush(int32_t unit_num)
 {
     // special case: flush all open units
     if (unit_num == -1) {
-        for (int i = 0; i <= last_index_used; i++) {
-            if (unit_to_file[i].filep != NULL) {
-                fflush(unit_to_file[i].filep);
-            }
-        }
+        sync_all_units();
     } else {
         bool unit_file_bin;
-        FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+        struct UNIT_FILE* unit;
+        FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
         if( filep == NULL ) {
             if ( unit_num == 6 ) {
                 // special case: flush OUTPUT_UNIT
@@ -3772,6 +6285,7 @@ LFORTRAN_API void _lfortran_flush(int32_t unit_num)
             exit(1);
         }
         fflush(filep);
+        release_unit(unit);
     }
 }
 
@@ -3796,30 +6310,35 @@ LFORTRAN_API void _lfortran_inquire(char *f_name, bool *exists, int32_t unit_num
     }
     if (unit_num != -1) {
         bool unit_file_bin;
-        FILE *fp = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+        struct UNIT_FILE* unit;
+        FILE *fp = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
         *opened = (fp != NULL);
         if (pos != NULL && fp != NULL) {
             long p = ftell(fp);
             *pos = (int32_t)p + 1;
         }
+        release_unit(unit);
     }
 }
 
 LFORTRAN_API void _lfortran_rewind(int32_t unit_num)
 {
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if( filep == NULL ) {
         printf("Specified UNIT %d in REWIND is not created or connected.\n", unit_num);
         exit(1);
     }
     rewind(filep);
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_backspace(int32_t unit_num)
 {
     bool unit_file_bin;
-    FILE* fd = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* fd = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (fd == NULL) {
         fprintf(stderr, "Specified UNIT %d in BACKSPACE is not created or connected.\n", unit_num);
         exit(1);
@@ -3829,6 +6348,7 @@ LFORTRAN_API void _lfortran_backspace(int32_t unit_num)
     long pos = ftell(fd);
     if (pos <= 0) {
         rewind(fd);
+        release_unit(unit);
         return;
     }
 
@@ -3839,12 +6359,364 @@ LFORTRAN_API void _lfortran_backspace(int32_t unit_num)
         ch = fgetc(fd);
         if (ch == '\n') {
             fseek(fd, pos + 1, SEEK_SET);  // Move to just after the previous newline
+            release_unit(unit);
             return;
         }
     }
 
     // If no newline found, rewind to beginning
     rewind(fd);
+    release_unit(unit);
+}
+
+/*
+ * List-directed input
+ *
+ * Values are read one token at a time straight from the stdio buffer of the
+ * unit (see UNIT_BUFFER_SIZE) and converted by hand: integers digit by
+ * digit and reals with the Eisel-Lemire algorithm, which is correctly
+ * rounded. The few inputs it does not handle (inf, nan, hexadecimal reals
+ * and more than 19 significant digits that do not fix the result) are given
+ * to strtod.
+ */
+
+#if defined(_WIN32)
+#  define lfortran_getc _getc_nolock
+#else
+#  define lfortran_getc getc_unlocked
+#endif
+
+#define LIST_TOKEN_SIZE 512
+
+static inline bool is_list_blank(int c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Reads the next value, which ends at a blank or a comma, into `token`.
+// Returns false at the end of the file. A value too long to be a number is
+// returned as an empty token.
+static bool read_list_token(FILE* filep, char token[LIST_TOKEN_SIZE]) {
+    int c = lfortran_getc(filep);
+    while (is_list_blank(c)) c = lfortran_getc(filep);
+    if (c == ',') {
+        c = lfortran_getc(filep);
+        while (is_list_blank(c)) c = lfortran_getc(filep);
+    }
+    if (c == EOF) {
+        token[0] = '\0';
+        return false;
+    }
+    int n = 0;
+    bool too_long = false;
+    while (c != EOF && c != ',' && !is_list_blank(c)) {
+        if (n < LIST_TOKEN_SIZE - 1) {
+            token[n++] = (char)c;
+        } else {
+            too_long = true;
+        }
+        c = lfortran_getc(filep);
+    }
+    if (c != EOF) ungetc(c, filep);
+    token[too_long ? 0 : n] = '\0';
+    return true;
+}
+
+// Parses a whole token as a decimal integer. Sets errno to ERANGE if it
+// does not fit in 64 bits.
+static bool parse_integer(const char* s, int64_t* value) {
+    bool negative = false;
+    if (*s == '+' || *s == '-') negative = (*s++ == '-');
+    if (*s < '0' || *s > '9') return false;
+    uint64_t v = 0;
+    for (; *s >= '0' && *s <= '9'; s++) {
+        uint64_t d = (uint64_t)(*s - '0');
+        if (v > (UINT64_MAX - d) / 10) {
+            errno = ERANGE;
+            return false;
+        }
+        v = 10 * v + d;
+    }
+    if (*s != '\0') return false;
+    if (v > (uint64_t)INT64_MAX + negative) {
+        errno = ERANGE;
+        return false;
+    }
+    *value = negative ? (int64_t)(0 - v) : (int64_t)v;
+    return true;
+}
+
+struct real_format {
+    int mantissa_bits;      // Explicitly stored bits of the significand
+    int minimum_exponent;   // The exponent bias, negated
+    int infinite_power;     // The biased exponent of inf
+    int smallest_power;     // w * 10^q rounds to zero below this q
+    int largest_power;      // w * 10^q rounds to inf above this q
+    int min_round_to_even;  // Exact halfway cases only happen for q in
+    int max_round_to_even;  // min_round_to_even .. max_round_to_even
+};
+
+static const struct real_format double_format = {52, -1023, 0x7FF, -342, 308, -4, 23};
+static const struct real_format float_format = {23, -127, 0xFF, -64, 38, -17, 10};
+
+/*
+ * The bits (without the sign) of the binary real nearest to w * 10^q, for a
+ * nonzero w. See D. Lemire, "Number Parsing at a Gigabyte per Second",
+ * Software: Practice and Experience 51(8), 2021 and N. Mushtak, D. Lemire,
+ * "Fast Number Parsing Without Fallback", 2023.
+ */
+static uint64_t eisel_lemire(uint64_t w, int64_t q, const struct real_format* f) {
+    if (q < f->smallest_power) return 0;
+    if (q > f->largest_power) return (uint64_t)f->infinite_power << f->mantissa_bits;
+    int lz = leading_zeros(w);
+    w <<= lz;
+
+    // The 64 + 64 leading bits of w * 5^q, enough to round correctly
+    int index = 2 * (int)(q - LFORTRAN_POW5_MIN);
+    uint64_t hi, lo;
+    full_multiplication(w, lfortran_pow5_128[index], &hi, &lo);
+    uint64_t precision_mask = 0xFFFFFFFFFFFFFFFFULL >> (f->mantissa_bits + 3);
+    if ((hi & precision_mask) == precision_mask) {
+        uint64_t hi2, lo2;
+        full_multiplication(w, lfortran_pow5_128[index + 1], &hi2, &lo2);
+        lo += hi2;
+        if (hi2 > lo) hi++;
+    }
+
+    int upperbit = (int)(hi >> 63);
+    int shift = upperbit + 64 - f->mantissa_bits - 3;
+    uint64_t mantissa = hi >> shift;
+    // floor(log2(10^q)) + 63, exact for the supported q
+    int32_t power2 = (int32_t)(((152170 + 65536) * (int32_t)q) >> 16) + 63
+        + upperbit - lz - f->minimum_exponent;
+    if (power2 <= 0) {
+        // Subnormal, or zero
+        if (-power2 + 1 >= 64) return 0;
+        mantissa >>= -power2 + 1;
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+        power2 = (mantissa < ((uint64_t)1 << f->mantissa_bits)) ? 0 : 1;
+        mantissa &= ~((uint64_t)1 << f->mantissa_bits);
+        return ((uint64_t)power2 << f->mantissa_bits) | mantissa;
+    }
+    // Round half to even: drop the rounding bit of an exact halfway case
+    if (lo <= 1 && q >= f->min_round_to_even && q <= f->max_round_to_even
+            && (mantissa & 3) == 1 && (mantissa << shift) == hi) {
+        mantissa &= ~(uint64_t)1;
+    }
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    if (mantissa >= ((uint64_t)2 << f->mantissa_bits)) {
+        mantissa = (uint64_t)1 << f->mantissa_bits;
+        power2++;
+    }
+    mantissa &= ~((uint64_t)1 << f->mantissa_bits);
+    if (power2 >= f->infinite_power) {
+        return (uint64_t)f->infinite_power << f->mantissa_bits;
+    }
+    return ((uint64_t)power2 << f->mantissa_bits) | mantissa;
+}
+
+/*
+ * Splits a decimal real (with an optional exponent introduced by e, d or q,
+ * in either case) into its first 19 significant digits `w` and the power of
+ * ten `q`. `truncated` is set if there were more significant digits.
+ */
+static bool parse_decimal(const char* s, bool* negative, uint64_t* w, int64_t* q, bool* truncated) {
+    *negative = false;
+    if (*s == '+' || *s == '-') *negative = (*s++ == '-');
+
+    // Accumulate all the digits, which may overflow: fixed up below
+    const char* start = s;
+    uint64_t digits = 0;
+    while (*s >= '0' && *s <= '9') {
+        digits = 10 * digits + (uint64_t)(*s - '0');
+        s++;
+    }
+    const char* end_of_integer = s;
+    int64_t n_digits = end_of_integer - start;
+    int64_t exponent = 0;
+    if (*s == '.') {
+        s++;
+        const char* start_of_fraction = s;
+        while (*s >= '0' && *s <= '9') {
+            digits = 10 * digits + (uint64_t)(*s - '0');
+            s++;
+        }
+        exponent = start_of_fraction - s;
+        n_digits -= exponent;
+    }
+    if (n_digits == 0) return false;
+    const char* end_of_digits = s;
+
+    if (*s == 'e' || *s == 'E' || *s == 'd' || *s == 'D' || *s == 'q' || *s == 'Q') {
+        s++;
+        bool negative_exponent = false;
+        if (*s == '+' || *s == '-') negative_exponent = (*s++ == '-');
+        if (*s < '0' || *s > '9') return false;
+        int64_t e = 0;
+        for (; *s >= '0' && *s <= '9'; s++) {
+            if (e < 100000) e = 10 * e + (*s - '0');
+        }
+        exponent += negative_exponent ? -e : e;
+    }
+    if (*s != '\0') return false;
+
+    *truncated = false;
+    if (n_digits > 19) {
+        // Leading zeros are not significant
+        const char* p = start;
+        while (*p == '0' || *p == '.') {
+            if (*p == '0') n_digits--;
+            p++;
+        }
+        if (n_digits > 19) {
+            // Keep the first 19 significant digits, and scale by the
+            // number of digits dropped
+            *truncated = true;
+            digits = 0;
+            for (int kept = 0; kept < 19; p++) {
+                if (*p == '.') continue;
+                digits = 10 * digits + (uint64_t)(*p - '0');
+                kept++;
+            }
+            for (; p < end_of_digits; p++) {
+                if (*p != '.') exponent++;
+            }
+        }
+    }
+    *w = digits;
+    *q = exponent;
+    return true;
+}
+
+// strtod for what `parse_decimal` rejects, and the rare hard cases
+static bool parse_real_slow(const char* s, double* d, float* f) {
+    char buffer[LIST_TOKEN_SIZE];
+    size_t n = strlen(s);
+    if (n == 0 || n >= LIST_TOKEN_SIZE) return false;
+    for (size_t i = 0; i <= n; i++) {
+        char c = s[i];
+        buffer[i] = (c == 'd' || c == 'D' || c == 'q' || c == 'Q') ? 'e' : c;
+    }
+    char* end;
+    if (d) *d = strtod(buffer, &end);
+    else *f = strtof(buffer, &end);
+    return end == buffer + n;
+}
+
+static const double exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Parses a whole token as a real(8)
+static bool parse_double(const char* s, double* value) {
+    bool negative, truncated;
+    uint64_t w;
+    int64_t q;
+    if (!parse_decimal(s, &negative, &w, &q, &truncated)) {
+        return parse_real_slow(s, value, NULL);
+    }
+    if (w == 0) {
+        *value = negative ? -0.0 : 0.0;
+        return true;
+    }
+#if FLT_EVAL_METHOD == 0
+    // Both w and 10^|q| are exact doubles: one correctly rounded operation
+    if (!truncated && q >= -22 && q <= 22 && w <= ((uint64_t)1 << 53)) {
+        double d = (double)w;
+        d = q < 0 ? d / exact_powers_of_ten[-q] : d * exact_powers_of_ten[q];
+        *value = negative ? -d : d;
+        return true;
+    }
+#endif
+    uint64_t bits = eisel_lemire(w, q, &double_format);
+    if (truncated && bits != eisel_lemire(w + 1, q, &double_format)) {
+        return parse_real_slow(s, value, NULL);
+    }
+    bits |= (uint64_t)negative << 63;
+    memcpy(value, &bits, sizeof(bits));
+    return true;
+}
+
+// Parses a whole token as a real(4)
+static bool parse_float(const char* s, float* value) {
+    bool negative, truncated;
+    uint64_t w;
+    int64_t q;
+    if (!parse_decimal(s, &negative, &w, &q, &truncated)) {
+        return parse_real_slow(s, NULL, value);
+    }
+    if (w == 0) {
+        *value = negative ? -0.0f : 0.0f;
+        return true;
+    }
+#if FLT_EVAL_METHOD == 0
+    if (!truncated && q >= -10 && q <= 10 && w <= ((uint64_t)1 << 24)) {
+        float f = (float)w;
+        float p = (float)exact_powers_of_ten[q < 0 ? -q : q];
+        f = q < 0 ? f / p : f * p;
+        *value = negative ? -f : f;
+        return true;
+    }
+#endif
+    uint64_t bits = eisel_lemire(w, q, &float_format);
+    if (truncated && bits != eisel_lemire(w + 1, q, &float_format)) {
+        return parse_real_slow(s, NULL, value);
+    }
+    uint32_t bits32 = (uint32_t)bits | ((uint32_t)negative << 31);
+    memcpy(value, &bits32, sizeof(bits32));
+    return true;
+}
+
+/*
+ * Reads up to `n` integers of the given kind (in bytes) into `p` from a
+ * formatted unit. Returns the number of values read, which is less than `n`
+ * only at the end of the file.
+ */
+static int read_list_integers(FILE* filep, void* p, int kind, int n) {
+    char token[LIST_TOKEN_SIZE];
+    int64_t min = kind == 1 ? INT8_MIN : kind == 2 ? INT16_MIN : kind == 4 ? INT32_MIN : INT64_MIN;
+    int64_t max = kind == 1 ? INT8_MAX : kind == 2 ? INT16_MAX : kind == 4 ? INT32_MAX : INT64_MAX;
+    for (int i = 0; i < n; i++) {
+        if (!read_list_token(filep, token)) return i;
+        int64_t value;
+        errno = 0;
+        if (!parse_integer(token, &value)) {
+            if (errno == ERANGE) {
+                fprintf(stderr, "Error: Value %s is out of integer(%d) range.\n", token, kind);
+            } else {
+                fprintf(stderr, "Error: Invalid input '%s' for integer(%d).\n", token, kind);
+            }
+            exit(1);
+        }
+        if (value < min || value > max) {
+            fprintf(stderr, "Error: Value %s is out of integer(%d) range.\n", token, kind);
+            exit(1);
+        }
+        switch (kind) {
+            case 1: ((int8_t*)p)[i] = (int8_t)value; break;
+            case 2: ((int16_t*)p)[i] = (int16_t)value; break;
+            case 4: ((int32_t*)p)[i] = (int32_t)value; break;
+            default: ((int64_t*)p)[i] = value; break;
+        }
+    }
+    return n;
+}
+
+// Reads up to `n` reals of the given kind, like `read_list_integers`
+static int read_list_reals(FILE* filep, void* p, int kind, int n) {
+    char token[LIST_TOKEN_SIZE];
+    for (int i = 0; i < n; i++) {
+        if (!read_list_token(filep, token)) return i;
+        bool ok = kind == 4 ? parse_float(token, (float*)p + i)
+                            : parse_double(token, (double*)p + i);
+        if (!ok) {
+            fprintf(stderr, "Error: Invalid input '%s' for real(%d).\n", token, kind);
+            exit(1);
+        }
+    }
+    return n;
 }
 
 LFORTRAN_API void _lfortran_read_int16(int16_t *p, int32_t unit_num)
@@ -3856,25 +6728,24 @@ LFORTRAN_API void _lfortran_read_int16(int16_t *p, int32_t unit_num)
             exit(1);
         }
 
-        // Use strtok() to extract only the first token before any whitespace
-        char *token = strtok(buffer, " \t\n");
-        if (token == NULL) {
+        // Extract only the first token before any whitespace
+        char *token = buffer + strspn(buffer, " \t\n");
+        token[strcspn(token, " \t\n")] = '\0';
+        if (token[0] == '\0') {
             fprintf(stderr, "Error: Invalid input for int16_t.\n");
             exit(1);
         }
 
-        char *endptr = NULL;
+        int64_t long_val;
         errno = 0;
-        long long_val = strtol(token, &endptr, 10);
-
-        if (endptr == token || *endptr != '\0') {
+        if (!parse_integer(token, &long_val) && errno != ERANGE) {
             fprintf(stderr, "Error: Invalid input for int16_t.\n");
             exit(1);
         }
 
         // check for overflow (when input value is more than the int16 limit)
         if (errno == ERANGE || long_val < INT16_MIN || long_val > INT16_MAX) {
-            fprintf(stderr, "Error: Value %ld is out of integer(2) range.\n", long_val);
+            fprintf(stderr, "Error: Value %s is out of integer(2) range.\n", token);
             exit(1);
         }
 
@@ -3884,7 +6755,8 @@ LFORTRAN_API void _lfortran_read_int16(int16_t *p, int32_t unit_num)
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -3896,19 +6768,21 @@ LFORTRAN_API void _lfortran_read_int16(int16_t *p, int32_t unit_num)
             exit(1);
         }
     } else {
-        long temp;
-        if (fscanf(filep, "%ld", &temp) != 1) {
+        char token[LIST_TOKEN_SIZE];
+        int64_t temp;
+        if (!read_list_token(filep, token) || !parse_integer(token, &temp)) {
             fprintf(stderr, "Error: Invalid input for int16_t from file.\n");
             exit(1);
         }
 
         if (temp < INT16_MIN || temp > INT16_MAX) {
-            fprintf(stderr, "Error: Value %ld is out of integer(2) range (file).\n", temp);
+            fprintf(stderr, "Error: Value %" PRId64 " is out of integer(2) range (file).\n", temp);
             exit(1);
         }
 
         *p = (int16_t)temp;
     }
+    release_unit(unit);
 }
 
 // Improved input validation for integer reading
@@ -3923,25 +6797,24 @@ LFORTRAN_API void _lfortran_read_int32(int32_t *p, int32_t unit_num)
             exit(1);
         }
 
-        // Use strtok() to extract only the first token before any whitespace
-        char *token = strtok(buffer, " \t\n");
-        if (token == NULL) {
+        // Extract only the first token before any whitespace
+        char *token = buffer + strspn(buffer, " \t\n");
+        token[strcspn(token, " \t\n")] = '\0';
+        if (token[0] == '\0') {
             fprintf(stderr, "Error: Invalid input for int32_t.\n");
             exit(1);
         }
 
-        char *endptr = NULL;
+        int64_t long_val;
         errno = 0;
-        long long_val = strtol(token, &endptr, 10);
-
-        if (endptr == token || *endptr != '\0') {
+        if (!parse_integer(token, &long_val) && errno != ERANGE) {
             fprintf(stderr, "Error: Invalid input for int32_t.\n");
             exit(1);
         }
 
         // check for overflow (when input value is more than the int32 limit)
         if (errno == ERANGE || long_val < INT32_MIN || long_val > INT32_MAX) {
-            fprintf(stderr, "Error: Value %ld is out of integer(4) range.\n", long_val);
+            fprintf(stderr, "Error: Value %s is out of integer(4) range.\n", token);
             exit(1);
         }
 
@@ -3951,7 +6824,8 @@ LFORTRAN_API void _lfortran_read_int32(int32_t *p, int32_t unit_num)
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -3963,19 +6837,21 @@ LFORTRAN_API void _lfortran_read_int32(int32_t *p, int32_t unit_num)
             exit(1);
         }
     } else {
-        long temp;
-        if (fscanf(filep, "%ld", &temp) != 1) {
+        char token[LIST_TOKEN_SIZE];
+        int64_t temp;
+        if (!read_list_token(filep, token) || !parse_integer(token, &temp)) {
             fprintf(stderr, "Error: Invalid input for int32_t from file.\n");
             exit(1);
         }
 
         if (temp < INT32_MIN || temp > INT32_MAX) {
-            fprintf(stderr, "Error: Value %ld is out of integer(4) range (file).\n", temp);
+            fprintf(stderr, "Error: Value %" PRId64 " is out of integer(4) range (file).\n", temp);
             exit(1);
         }
 
         *p = (int32_t)temp;
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_int64(int64_t *p, int32_t unit_num)
@@ -3987,23 +6863,22 @@ LFORTRAN_API void _lfortran_read_int64(int64_t *p, int32_t unit_num)
             exit(1);
         }
 
-        char *token = strtok(buffer, " \t\n");
-        if (token == NULL) {
+        char *token = buffer + strspn(buffer, " \t\n");
+        token[strcspn(token, " \t\n")] = '\0';
+        if (token[0] == '\0') {
             fprintf(stderr, "Error: Invalid input for int64_t.\n");
             exit(1);
         }
 
+        int64_t long_val;
         errno = 0;
-        char *endptr = NULL;
-        long long long_val = strtoll(token, &endptr, 10);
-
-        if (endptr == token || *endptr != '\0') {
+        if (!parse_integer(token, &long_val) && errno != ERANGE) {
             fprintf(stderr, "Error: Invalid input for int64_t.\n");
             exit(1);
         }
 
-        if (errno == ERANGE || long_val < INT64_MIN || long_val > INT64_MAX) {
-            fprintf(stderr, "Error: Value %lld is out of integer(8) range.\n", long_val);
+        if (errno == ERANGE) {
+            fprintf(stderr, "Error: Value %s is out of integer(8) range.\n", token);
             exit(1);
         }
 
@@ -4012,7 +6887,8 @@ LFORTRAN_API void _lfortran_read_int64(int64_t *p, int32_t unit_num)
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4024,18 +6900,18 @@ LFORTRAN_API void _lfortran_read_int64(int64_t *p, int32_t unit_num)
             exit(1);
         }
     } else {
-        int64_t temp;
-        if (fscanf(filep, "%" PRId64, &temp) != 1) {
-            fprintf(stderr, "Error: Invalid input for int64_t from file.\n");
-            exit(1);
-        }
-        if (temp < INT64_MIN || temp > INT64_MAX) {
-            fprintf(stderr, "Error: Value %" PRId64 " is out of integer(8) range (file).\n", temp);
+        char token[LIST_TOKEN_SIZE];
+        errno = 0;
+        if (!read_list_token(filep, token) || !parse_integer(token, p)) {
+            if (errno == ERANGE) {
+                fprintf(stderr, "Error: Value %s is out of integer(8) range (file).\n", token);
+            } else {
+                fprintf(stderr, "Error: Invalid input for int64_t from file.\n");
+            }
             exit(1);
         }
-
-        *p = (int64_t)temp;
     }
+    release_unit(unit);
 }
 
 // boolean read implementation is in process
@@ -4052,8 +6928,9 @@ LFORTRAN_API void _lfortran_read_logical(bool *p, int32_t unit_num)
         }
 
         // Tokenize input (by whitespace)
-        char *token = strtok(buffer, " \t\n");
-        if (token == NULL) {
+        char *token = buffer + strspn(buffer, " \t\n");
+        token[strcspn(token, " \t\n")] = '\0';
+        if (token[0] == '\0') {
             fprintf(stderr, "Error: Invalid input for logical.\n");
             exit(1);
         }
@@ -4072,7 +6949,8 @@ LFORTRAN_API void _lfortran_read_logical(bool *p, int32_t unit_num)
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4114,6 +6992,7 @@ LFORTRAN_API void _lfortran_read_logical(bool *p, int32_t unit_num)
             exit(1);
         }
     }
+    release_unit(unit);
 }
 
 
@@ -4121,127 +7000,119 @@ LFORTRAN_API void _lfortran_read_array_int8(int8_t *p, int array_size, int32_t u
 {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%s", &p[i]);
-        }
+        read_list_integers(stdin, p, 1, array_size);
         return;
     }
 
     bool unit_file_bin;
     int access_id;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, &access_id);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
+        int64_t size = (int64_t)array_size * sizeof(int8_t);
         if (access_id != 1) {
-            // Read record marker first
-            int32_t record_marker_start;
-            (void)!fread(&record_marker_start, sizeof(int32_t), 1, filep);
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
         }
-        (void)!fread(p, sizeof(int8_t), array_size, filep);
     } else {
-        for (int i = 0; i < array_size; i++) {
-            (void)!fscanf(filep, "%s", &p[i]);
-        }
+        read_list_integers(filep, p, 1, array_size);
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_int16(int16_t *p, int array_size, int32_t unit_num)
 {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%hd", &p[i]);
-        }
+        read_list_integers(stdin, p, 2, array_size);
         return;
     }
 
     bool unit_file_bin;
     int access_id;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, &access_id);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
+        int64_t size = (int64_t)array_size * sizeof(int16_t);
         if (access_id != 1) {
-            // Read record marker first
-            int32_t record_marker_start;
-            (void)!fread(&record_marker_start, sizeof(int32_t), 1, filep);
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
         }
-        (void)!fread(p, sizeof(int16_t), array_size, filep);
     } else {
-        for (int i = 0; i < array_size; i++) {
-            (void)!fscanf(filep, "%hd", &p[i]);
-        }
+        read_list_integers(filep, p, 2, array_size);
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_int32(int32_t *p, int array_size, int32_t unit_num)
 {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%d", &p[i]);
-        }
+        read_list_integers(stdin, p, 4, array_size);
         return;
     }
 
     bool unit_file_bin;
     int access_id;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, &access_id);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
+        int64_t size = (int64_t)array_size * sizeof(int32_t);
         if (access_id != 1) {
-            // Read record marker first
-            int32_t record_marker_start;
-            (void)!fread(&record_marker_start, sizeof(int32_t), 1, filep);
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
         }
-        (void)!fread(p, sizeof(int32_t), array_size, filep);
     } else {
-        for (int i = 0; i < array_size; i++) {
-            (void)!fscanf(filep, "%d", &p[i]);
-        }
+        read_list_integers(filep, p, 4, array_size);
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_int64(int64_t *p, int array_size, int32_t unit_num) {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%" SCNd64, &p[i]);
-        }
+        read_list_integers(stdin, p, 8, array_size);
         return;
     }
 
     bool unit_file_bin;
     int access_id;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, &access_id);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
+        int64_t size = (int64_t)array_size * sizeof(int64_t);
         if (access_id != 1) {
-            // Read record marker first
-            int32_t record_marker_start;
-            (void)!fread(&record_marker_start, sizeof(int32_t), 1, filep);
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
         }
-        (void)!fread(p, sizeof(int64_t), array_size, filep);
     } else {
-        for (int i = 0; i < array_size; i++) {
-            (void)!fscanf(filep, "%" SCNd64, &p[i]);
-        }
+        read_list_integers(filep, p, 8, array_size);
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_char(char **p, int32_t unit_num, ...)
@@ -4264,7 +7135,8 @@ LFORTRAN_API void _lfortran_read_char(char **p, int32_t unit_num, ...)
 
     bool unit_file_bin;
     int access_id;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, &access_id);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4328,6 +7200,7 @@ LFORTRAN_API void _lfortran_read_char(char **p, int32_t unit_num, ...)
         printf("Runtime error: End of file!\n");
         exit(1);
     }
+    release_unit(unit);
 }
 
 
@@ -4343,16 +7216,14 @@ LFORTRAN_API void _lfortran_read_float(float *p, int32_t unit_num)
             exit(1);
         }
 
-        char *token = strtok(buffer, " \t\n");
-        if (token == NULL) {
+        char *token = buffer + strspn(buffer, " \t\n");
+        token[strcspn(token, " \t\n")] = '\0';
+        if (token[0] == '\0') {
             fprintf(stderr, "Error: Invalid input for float.\n");
             exit(1);
         }
 
-        char *endptr;
-        *p = strtof(token, &endptr);
-
-        if (*endptr != '\0') {
+        if (!parse_float(token, p)) {
             fprintf(stderr, "Error: Invalid input for float.\n");
             exit(1);
         }
@@ -4360,7 +7231,8 @@ LFORTRAN_API void _lfortran_read_float(float *p, int32_t unit_num)
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4372,32 +7244,39 @@ LFORTRAN_API void _lfortran_read_float(float *p, int32_t unit_num)
             exit(1);
         }
     } else {
-        if (fscanf(filep, "%f", p) != 1) {
+        char token[LIST_TOKEN_SIZE];
+        if (!read_list_token(filep, token) || !parse_float(token, p)) {
             fprintf(stderr, "Error: Invalid input for float from file.\n");
             exit(1);
         }
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_complex_float(struct _lfortran_complex_32 *p, int array_size, int32_t unit_num)
 {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%f %f", &p[i].re, &p[i].im);
-        }
+        read_list_reals(stdin, p, 4, 2 * array_size);
         return;
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    int access_id;
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
-        (void)!fread(p, sizeof(struct _lfortran_complex_32), array_size, filep);
+        int64_t size = (int64_t)array_size * sizeof(struct _lfortran_complex_32);
+        if (access_id != 1) {
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
+        }
     } else {
         for (int i = 0; i < array_size; i++) {
             // check if `(` is present, if yes, then we strip spaces for each line
@@ -4419,44 +7298,51 @@ LFORTRAN_API void _lfortran_read_array_complex_float(struct _lfortran_complex_32
                     // strip spaces from start and end
                     while (isspace((unsigned char)*start)) start++;
                     while (isspace((unsigned char)*(end - 1))) end--;
-                    p[i].re = strtof(start, NULL);
-                    p[i].im = strtof(comma + 1, NULL);
+                    if (!parse_float(start, &p[i].re) || !parse_float(comma + 1, &p[i].im)) {
+                        fprintf(stderr, "Error: Invalid complex float format '%s'.\n", buffer);
+                        exit(1);
+                    }
                 } else {
                     fprintf(stderr, "Error: Invalid complex float format '%s'.\n", buffer);
                     exit(1);
                 }
             } else {
                 // If no parentheses, read as two separate floats
-                (void)!fscanf(filep, "%f %f", &p[i].re, &p[i].im);
-                // Check if the read was successful
-                if (ferror(filep)) {
+                if (!parse_float(buffer, &p[i].re)
+                        || read_list_reals(filep, &p[i].im, 4, 1) != 1) {
                     fprintf(stderr, "Error: Failed to read complex float from file.\n");
                     exit(1);
                 }
             }
         }
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_complex_double(struct _lfortran_complex_64 *p, int array_size, int32_t unit_num)
 {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%lf %lf", &p[i].re, &p[i].im);
-        }
+        read_list_reals(stdin, p, 8, 2 * array_size);
         return;
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    int access_id;
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
-        (void)!fread(p, sizeof(struct _lfortran_complex_64), array_size, filep);
+        int64_t size = (int64_t)array_size * sizeof(struct _lfortran_complex_64);
+        if (access_id != 1) {
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
+        }
     } else {
         for (int i = 0; i < array_size; i++) {
             // check if `(` is present, if yes, then we strip spaces for each line
@@ -4478,75 +7364,85 @@ LFORTRAN_API void _lfortran_read_array_complex_double(struct _lfortran_complex_6
                     // strip spaces from start and end
                     while (isspace((unsigned char)*start)) start++;
                     while (isspace((unsigned char)*(end - 1))) end--;
-                    p[i].re = strtod(start, NULL);
-                    p[i].im = strtod(comma + 1, NULL);
+                    if (!parse_double(start, &p[i].re) || !parse_double(comma + 1, &p[i].im)) {
+                        fprintf(stderr, "Error: Invalid complex double format '%s'.\n", buffer);
+                        exit(1);
+                    }
                 } else {
                     fprintf(stderr, "Error: Invalid complex double format '%s'.\n", buffer);
                     exit(1);
                 }
             } else {
                 // If no parentheses, read as two separate doubles
-                (void)!fscanf(filep, "%lf %lf", &p[i].re, &p[i].im);
-                // Check if the read was successful
-                if (ferror(filep)) {
+                if (!parse_double(buffer, &p[i].re)
+                        || read_list_reals(filep, &p[i].im, 8, 1) != 1) {
                     fprintf(stderr, "Error: Failed to read complex double from file.\n");
                     exit(1);
                 }
             }
         }
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_float(float *p, int array_size, int32_t unit_num)
 {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%f", &p[i]);
-        }
+        read_list_reals(stdin, p, 4, array_size);
         return;
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    int access_id;
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
-        (void)!fread(p, sizeof(float), array_size, filep);
-    } else {
-        for (int i = 0; i < array_size; i++) {
-            (void)!fscanf(filep, "%f", &p[i]);
+        int64_t size = (int64_t)array_size * sizeof(float);
+        if (access_id != 1) {
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
         }
+    } else {
+        read_list_reals(filep, p, 4, array_size);
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_double(double *p, int array_size, int32_t unit_num)
 {
     if (unit_num == -1) {
         // Read from stdin
-        for (int i = 0; i < array_size; i++) {
-            (void)!scanf("%lf", &p[i]);
-        }
+        read_list_reals(stdin, p, 8, array_size);
         return;
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    int access_id;
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, &access_id);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
     }
 
     if (unit_file_bin) {
-        (void)!fread(p, sizeof(double), array_size, filep);
-    } else {
-        for (int i = 0; i < array_size; i++) {
-            (void)!fscanf(filep, "%lf", &p[i]);
+        int64_t size = (int64_t)array_size * sizeof(double);
+        if (access_id != 1) {
+            (void)read_unformatted_record(filep, p, size);
+        } else {
+            (void)read_unformatted(filep, p, size);
         }
+    } else {
+        read_list_reals(filep, p, 8, array_size);
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_array_char(char **p, int array_size, int32_t unit_num)
@@ -4573,7 +7469,8 @@ LFORTRAN_API void _lfortran_read_array_char(char **p, int array_size, int32_t un
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4597,18 +7494,20 @@ LFORTRAN_API void _lfortran_read_array_char(char **p, int array_size, int32_t un
             p[i][n] = '\0';
         }
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_read_double(double *p, int32_t unit_num)
 {
     if (unit_num == -1) {
         // Read from stdin
-        (void)!scanf("%lf", p);
+        read_list_reals(stdin, p, 8, 1);
         return;
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4617,8 +7516,9 @@ LFORTRAN_API void _lfortran_read_double(double *p, int32_t unit_num)
     if (unit_file_bin) {
         (void)!fread(p, sizeof(*p), 1, filep);
     } else {
-        (void)!fscanf(filep, "%lf", p);
+        read_list_reals(filep, p, 8, 1);
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_formatted_read(int32_t unit_num, int32_t* iostat, int32_t* chunk, char* advance, char* fmt, int32_t no_of_args, ...)
@@ -4726,7 +7626,8 @@ LFORTRAN_API void _lfortran_formatted_read(int32_t unit_num, int32_t* iostat, in
     }
 
     bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!filep) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4737,6 +7638,7 @@ LFORTRAN_API void _lfortran_formatted_read(int32_t unit_num, int32_t* iostat, in
             *iostat = -1;
             va_end(args);
             free(buffer);
+            release_unit(unit);
             return;
         } else {
             // If we have advance="no" specified and we also have '\n' in buffer, iostat = -2 (end of record)
@@ -4790,6 +7692,7 @@ LFORTRAN_API void _lfortran_formatted_read(int32_t unit_num, int32_t* iostat, in
             free(buffer);
         }
     }
+    release_unit(unit);
 }
 
 LFORTRAN_API void _lfortran_empty_read(int32_t unit_num, int32_t* iostat) {
@@ -4799,7 +7702,8 @@ LFORTRAN_API void _lfortran_empty_read(int32_t unit_num, int32_t* iostat) {
     }
 
     bool unit_file_bin;
-    FILE* fp = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
+    struct UNIT_FILE* unit;
+    FILE* fp = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
     if (!fp) {
         printf("No file found with given unit\n");
         exit(1);
@@ -4820,6 +7724,36 @@ LFORTRAN_API void _lfortran_empty_read(int32_t unit_num, int32_t* iostat) {
             *iostat = 0;
         }
     }
+    release_unit(unit);
+}
+
+// Called before the items of a list-directed READ with IOSTAT=. Skips the
+// blanks ahead, and at the end of the file sets *iostat to -1 (IOSTAT_END)
+// and returns true, so that the READ transfers nothing instead of aborting.
+LFORTRAN_API bool _lfortran_list_read_eof(int32_t unit_num, int32_t* iostat) {
+    *iostat = 0;
+    if (unit_num == -1) {
+        return false;
+    }
+
+    bool unit_file_bin;
+    struct UNIT_FILE* unit;
+    FILE* filep = acquire_unit_file(unit_num, &unit, &unit_file_bin, NULL);
+    if (!filep || unit_file_bin) {
+        release_unit(unit);
+        return false;
+    }
+
+    int c = lfortran_getc(filep);
+    while (is_list_blank(c)) c = lfortran_getc(filep);
+    if (c == EOF) {
+        *iostat = -1;
+        release_unit(unit);
+        return true;
+    }
+    ungetc(c, filep);
+    release_unit(unit);
+    return false;
 }
 
 LFORTRAN_API char* _lpython_read(int64_t fd, int64_t n)
@@ -4837,56 +7771,70 @@ LFORTRAN_API char* _lpython_read(int64_t fd, int64_t n)
 
 LFORTRAN_API void _lfortran_file_write(int32_t unit_num, int32_t* iostat, const char *format, ...)
 {
-    bool unit_file_bin;
-    int access_id;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, &access_id);
-    if (!filep) {
-        filep = stdout;
-    }
+    bool unit_file_bin = false;
+    int access_id = 0;
+    FILE* filep = stdout;
+    bool async = async_requested && async_unit == unit_num;
+    struct UNIT_FILE* u = acquire_unit_for_write(unit_num, async);
+    if (u != NULL && u->filep != NULL) {
+        filep = u->filep;
+        unit_file_bin = u->unit_file_bin;
+        access_id = u->access_id;
+    }
+    // Transfers to the standard units are done synchronously
+    async = async && filep != stdout;
+    int64_t id = 0;
     if (unit_file_bin) {
-        fseek(filep, 0, SEEK_END);
         va_list args;
         va_start(args, format);
 
-        size_t total_size = 0;
-        struct {
-            void *ptr;
-            int32_t len;
-        } data[100];  // support max 100 args
-
-        int count = 0;
-
         // Read (size, ptr) until len == -1
+        struct iovec inline_data[32];
+        struct iovec* data = inline_data;
+        int64_t capacity = 32;
+        int64_t count = 0;
+        int64_t total_size = 0;
         while (1) {
-            int32_t len = va_arg(args, int32_t);
+            int64_t len = va_arg(args, int64_t);
             if (len == -1) break; // sentinel
             void* ptr = va_arg(args, void*);
-
-            data[count].ptr = ptr;
-            data[count].len = len;
+            if (count == capacity) {
+                capacity *= 2;
+                struct iovec* grown = (struct iovec*) malloc(capacity * sizeof(struct iovec));
+                if (grown == NULL) {
+                    printf("Runtime error: Not enough memory to write the record\n");
+                    exit(1);
+                }
+                memcpy(grown, data, count * sizeof(struct iovec));
+                if (data != inline_data) free(data);
+                data = grown;
+            }
+            data[count].iov_base = ptr;
+            data[count].iov_len = (size_t)len;
             total_size += len;
             count++;
         }
         va_end(args);
 
-        // Write record marker
-        int32_t record_marker = (int32_t)total_size;
-        if (access_id != 1) fwrite(&record_marker, sizeof(record_marker), 1, filep);
-        size_t written = 0;
-        // Write all data chunks
-        for (int i = 0; i < count; i++) {
-            written += fwrite(data[i].ptr, 1, data[i].len, filep);
+        if (async) id = async_submit(u, true, data, count, total_size);
+        bool written = true;
+        if (id != 0) {
+            async_last = id;
+        } else {
+            fseek(filep, 0, SEEK_END);
+            written = write_unformatted_record(filep, access_id != 1, data,
+                count, total_size);
         }
-        // Write record marker again
-        if (access_id != 1) fwrite(&record_marker, sizeof(record_marker), 1, filep);
+        if (data != inline_data) free(data);
 
-        if (written != total_size) {
+        if (!written) {
             printf("Error writing data to file.\n");
             // TODO: not sure what is the right value of "iostat" in this case
             // it should be a positive value unique from other predefined iostat values
             // like IOSTAT_INQUIRE_INTERNAL_UNIT, IOSTAT_END, and IOSTAT_EOR.
             // currently, I've set it to 11
             if(iostat != NULL) *iostat = 11;
+            release_unit(u);
             exit(1);
         } else {
             if(iostat != NULL) *iostat = 0;
@@ -4900,22 +7848,34 @@ LFORTRAN_API void _lfortran_file_write(int32_t unit_num, int32_t* iostat, const
             if(iostat == NULL){
                 str = str+1;
                 fprintf(stderr, "%s",str);
+                release_unit(u);
                 exit(1);
             } else { // Delegate error handling to the user.
                 *iostat = 11;
+                release_unit(u);
                 return;
             }
         }
-        if(strcmp(format, "%s%s") == 0){
-            char* end = va_arg(args, char*);
-            fprintf(filep, format, str, end);
+        char* end = strcmp(format, "%s%s") == 0 ? va_arg(args, char*) : "";
+        if (async) {
+            struct iovec data[2];
+            data[0].iov_base = str;
+            data[0].iov_len = strlen(str);
+            data[1].iov_base = end;
+            data[1].iov_len = strlen(end);
+            id = async_submit(u, false, data, 2,
+                data[0].iov_len + data[1].iov_len);
+        }
+        if (id != 0) {
+            async_last = id;
         } else {
-            fprintf(filep, format, str);
+            fprintf(filep, "%s%s", str, end);
         }
         if(iostat != NULL) *iostat = 0;
         va_end(args);
     }
-    (void)!ftruncate(fileno(filep), ftell(filep));
+    if (filep != stdout) u->truncate_pending = true;
+    release_unit(u);
 }
 
 LFORTRAN_API void _lfortran_string_write(char **str_holder, int64_t* size, int64_t* capacity, int32_t* iostat, const char *format, ...) {
@@ -4958,19 +7918,45 @@ LFORTRAN_API void _lfortran_string_write(char **str_holder, int64_t* size, int64
     if(iostat != NULL) *iostat = 0;
 }
 
+// Copies the first value of an internal unit into `token`, see `read_list_token`
+static bool string_list_token(const char *str, char token[LIST_TOKEN_SIZE]) {
+    while (is_list_blank((unsigned char)*str)) str++;
+    size_t n = 0;
+    while (str[n] != '\0' && str[n] != ',' && !is_list_blank((unsigned char)str[n])) {
+        if (n == LIST_TOKEN_SIZE - 1) return false;
+        token[n] = str[n];
+        n++;
+    }
+    token[n] = '\0';
+    return n > 0;
+}
+
 LFORTRAN_API void _lfortran_string_read_i32(char *str, char *format, int32_t *i) {
+    char token[LIST_TOKEN_SIZE];
+    int64_t value;
+    if (string_list_token(str, token) && parse_integer(token, &value)
+            && value >= INT32_MIN && value <= INT32_MAX) {
+        *i = (int32_t)value;
+        return;
+    }
     sscanf(str, format, i);
 }
 
 LFORTRAN_API void _lfortran_string_read_i64(char *str, char *format, int64_t *i) {
+    char token[LIST_TOKEN_SIZE];
+    if (string_list_token(str, token) && parse_integer(token, i)) return;
     sscanf(str, format, i);
 }
 
 LFORTRAN_API void _lfortran_string_read_f32(char *str, char *format, float *f) {
+    char token[LIST_TOKEN_SIZE];
+    if (string_list_token(str, token) && parse_float(token, f)) return;
     sscanf(str, format, f);
 }
 
 LFORTRAN_API void _lfortran_string_read_f64(char *str, char *format, double *f) {
+    char token[LIST_TOKEN_SIZE];
+    if (string_list_token(str, token) && parse_double(token, f)) return;
     sscanf(str, format, f);
 }
 
@@ -5045,17 +8031,23 @@ LFORTRAN_API void _lpython_close(int64_t fd)
 
 LFORTRAN_API void _lfortran_close(int32_t unit_num, char* status)
 {
-    bool unit_file_bin;
-    FILE* filep = get_file_pointer_from_unit(unit_num, &unit_file_bin, NULL);
-    if (!filep) {
+    // The locks are held from before the stream is closed until the unit is
+    // removed, so that no transfer on another thread can use the stream
+    struct UNIT_FILE* u = find_unit_and_wait(unit_num);
+    if (u == NULL || u->filep == NULL) {
+        if (u != NULL) io_unlock(&u->lock);
+        io_unlock(&unit_table_lock);
         return;
     }
-    if (fclose(filep) != 0) {
+    sync_unit(u);
+    if (fclose(u->filep) != 0) {
         printf("Error in closing the file!\n");
         exit(1);
     }
+    char * file_name = u->filename;
+    remove_unit(u);
+    io_unlock(&unit_table_lock);
     // TODO: Support other `status` specifiers
-    char * file_name = get_file_name_from_unit(unit_num, &unit_file_bin);
     char* scratch_file = "_lfortran_generated_file";
     bool is_temp_file = strncmp(file_name, scratch_file, strlen(scratch_file)) == 0;
     if ((status && strcmp(status, "delete") == 0) || is_temp_file) {
@@ -5065,7 +8057,6 @@ LFORTRAN_API void _lfortran_close(int32_t unit_num, char* status)
         }
     }
     if (is_temp_file) free(file_name);
-    remove_from_unit_to_file(unit_num);
 }
 
 LFORTRAN_API int32_t _lfortran_ichar(char *c) {
@@ -67,6 +67,8 @@ typedef double _Complex double_complex_t;
 
 LFORTRAN_API double _lfortran_sum(int n, double *v);
 LFORTRAN_API void _lfortran_random_number(int n, double *v);
+LFORTRAN_API int64_t _lfortran_sp_random_fill(int64_t n, float *v);
+LFORTRAN_API int64_t _lfortran_dp_random_fill(int64_t n, double *v);
 LFORTRAN_API void _lfortran_init_random_clock();
 LFORTRAN_API int _lfortran_init_random_seed(unsigned seed);
 LFORTRAN_API double _lfortran_random();
@@ -197,6 +199,8 @@ LFORTRAN_API char* _lfortran_strrepeat_c(char* s, int32_t n);
 LFORTRAN_API void _lfortran_strcat(char** s1, char** s2, char** dest);
 LFORTRAN_API void _lfortran_strcpy_pointer_string(char** x, char *y);
 LFORTRAN_API void _lfortran_strcpy_descriptor_string(char** x, char *y, int64_t* x_string_size, int64_t* x_string_capacity);
+LFORTRAN_API void _lfortran_str_append_descriptor_string(char** x, int64_t* x_string_size,
+    int64_t* x_string_capacity, int32_t n, char** pieces);
 LFORTRAN_API int32_t _lfortran_str_len(char** s);
 LFORTRAN_API int _lfortran_str_ord(char** s);
 LFORTRAN_API int _lfortran_str_ord_c(char* s);
@@ -207,6 +211,9 @@ LFORTRAN_API void _lfortran_memset(void* s, int32_t c, int32_t size);
 LFORTRAN_API int8_t* _lfortran_realloc(int8_t* ptr, int32_t size);
 LFORTRAN_API int8_t* _lfortran_calloc(int32_t count, int32_t size);
 LFORTRAN_API void _lfortran_free(char* ptr);
+LFORTRAN_API void* _lfortran_malloc64(int64_t size);
+LFORTRAN_API int8_t* _lfortran_realloc64(int8_t* ptr, int64_t size);
+LFORTRAN_API int8_t* _lfortran_calloc64(int64_t count, int64_t size);
 LFORTRAN_API void _lfortran_allocate_string(char** ptr, int64_t len, int64_t* size, int64_t* capacity);
 LFORTRAN_API void _lfortran_string_init(int64_t size_plus_one, char *s);
 LFORTRAN_API char* _lfortran_str_item(char* s, int64_t idx);
@@ -235,6 +242,12 @@ LFORTRAN_API char* _lfortran_zone();
 LFORTRAN_API int32_t _lfortran_values(int32_t n);
 LFORTRAN_API float _lfortran_sp_rand_num();
 LFORTRAN_API double _lfortran_dp_rand_num();
+LFORTRAN_API int32_t _lfortran_int32_rand_num();
+LFORTRAN_API int64_t _lfortran_int64_rand_num();
+LFORTRAN_API bool _lfortran_random_init(bool repeatable, bool image_distinct);
+LFORTRAN_API int64_t _lfortran_random_seed(unsigned seed);
+LFORTRAN_API int32_t _lfortran_random_seed_put(int32_t i, int64_t value);
+LFORTRAN_API int32_t _lfortran_random_seed_get(int32_t i);
 LFORTRAN_API int64_t _lpython_open(char *path, char *flags);
 LFORTRAN_API int64_t _lfortran_open(int32_t unit_num, char *f_name, char *status, char* form, char* access, int32_t *iostat, char **iomsg);
 LFORTRAN_API void _lfortran_flush(int32_t unit_num);
@@ -255,6 +268,25 @@ LFORTRAN_API void _lfortran_read_array_double(double *p, int array_size, int32_t
 LFORTRAN_API void _lfortran_read_char(char **p, int32_t unit_num, ...);
 LFORTRAN_API void _lfortran_string_write(char **str, int64_t* size, int64_t* capacity, int32_t* iostat, const char *format, ...);
 LFORTRAN_API void _lfortran_file_write(int32_t unit_num, int32_t* iostat, const char *format, ...);
+LFORTRAN_API void _lfortran_async_begin(int32_t unit_num);
+LFORTRAN_API int64_t _lfortran_async_end();
+LFORTRAN_API void _lfortran_wait(int32_t unit_num, int64_t id, int32_t* iostat);
+LFORTRAN_API bool _lfortran_async_pending(int32_t unit_num, int64_t id);
+LFORTRAN_API void _lfortran_parallel(void (*fn)(void*), void* data, int32_t num_threads, int32_t flags);
+LFORTRAN_API int32_t _lfortran_get_num_threads();
+LFORTRAN_API int32_t _lfortran_get_thread_num();
+LFORTRAN_API void _lfortran_barrier();
+LFORTRAN_API void _lfortran_atomic_start();
+LFORTRAN_API void _lfortran_atomic_end();
+LFORTRAN_API bool _lfortran_loop_dynamic_start(int64_t start, int64_t end, int64_t incr, int64_t chunk, int64_t* istart, int64_t* iend);
+LFORTRAN_API bool _lfortran_loop_dynamic_next(int64_t* istart, int64_t* iend);
+LFORTRAN_API void _lfortran_loop_end_nowait();
+LFORTRAN_API int64_t _lfortran_smatmul(int64_t m, int64_t n, int64_t k, float* a, float* b, float* c);
+LFORTRAN_API int64_t _lfortran_dmatmul(int64_t m, int64_t n, int64_t k, double* a, double* b, double* c);
+LFORTRAN_API int64_t _lfortran_cmatmul(int64_t m, int64_t n, int64_t k, struct _lfortran_complex_32* a, struct _lfortran_complex_32* b, struct _lfortran_complex_32* c);
+LFORTRAN_API int64_t _lfortran_zmatmul(int64_t m, int64_t n, int64_t k, struct _lfortran_complex_64* a, struct _lfortran_complex_64* b, struct _lfortran_complex_64* c);
+LFORTRAN_API float _lfortran_sdot(int64_t n, float* a, float* b);
+LFORTRAN_API double _lfortran_ddot(int64_t n, double* a, double* b);
 LFORTRAN_API void _lfortran_string_read_i32(char *str, char *format, int32_t *i);
 LFORTRAN_API void _lfortran_string_read_i32_array(char *str, char *format, int32_t *arr);
 LFORTRAN_API void _lfortran_string_read_i64(char *str, char *format, int64_t *i);
@@ -267,6 +299,7 @@ LFORTRAN_API void _lfortran_string_read_str(char *str, char *format, char **s);
 LFORTRAN_API void _lfortran_string_read_str_array(char *str, char *format, char **arr);
 LFORTRAN_API void _lfortran_string_read_bool(char *str, char *format, int32_t *i);
 LFORTRAN_API void _lfortran_empty_read(int32_t unit_num, int32_t* iostat);
+LFORTRAN_API bool _lfortran_list_read_eof(int32_t unit_num, int32_t* iostat);
 LFORTRAN_API void _lpython_close(int64_t fd);
 LFORTRAN_API void _lfortran_close(int32_t unit_num, char* status);
 LFORTRAN_API int32_t _lfortran_ichar(char *c);
@@ -282,6 +315,7 @@ LFORTRAN_API char *_lfortran_get_environment_variable(char *name);
 LFORTRAN_API int _lfortran_exec_command(char *cmd);
 
 LFORTRAN_API char* _lcompilers_string_format_fortran(const char* format,const char* serialization_string, int32_t array_sizes_cnt, int32_t string_lengths_cnt, ...);
+LFORTRAN_API char* _lcompilers_string_format_fortran_cached(void** cache, const char* format, const char* serialization_string, int32_t array_sizes_cnt, int32_t string_lengths_cnt, ...);
 
 #ifdef __cplusplus
 }
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include <libasr/config.h>
 #include <libasr/serialization.h>
@@ -37,7 +42,15 @@ public:
         write_int64(symbol_parent_symtab(&x)->counter);
         write_int8(x.type);
         write_string(symbol_name(&x));
+        if (dependencies && symbol_parent_symtab(&x) == dependencies_symtab) {
+            dependencies->insert(symbol_name(&x));
+        }
     }
+
+    // If set, the names of all referenced symbols that live in
+    // `dependencies_symtab` are collected in `dependencies`
+    const SymbolTable *dependencies_symtab = nullptr;
+    std::set<std::string> *dependencies = nullptr;
 };
 
 std::string serialize(const ASR::asr_t &asr) {
@@ -51,6 +64,73 @@ std::string serialize(const ASR::TranslationUnit_t &unit) {
     return serialize((ASR::asr_t&)(unit));
 }
 
+/*
+    Serializes a TranslationUnit containing a single module, such that its
+    symbols can be deserialized one at a time:
+
+    * The TranslationUnit symbol table id
+    * The module itself, with the same fields as visit_Module(), but without
+      its symbol table
+    * The index: for each symbol of the module (in the order used by
+      visit_Module()) its name, the indices of the other module symbols it
+      references and the offset and size of its blob
+    * All blobs concatenated, each serialized by visit_symbol()
+*/
+std::string serialize_indexed_module(const ASR::TranslationUnit_t &unit) {
+    LCOMPILERS_ASSERT(unit.m_symtab->get_scope().size() == 1);
+    const ASR::Module_t &m = *ASR::down_cast<ASR::Module_t>(
+        unit.m_symtab->get_scope().begin()->second);
+
+    std::vector<std::pair<std::string, ASR::symbol_t*>> symbols;
+    for (auto &a : m.m_symtab->get_scope()) {
+        if (!ASR::is_a<ASR::Function_t>(*a.second)) symbols.push_back(a);
+    }
+    for (auto &a : m.m_symtab->get_scope()) {
+        if (ASR::is_a<ASR::Function_t>(*a.second)) symbols.push_back(a);
+    }
+    std::map<std::string, size_t> index;
+    for (size_t i = 0; i < symbols.size(); i++) {
+        index[symbols[i].first] = i;
+    }
+
+    ASRSerializationVisitor v;
+    v.write_int64(unit.m_symtab->counter);
+    v.write_int64(m.base.base.loc.first);
+    v.write_int64(m.base.base.loc.last);
+    v.write_int64(m.m_symtab->counter);
+    v.write_string(m.m_name);
+    v.write_int64(m.n_dependencies);
+    for (size_t i = 0; i < m.n_dependencies; i++) {
+        v.write_string(m.m_dependencies[i]);
+    }
+    v.write_bool(m.m_loaded_from_mod);
+    v.write_bool(m.m_intrinsic);
+
+    std::string blobs;
+    v.write_int64(symbols.size());
+    for (auto &a : symbols) {
+        ASRSerializationVisitor b;
+        std::set<std::string> dependencies;
+        b.dependencies_symtab = m.m_symtab;
+        b.dependencies = &dependencies;
+        b.visit_symbol(*a.second);
+        std::string blob = b.get_str();
+
+        v.write_string(a.first);
+        dependencies.erase(a.first);
+        v.write_int64(dependencies.size());
+        for (auto &d : dependencies) {
+            LCOMPILERS_ASSERT(index.find(d) != index.end());
+            v.write_int64(index[d]);
+        }
+        v.write_int64(blobs.size());
+        v.write_int64(blob.size());
+        blobs += blob;
+    }
+    v.write_string(blobs);
+    return v.get_str();
+}
+
 class ASRDeserializationVisitor :
 #ifdef WITH_LFORTRAN_BINARY_MODFILES
         public BinaryReader,
@@ -60,7 +140,7 @@ class ASRDeserializationVisitor :
         public ASR::DeserializationBaseVisitor<ASRDeserializationVisitor>
 {
 public:
-    ASRDeserializationVisitor(Allocator &al, const std::string &s,
+    ASRDeserializationVisitor(Allocator &al, std::string_view s,
         bool load_symtab_id, uint32_t offset) :
 #ifdef WITH_LFORTRAN_BINARY_MODFILES
             BinaryReader(s),
@@ -75,10 +155,11 @@ public:
     }
 
     char* read_cstring() {
-        std::string s = read_string();
-        LCompilers::Str cs;
-        cs.from_str_view(s);
-        char* p = cs.c_str(al);
+        // Copied straight from the input, which might be a shared modfile
+        std::string_view s = read_string_view();
+        char *p = al.allocate<char>(s.size() + 1);
+        std::memcpy(p, s.data(), s.size());
+        p[s.size()] = '\0';
         return p;
     }
 
@@ -160,6 +241,13 @@ class FixParentSymtabVisitor : public BaseWalkVisitor<FixParentSymtabVisitor>
 private:
     SymbolTable *current_symtab;
 public:
+    // Fixes the symbol `x` that was added to `symtab` (whose own parent is
+    // already correct)
+    void visit_symbol_in(SymbolTable *symtab, const symbol_t &x) {
+        current_symtab = symtab;
+        this->visit_symbol(x);
+    }
+
     void visit_TranslationUnit(const TranslationUnit_t &x) {
         current_symtab = x.m_symtab;
         x.m_symtab->asr_owner = (asr_t*)&x;
@@ -283,6 +371,13 @@ public:
     FixExternalSymbolsVisitor(SymbolTable &symtab) : external_symtab{&symtab},
     attempt{0}, fixed_external_syms{true} {}
 
+    // Fixes the symbol `x` from the symbol table `symtab`
+    void visit_symbol_in(SymbolTable *symtab, const symbol_t &x) {
+        global_symtab = symtab->get_global_scope();
+        current_scope = symtab;
+        this->visit_symbol(x);
+    }
+
     void visit_TranslationUnit(const TranslationUnit_t &x) {
         global_symtab = x.m_symtab;
         for (auto &a : x.m_symtab->get_scope()) {
@@ -411,12 +506,182 @@ void fix_external_symbols(ASR::TranslationUnit_t &unit,
     }
 }
 
-ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
+void fix_external_symbols(const std::vector<ASR::symbol_t*> &symbols,
+        SymbolTable &symtab, SymbolTable &external_symtab) {
+    ASR::FixExternalSymbolsVisitor e(external_symtab);
+    for (int attempt = 1; attempt <= 2; attempt++) {
+        e.fixed_external_syms = true;
+        e.attempt = attempt;
+        for (auto &sym : symbols) {
+            e.visit_symbol_in(&symtab, *sym);
+        }
+        if (e.fixed_external_syms) break;
+    }
+}
+
+/*
+    Deserializes the symbols of a module saved by serialize_indexed_module()
+    on demand. Each lookup deserializes the requested symbol together with
+    the module symbols it transitively references, so that no placeholder
+    created by read_symbol() is left unfilled.
+*/
+class ModuleSymbolLoader : public SymbolLoader {
+private:
+    struct Entry {
+        std::string name;
+        std::vector<size_t> dependencies;
+        size_t offset, size;
+        bool loaded = false;
+    };
+
+    Allocator &al;
+    bool load_symtab_id;
+    uint32_t offset;
+    // Keeps `blobs` alive
+    std::shared_ptr<const FileContents> file;
+    std::string_view blobs;
+    std::vector<Entry> entries;
+    std::map<std::string, size_t> index;
+    // Shared by all blobs, they refer to each other's symbol tables
+    std::map<uint64_t, SymbolTable*> id_symtab_map;
+    uint64_t tu_symtab_id;
+
+public:
+    SymbolTable *symtab;
+
+    ModuleSymbolLoader(Allocator &al, bool load_symtab_id, uint32_t offset,
+            std::shared_ptr<const FileContents> file)
+        : al{al}, load_symtab_id{load_symtab_id}, offset{offset},
+        file{std::move(file)} {}
+
+    void read_index(ASRDeserializationVisitor &v, uint64_t tu_symtab_id,
+            uint64_t symtab_id) {
+        this->tu_symtab_id = tu_symtab_id;
+        id_symtab_map[symtab_id] = symtab;
+        size_t n = v.read_int64();
+        entries.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            Entry &e = entries[i];
+            e.name = v.read_string();
+            size_t n_dependencies = v.read_int64();
+            for (size_t j = 0; j < n_dependencies; j++) {
+                e.dependencies.push_back(v.read_int64());
+            }
+            e.offset = v.read_int64();
+            e.size = v.read_int64();
+            index[e.name] = i;
+        }
+        blobs = v.read_string_view();
+    }
+
+    ASR::symbol_t* load_symbol(const std::string &name) override {
+        auto it = index.find(name);
+        if (it == index.end() || entries[it->second].loaded) return nullptr;
+        load({it->second});
+        return symtab->get_symbol(name);
+    }
+
+    void load_all_symbols() override {
+        std::vector<size_t> roots;
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (!entries[i].loaded) roots.push_back(i);
+        }
+        if (!roots.empty()) load(roots);
+    }
+
+private:
+    void load(const std::vector<size_t> &roots) {
+        std::vector<size_t> closure;
+        std::vector<size_t> stack = roots;
+        while (!stack.empty()) {
+            size_t i = stack.back();
+            stack.pop_back();
+            if (entries[i].loaded) continue;
+            entries[i].loaded = true;
+            closure.push_back(i);
+            for (size_t d : entries[i].dependencies) stack.push_back(d);
+        }
+        // Deserialize in the order in which the symbols were saved
+        std::sort(closure.begin(), closure.end());
+
+        // The module might have been moved to another TranslationUnit since
+        // it was loaded, see ASRUtils::load_module()
+        id_symtab_map[tu_symtab_id] = symtab->parent;
+        // Symbols are added to `symtab` while it is incomplete, so lookups
+        // must not come back here
+        symtab->loader = nullptr;
+        std::vector<ASR::symbol_t*> symbols;
+        for (size_t i : closure) {
+            ASRDeserializationVisitor v(al, blobs.substr(entries[i].offset,
+                entries[i].size), load_symtab_id, offset);
+            std::swap(v.id_symtab_map, id_symtab_map);
+            ASR::symbol_t *sym = ASR::down_cast<ASR::symbol_t>(
+                v.deserialize_symbol());
+            v.symtab_insert_symbol(*symtab, entries[i].name, sym);
+            std::swap(v.id_symtab_map, id_symtab_map);
+            symbols.push_back(symtab->get_symbol(entries[i].name));
+        }
+        ASR::FixParentSymtabVisitor p;
+        for (auto &sym : symbols) {
+            p.visit_symbol_in(symtab, *sym);
+        }
+        symtab->loader = this;
+        if (on_load) on_load(symbols);
+    }
+};
+
+ASR::TranslationUnit_t* deserialize_indexed_module(Allocator &al,
+        std::string_view s, std::shared_ptr<const FileContents> file,
+        bool load_symtab_id, uint32_t offset) {
+    ASRDeserializationVisitor v(al, s, load_symtab_id, offset);
+    uint64_t tu_symtab_id = v.read_int64();
+    Location loc;
+    loc.first = v.read_int64() + offset;
+    loc.last = v.read_int64() + offset;
+    uint64_t symtab_id = v.read_int64();
+    SymbolTable *tu_symtab = al.make_new<SymbolTable>(nullptr);
+    if (load_symtab_id) tu_symtab->counter = tu_symtab_id;
+    SymbolTable *symtab = al.make_new<SymbolTable>(tu_symtab);
+    if (load_symtab_id) symtab->counter = symtab_id;
+    char *name = v.read_cstring();
+    size_t n_dependencies = v.read_int64();
+    Vec<char*> dependencies;
+    dependencies.reserve(al, n_dependencies);
+    for (size_t i = 0; i < n_dependencies; i++) {
+        dependencies.push_back(al, v.read_cstring());
+    }
+    bool loaded_from_mod = v.read_bool();
+    bool intrinsic = v.read_bool();
+    // Like visit_Module(), the name locations are not saved
+    Location *start_name = al.make_new<Location>();
+    start_name->first = start_name->last = 0;
+    Location *end_name = al.make_new<Location>();
+    end_name->first = end_name->last = 0;
+    ASR::asr_t *m = ASR::make_Module_t(al, loc, symtab, name,
+        dependencies.p, dependencies.n, loaded_from_mod, intrinsic,
+        start_name, end_name);
+    symtab->asr_owner = m;
+    tu_symtab->add_symbol(name, ASR::down_cast<ASR::symbol_t>(m));
+
+    // The loader lives as long as the symbol table, which is never freed
+    ModuleSymbolLoader *loader = al.make_new<ModuleSymbolLoader>(al,
+        load_symtab_id, offset, std::move(file));
+    loader->symtab = symtab;
+    loader->read_index(v, tu_symtab_id, symtab_id);
+    symtab->loader = loader;
+
+    ASR::asr_t *tu = ASR::make_TranslationUnit_t(al, loc, tu_symtab,
+        nullptr, 0);
+    tu_symtab->asr_owner = tu;
+    return ASR::down_cast2<ASR::TranslationUnit_t>(tu);
+}
+
+ASR::asr_t* deserialize_asr(Allocator &al, std::string_view s,
         bool load_symtab_id, SymbolTable & /*external_symtab*/, uint32_t offset) {
     return deserialize_asr(al, s, load_symtab_id, offset);
 }
 
-ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
+ASR::asr_t* deserialize_asr(Allocator &al, std::string_view s,
         bool load_symtab_id, uint32_t offset) {
     ASRDeserializationVisitor v(al, s, load_symtab_id, offset);
     ASR::asr_t *node = v.deserialize_node();
@@ -1,19 +1,33 @@
 #ifndef LIBASR_SERIALIZATION_H
 #define LIBASR_SERIALIZATION_H
 
+#include <memory>
+#include <string_view>
+
 #include <libasr/asr.h>
+#include <libasr/file_contents.h>
 
 namespace LCompilers {
 
     std::string serialize(const ASR::asr_t &asr);
     std::string serialize(const ASR::TranslationUnit_t &unit);
-    ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
+    // Serialize / deserialize a TranslationUnit with a single module, whose
+    // symbols are only deserialized when they are first looked up. `s` is a
+    // view into `file`, which is kept alive for that.
+    std::string serialize_indexed_module(const ASR::TranslationUnit_t &unit);
+    ASR::TranslationUnit_t* deserialize_indexed_module(Allocator &al,
+            std::string_view s, std::shared_ptr<const FileContents> file,
+            bool load_symtab_id, uint32_t offset);
+    ASR::asr_t* deserialize_asr(Allocator &al, std::string_view s,
             bool load_symtab_id, SymbolTable &symtab, uint32_t offset);
-    ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
+    ASR::asr_t* deserialize_asr(Allocator &al, std::string_view s,
             bool load_symtab_id, uint32_t offset);
 
     void fix_external_symbols(ASR::TranslationUnit_t &unit,
             SymbolTable &external_symtab);
+    // Fixes `symbols` that were just added to `symtab` by a SymbolLoader
+    void fix_external_symbols(const std::vector<ASR::symbol_t*> &symbols,
+            SymbolTable &symtab, SymbolTable &external_symtab);
 } // namespace LCompilers
 
 #endif // LIBASR_SERIALIZATION_H
@@ -62,10 +62,18 @@ struct PassOptions {
     bool enable_cpython = false;
     bool c_skip_bindpy_pass = false;
     bool openmp = false;
+    // Run `do concurrent` loops on threads, also without `openmp`
+    bool do_concurrent_parallel = false;
+    bool do_concurrent_lfortran_runtime = false; // Instead of GOMP
+    bool do_concurrent_dynamic = false; // Hand out chunks of iterations on demand
+    int64_t do_concurrent_chunk = 0; // Iterations per chunk (0: automatic)
     bool enable_gpu_offloading = false;
     bool time_report = false;
+    size_t pass_jobs = 1; // Threads for function-local passes (0: one per core)
     bool skip_removal_of_unused_procedures_in_pass_array_by_data = false;
     std::vector<std::string> vector_of_time_report;
+    // Paths of the .mod files read by find_and_load_module()
+    std::vector<std::string> loaded_mod_files;
 };
 
 struct CompilerOptions {
@@ -76,6 +84,10 @@ struct CompilerOptions {
 
     bool fixed_form = false;
     bool interactive = false;
+    // Interactive evaluation: compile each input without optimizations and
+    // recompile the procedures called at least `jit_hot_calls` times at O3
+    bool jit_tiered = false;
+    int64_t jit_hot_calls = 1000;
     bool c_preprocessor = false;
     std::vector<std::string> c_preprocessor_defines;
     bool prescan = true;
@@ -134,8 +146,21 @@ struct CompilerOptions {
     bool legacy_array_sections = false;
     bool ignore_pragma = false;
     bool stack_arrays = false;
+    bool no_alias_metadata = false;
+    // LLVM pipeline of `-O`: `opt_level` 0-3, with `size_level` 1 for -Os
+    // and 2 for -Oz. Without `-O` (-1) only `--fast` optimizes, at O3.
+    int opt_level = -1;
+    int size_level = 0;
+    // Run the ThinLTO pre-link pipeline, for a later ThinLTO link
+    bool thin_lto_prelink = false;
+    // Save LLVM bitcode instead of object files, which the ThinLTO backend
+    // optimizes and compiles together when linking
+    bool thin_lto = false;
+    std::string march = ""; // `-march`, "native" for the host CPU
+    std::string mtune = "";
     bool wasm_html = false;
     bool time_report = false;
+    std::string cache_dir = "";
     std::string emcc_embed;
     std::vector<std::string> import_paths;
     Platform platform;
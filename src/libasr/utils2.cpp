@@ -6,6 +6,7 @@
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <mutex>
 #include <random>
 #include <sstream>
 
@@ -16,6 +17,9 @@
 namespace LCompilers {
 
 std::string get_unique_ID() {
+    // Called by the threads of `lfortran -j`
+    static std::mutex rng_mutex;
+    std::lock_guard<std::mutex> lock(rng_mutex);
     static std::random_device dev;
     static std::mt19937 rng(dev());
     std::uniform_int_distribution<int> dist(0, 61);
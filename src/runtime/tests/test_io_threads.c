@@ -0,0 +1,89 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libasr/runtime/lfortran_intrinsics.h>
+
+/*
+ * Writes records to one unit from several threads at once, while other
+ * threads open, write and close units of their own and print to standard
+ * output, then checks that every record reached the shared file whole.
+ * Run it under ThreadSanitizer (configure with -DWITH_TSAN=yes) to check
+ * the runtime for data races.
+ */
+
+#define N_THREADS 8
+#define N_RECORDS 2000
+#define SHARED_UNIT 10
+
+static void* format_cache = NULL;
+
+static void write_record(int32_t unit, int64_t value)
+{
+    char* s = _lcompilers_string_format_fortran_cached(&format_cache,
+        "(I12)", "I8", 0, 0, &value);
+    _lfortran_file_write(unit, NULL, "%s%s", s, "\n");
+    free(s);
+}
+
+static void* writer(void* arg)
+{
+    int64_t t = (int64_t)(intptr_t)arg;
+    int32_t own_unit = 20 + (int32_t)t;
+    char own_file[64];
+    snprintf(own_file, sizeof(own_file), "test_io_threads_%d.txt", (int)t);
+    for (int64_t i = 0; i < N_RECORDS; i++) {
+        write_record(SHARED_UNIT, t * N_RECORDS + i);
+        if (i % 200 == 0) {
+            _lfortran_open(own_unit, own_file, "replace", "formatted",
+                "sequential", NULL, NULL);
+            write_record(own_unit, i);
+            _lfortran_close(own_unit, "delete");
+            _lfortran_printf("%s%s", "thread record", "\n");
+        }
+    }
+    return NULL;
+}
+
+int main()
+{
+    const char* filename = "test_io_threads.txt";
+    _lfortran_open(SHARED_UNIT, (char*)filename, "replace", "formatted",
+        "sequential", NULL, NULL);
+    pthread_t threads[N_THREADS];
+    for (int64_t t = 0; t < N_THREADS; t++) {
+        pthread_create(&threads[t], NULL, writer, (void*)(intptr_t)t);
+    }
+    for (int t = 0; t < N_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    _lfortran_close(SHARED_UNIT, NULL);
+
+    bool* seen = calloc(N_THREADS * N_RECORDS, sizeof(bool));
+    FILE* f = fopen(filename, "r");
+    char line[64];
+    int64_t count = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char* end;
+        int64_t value = strtoll(line, &end, 10);
+        if (strlen(line) != 13 || *end != '\n' || value < 0
+                || value >= N_THREADS * N_RECORDS || seen[value]) {
+            fprintf(stderr, "Unexpected record: '%s'\n", line);
+            return 1;
+        }
+        seen[value] = true;
+        count++;
+    }
+    fclose(f);
+    remove(filename);
+    free(seen);
+    if (count != N_THREADS * N_RECORDS) {
+        fprintf(stderr, "Expected %d records, found %d\n",
+            N_THREADS * N_RECORDS, (int)count);
+        return 1;
+    }
+    return 0;
+}
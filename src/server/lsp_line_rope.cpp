@@ -0,0 +1,358 @@
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+
+#include <server/lsp_line_rope.h>
+
+namespace LCompilers::LanguageServerProtocol {
+
+    struct LineRope::Node {
+        // Shared between the versions of the node created by path copying
+        std::shared_ptr<const std::string> text;
+        std::uint64_t priority;
+        NodePtr left;
+        NodePtr right;
+        std::size_t lines;
+        std::size_t length;
+    };
+
+    namespace {
+
+        // splitmix64 over a process wide counter: cheap, thread safe and
+        // reproducible from run to run.
+        auto nextPriority() -> std::uint64_t {
+            static std::atomic<std::uint64_t> state{0};
+            std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        template <typename NodePtr>
+        inline auto numLinesOf(const NodePtr &t) -> std::size_t {
+            return t ? t->lines : 0;
+        }
+
+        template <typename NodePtr>
+        inline auto lengthOf(const NodePtr &t) -> std::size_t {
+            return t ? t->length : 0;
+        }
+
+        auto terminatorLength(const std::string &line) -> std::size_t {
+            std::size_t n = line.length();
+            if ((n >= 2) && (line[n - 2] == '\r') && (line[n - 1] == '\n')) {
+                return 2;
+            }
+            if ((n >= 1) && ((line[n - 1] == '\n') || (line[n - 1] == '\r'))) {
+                return 1;
+            }
+            return 0;
+        }
+
+    } // namespace
+
+    auto splitLines(const std::string &text) -> std::vector<std::string> {
+        std::vector<std::string> lines;
+        std::size_t start = 0;
+        for (std::size_t index = 0; index < text.length(); ++index) {
+            char c = text[index];
+            if ((c == '\r') && ((index + 1) < text.length())
+                    && (text[index + 1] == '\n')) {
+                ++index;
+                c = '\n';
+            }
+            if ((c == '\n') || (c == '\r')) {
+                lines.push_back(text.substr(start, index + 1 - start));
+                start = index + 1;
+            }
+        }
+        lines.push_back(text.substr(start));
+        return lines;
+    }
+
+    LineRope::LineRope()
+        : LineRope(std::string())
+    {
+        // empty
+    }
+
+    LineRope::LineRope(const std::string &text)
+        : root(build(splitLines(text)))
+    {
+        // empty
+    }
+
+    LineRope::LineRope(NodePtr root)
+        : root(std::move(root))
+    {
+        // empty
+    }
+
+    auto LineRope::numLines() const -> std::size_t {
+        return numLinesOf(root);
+    }
+
+    auto LineRope::length() const -> std::size_t {
+        return lengthOf(root);
+    }
+
+    auto LineRope::node(std::size_t index, const NodePtr &tree) -> const Node & {
+        if (index >= numLinesOf(tree)) {
+            throw std::out_of_range(
+                ("line=" + std::to_string(index) +
+                 " is out-of-bounds for text with " +
+                 std::to_string(numLinesOf(tree)) + " lines.")
+            );
+        }
+        const Node *t = tree.get();
+        while (true) {
+            std::size_t numLeft = numLinesOf(t->left);
+            if (index < numLeft) {
+                t = t->left.get();
+            } else if (index == numLeft) {
+                return *t;
+            } else {
+                index -= numLeft + 1;
+                t = t->right.get();
+            }
+        }
+    }
+
+    auto LineRope::line(std::size_t index) const -> const std::string & {
+        return *node(index, root).text;
+    }
+
+    auto LineRope::lineLength(std::size_t index) const -> std::size_t {
+        const std::string &text = line(index);
+        return text.length() - terminatorLength(text);
+    }
+
+    auto LineRope::lineOffset(std::size_t index) const -> std::size_t {
+        if (index >= numLines()) {
+            throw std::out_of_range(
+                ("line=" + std::to_string(index) +
+                 " is out-of-bounds for text with " +
+                 std::to_string(numLines()) + " lines.")
+            );
+        }
+        std::size_t offset = 0;
+        const Node *t = root.get();
+        while (true) {
+            std::size_t numLeft = numLinesOf(t->left);
+            if (index < numLeft) {
+                t = t->left.get();
+            } else if (index == numLeft) {
+                return offset + lengthOf(t->left);
+            } else {
+                index -= numLeft + 1;
+                offset += lengthOf(t->left) + t->text->length();
+                t = t->right.get();
+            }
+        }
+    }
+
+    auto LineRope::lineAt(
+        std::size_t position,
+        std::size_t &offset
+    ) const -> std::size_t {
+        if (position >= length()) {
+            throw std::out_of_range(
+                ("position=" + std::to_string(position) +
+                 " is out-of-bounds for text of length=" +
+                 std::to_string(length()))
+            );
+        }
+        std::size_t index = 0;
+        offset = 0;
+        const Node *t = root.get();
+        while (true) {
+            std::size_t leftLength = lengthOf(t->left);
+            if (position < leftLength) {
+                t = t->left.get();
+            } else if (position < leftLength + t->text->length()) {
+                offset += leftLength;
+                return index + numLinesOf(t->left);
+            } else {
+                std::size_t skipped = leftLength + t->text->length();
+                position -= skipped;
+                offset += skipped;
+                index += numLinesOf(t->left) + 1;
+                t = t->right.get();
+            }
+        }
+    }
+
+    namespace {
+
+        template <typename Node>
+        auto withChildren(
+            const Node &t,
+            std::shared_ptr<const Node> left,
+            std::shared_ptr<const Node> right
+        ) -> std::shared_ptr<const Node> {
+            std::shared_ptr<Node> copy = std::make_shared<Node>();
+            copy->text = t.text;
+            copy->priority = t.priority;
+            copy->lines = numLinesOf(left) + 1 + numLinesOf(right);
+            copy->length = lengthOf(left) + t.text->length() + lengthOf(right);
+            copy->left = std::move(left);
+            copy->right = std::move(right);
+            return copy;
+        }
+
+    } // namespace
+
+    auto LineRope::split(
+        const NodePtr &t,
+        std::size_t numLines
+    ) -> std::pair<NodePtr, NodePtr> {
+        if (!t) {
+            return {nullptr, nullptr};
+        }
+        if (numLines == 0) {
+            return {nullptr, t};
+        }
+        if (numLines >= t->lines) {
+            return {t, nullptr};
+        }
+        std::size_t numLeft = numLinesOf(t->left);
+        if (numLines <= numLeft) {
+            auto [a, b] = split(t->left, numLines);
+            return {a, withChildren(*t, b, t->right)};
+        }
+        auto [a, b] = split(t->right, numLines - numLeft - 1);
+        return {withChildren(*t, t->left, a), b};
+    }
+
+    auto LineRope::merge(const NodePtr &a, const NodePtr &b) -> NodePtr {
+        if (!a) {
+            return b;
+        }
+        if (!b) {
+            return a;
+        }
+        if (a->priority > b->priority) {
+            return withChildren(*a, a->left, merge(a->right, b));
+        }
+        return withChildren(*b, merge(a, b->left), b->right);
+    }
+
+    auto LineRope::build(const std::vector<std::string> &lines) -> NodePtr {
+        // Builds the Cartesian tree of the lines and their priorities in
+        // linear time, with the usual right spine stack.
+        std::size_t n = lines.size();
+        std::vector<std::uint64_t> priorities(n);
+        std::vector<std::size_t> left(n, n);
+        std::vector<std::size_t> right(n, n);
+        std::vector<std::size_t> spine;
+        for (std::size_t i = 0; i < n; ++i) {
+            priorities[i] = nextPriority();
+            std::size_t last = n;
+            while (!spine.empty() && (priorities[spine.back()] < priorities[i])) {
+                last = spine.back();
+                spine.pop_back();
+            }
+            left[i] = last;
+            if (!spine.empty()) {
+                right[spine.back()] = i;
+            }
+            spine.push_back(i);
+        }
+        std::function<NodePtr(std::size_t)> create = [&](std::size_t i) -> NodePtr {
+            if (i == n) {
+                return nullptr;
+            }
+            NodePtr l = create(left[i]);
+            NodePtr r = create(right[i]);
+            std::shared_ptr<Node> t = std::make_shared<Node>();
+            t->text = std::make_shared<const std::string>(lines[i]);
+            t->priority = priorities[i];
+            t->lines = numLinesOf(l) + 1 + numLinesOf(r);
+            t->length = lengthOf(l) + lines[i].length() + lengthOf(r);
+            t->left = std::move(l);
+            t->right = std::move(r);
+            return t;
+        };
+        return spine.empty() ? nullptr : create(spine.front());
+    }
+
+    auto LineRope::replace(
+        std::size_t startLine,
+        std::size_t startColumn,
+        std::size_t endLine,
+        std::size_t endColumn,
+        const std::string &patch
+    ) const -> LineRope {
+        std::size_t first = startLine;
+        std::size_t last = endLine;
+        std::string text = line(first).substr(0, startColumn);
+        text.append(patch);
+        text.append(line(last).substr(endColumn));
+
+        // A lone "\r" that ends the previous line, or the one that ends the
+        // new text, might now be followed by a "\n" and form a single "\r\n"
+        // terminator, so the neighbouring line has to be split again.
+        if ((first > 0) && (line(first - 1).back() == '\r')) {
+            --first;
+            text.insert(0, line(first));
+        }
+        if (!text.empty() && (text.back() == '\r')
+                && ((last + 1) < numLines())) {
+            ++last;
+            text.append(line(last));
+        }
+
+        std::vector<std::string> lines = splitLines(text);
+        // Unless the region includes the last line, the text ends with a
+        // terminator and the trailing piece is empty
+        if (((last + 1) < numLines()) && lines.back().empty()) {
+            lines.pop_back();
+        }
+
+        auto [head, tail] = split(root, last + 1);
+        auto [prefix, region] = split(head, first);
+        return LineRope(merge(merge(prefix, build(lines)), tail));
+    }
+
+    auto LineRope::appendLines(
+        const NodePtr &t,
+        std::size_t first,
+        std::size_t last,
+        std::string &out
+    ) -> void {
+        if (!t || (first >= last)) {
+            return;
+        }
+        std::size_t numLeft = numLinesOf(t->left);
+        if (first < numLeft) {
+            appendLines(t->left, first, last, out);
+        }
+        if ((first <= numLeft) && (numLeft < last)) {
+            out.append(*t->text);
+        }
+        if (last > numLeft + 1) {
+            appendLines(
+                t->right,
+                (first > numLeft + 1) ? (first - numLeft - 1) : 0,
+                last - numLeft - 1,
+                out
+            );
+        }
+    }
+
+    auto LineRope::appendLines(
+        std::size_t first,
+        std::size_t last,
+        std::string &out
+    ) const -> void {
+        appendLines(root, first, last, out);
+    }
+
+    auto LineRope::str() const -> std::string {
+        std::string text;
+        text.reserve(length());
+        appendLines(0, numLines(), text);
+        return text;
+    }
+
+} // namespace LCompilers::LanguageServerProtocol
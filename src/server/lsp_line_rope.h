@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace LCompilers::LanguageServerProtocol {
+
+    /*
+        An immutable sequence of lines, stored as a persistent treap ordered by
+        line number. Each node holds one line (including its terminator, which
+        is one of "\n", "\r\n" or "\r") and the number of lines and characters
+        in its subtree, so that a line can be looked up by its index or by the
+        position of any of its characters in O(log lines).
+
+        Every line but the last one ends with a terminator; the last one never
+        does (it is empty when the text ends with a newline).
+
+        `replace` returns a new rope that shares all the lines outside of the
+        edited region with the original one, so an edit costs O(edit + log
+        lines) and the original rope stays valid for its readers.
+    */
+    class LineRope {
+    public:
+        LineRope();
+        explicit LineRope(const std::string &text);
+
+        auto numLines() const -> std::size_t;
+        auto length() const -> std::size_t;
+
+        // The line with its terminator
+        auto line(std::size_t index) const -> const std::string &;
+        // The length of the line without its terminator
+        auto lineLength(std::size_t index) const -> std::size_t;
+        // The position of the first character of the line
+        auto lineOffset(std::size_t index) const -> std::size_t;
+        // The line holding the character at `position` (which must be less
+        // than `length()`) and the position of its first character
+        auto lineAt(std::size_t position, std::size_t &offset) const -> std::size_t;
+
+        /*
+            Replaces the characters from (startLine, startColumn) up to
+            (endLine, endColumn) with `patch`. The columns must not exceed
+            `lineLength()` of their lines and the start must not come after
+            the end.
+        */
+        auto replace(
+            std::size_t startLine,
+            std::size_t startColumn,
+            std::size_t endLine,
+            std::size_t endColumn,
+            const std::string &patch
+        ) const -> LineRope;
+
+        // Appends the lines `first` up to, but excluding, `last` to `out`
+        auto appendLines(
+            std::size_t first,
+            std::size_t last,
+            std::string &out
+        ) const -> void;
+
+        auto str() const -> std::string;
+    private:
+        struct Node;
+        typedef std::shared_ptr<const Node> NodePtr;
+
+        NodePtr root;
+
+        explicit LineRope(NodePtr root);
+
+        static auto node(std::size_t index, const NodePtr &tree) -> const Node &;
+        static auto split(
+            const NodePtr &t,
+            std::size_t numLines
+        ) -> std::pair<NodePtr, NodePtr>;
+        static auto merge(const NodePtr &a, const NodePtr &b) -> NodePtr;
+        static auto build(const std::vector<std::string> &lines) -> NodePtr;
+        static auto appendLines(
+            const NodePtr &t,
+            std::size_t first,
+            std::size_t last,
+            std::string &out
+        ) -> void;
+    };
+
+    // Splits `text` after each line terminator (see `LineRope`)
+    auto splitLines(const std::string &text) -> std::vector<std::string>;
+
+} // namespace LCompilers::LanguageServerProtocol
@@ -26,12 +26,12 @@ namespace LCompilers::LanguageServerProtocol {
     ) : _id(nextId())
       , _languageId(languageId)
       , _version(version)
-      , _text(text)
+      , _lines(text)
       , logger(logger.having("LspTextDocument"))
+      , _text(text)
+      , _isTextStale(false)
     {
-        buffer.reserve(8196);
         setUri(uri);
-        indexLines();
     }
 
     LspTextDocument::LspTextDocument(
@@ -40,13 +40,10 @@ namespace LCompilers::LanguageServerProtocol {
     ) : _id(nextId())
       , _languageId("")
       , _version(-1)
-      , _text("")
       , logger(logger.having("LspTextDocument"))
     {
-        buffer.reserve(8196);
         setUri(uri);
-        loadText();
-        indexLines();
+        _lines = LineRope(loadText());
     }
 
     LspTextDocument::LspTextDocument(LspTextDocument &&other) noexcept
@@ -54,23 +51,23 @@ namespace LCompilers::LanguageServerProtocol {
         , _uri(std::move(other._uri))
         , _languageId(std::move(other._languageId))
         , _version(other._version)
-        , _text(std::move(other._text))
+        , _lines(std::move(other._lines))
         , logger(std::move(other.logger))
         , _path(std::move(other._path))
-        , buffer(std::move(other.buffer))
-        , posByLine(std::move(other.posByLine))
-        , lenByLine(std::move(other.lenByLine))
+        , _text(std::move(other._text))
+        , _isTextStale(other._isTextStale)
     {
         // empty
     }
 
-    auto LspTextDocument::loadText() -> void {
+    auto LspTextDocument::loadText() -> std::string {
         std::ifstream fs(_path);
         if (fs.is_open()) {
             std::stringstream ss;
             ss << fs.rdbuf();
-            _text = ss.str();
+            return ss.str();
         }
+        return "";
     }
 
     auto LspTextDocument::id() const -> std::size_t {
@@ -100,15 +97,26 @@ namespace LCompilers::LanguageServerProtocol {
     }
 
     auto LspTextDocument::text() const -> const std::string & {
+        // Callers hold the read lock of `_mutex`, so `_lines` cannot change
+        // until they are done with the returned reference
+        std::unique_lock<std::mutex> textLock(_textMutex);
+        if (_isTextStale) {
+            _text = _lines.str();
+            _isTextStale = false;
+        }
         return _text;
     }
 
+    auto LspTextDocument::lines() const -> LineRope {
+        return _lines;
+    }
+
     auto LspTextDocument::mutex() -> std::shared_mutex & {
         return _mutex;
     }
 
     auto LspTextDocument::numLines() const -> std::size_t {
-        return lenByLine.size();
+        return _lines.numLines();
     }
 
     auto LspTextDocument::lastLine() const -> std::size_t {
@@ -121,13 +129,13 @@ namespace LCompilers::LanguageServerProtocol {
 
     // might include mixed tabs and spaces ...
     auto LspTextDocument::leadingIndentation(std::size_t line) -> std::string_view {
-        std::size_t start = toPosition(line, 0);
-        std::size_t stop = start;
-        while ((stop < _text.length()) && isIndent(_text[stop])) {
-            ++stop;
+        checkPosition(line, 0);
+        const std::string &text = _lines.line(line);
+        std::size_t length = 0;
+        while ((length < text.length()) && isIndent(text[length])) {
+            ++length;
         }
-        std::size_t length = stop - start;
-        return std::string_view(_text.data() + start, length);
+        return std::string_view(text.data(), length);
     }
 
     auto LspTextDocument::slice(
@@ -136,15 +144,24 @@ namespace LCompilers::LanguageServerProtocol {
         std::size_t endLine,
         std::size_t endColumn
     ) const -> std::string {
-        std::size_t start = toPosition(startLine, startColumn);
-        std::size_t stop = toPosition(endLine, endColumn);
-        std::size_t length = stop - start;
-        return _text.substr(start, length);
+        checkPosition(startLine, startColumn);
+        checkPosition(endLine, endColumn);
+        if ((startLine > endLine)
+                || ((startLine == endLine) && (startColumn > endColumn))) {
+            return "";
+        }
+        std::string text;
+        _lines.appendLines(startLine, endLine + 1, text);
+        std::size_t start = startColumn;
+        std::size_t stop = (text.length() - _lines.line(endLine).length()) + endColumn;
+        return text.substr(start, stop - start);
     }
 
     auto LspTextDocument::numColumns(std::size_t line) const -> std::size_t {
         if (line < numLines()) {
-            return lenByLine.at(line);
+            // The last line has a virtual column past its end
+            std::size_t length = _lines.line(line).length();
+            return (line == lastLine()) ? (length + 1) : length;
         }
         throw std::invalid_argument(
             ("line=" + std::to_string(line) +
@@ -157,127 +174,75 @@ namespace LCompilers::LanguageServerProtocol {
         return numColumns(line) - 1;
     }
 
+    auto LspTextDocument::publish(LineRope &lines, int version) -> void {
+        {
+            std::unique_lock<std::shared_mutex> writeLock(_mutex);
+            std::swap(_lines, lines);
+            _version = version;
+            std::unique_lock<std::mutex> textLock(_textMutex);
+            _isTextStale = true;
+        }
+        // The lines of the previous version that are not shared with the new
+        // one are released here, outside of the lock.
+        lines = LineRope();
+    }
+
     auto LspTextDocument::update(
         const std::string &languageId,
         int version,
         const std::string &text
     ) -> void {
-        std::unique_lock<std::shared_mutex> writeLock(_mutex);
-        _languageId = languageId;
-        _version = version;
-        _text = text;
-        indexLines();
+        std::unique_lock<std::mutex> editLock(_editMutex);
+        LineRope lines(text);
+        {
+            std::unique_lock<std::shared_mutex> writeLock(_mutex);
+            _languageId = languageId;
+        }
+        publish(lines, version);
     }
 
+    // NOTE: As required by the LSP specification, each change is relative to
+    // the document produced by the previous one.
     auto LspTextDocument::apply(
         std::vector<TextDocumentContentChangeEvent> &changes,
         int version
     ) -> void {
-        std::sort(
-            changes.begin(),
-            changes.end(),
-            [this](auto &a, auto &b) {
-                return from(a) < from(b);
-            }
-        );
-
-        std::unique_lock<std::shared_mutex> writeLock(_mutex);
-
-        buffer.clear();
-        std::size_t i = 0;
+        std::unique_lock<std::mutex> editLock(_editMutex);
+        // Only this thread may replace `_lines` while `_editMutex` is held,
+        // so the current version can be read without `_mutex`.
+        LineRope lines = _lines;
         for (const auto &change : changes) {
-            std::size_t j;
-            std::size_t k;
-            std::string patch;
-            decompose(change, j, k, patch);
-            if (i < _text.length()) {
-                buffer.append(_text.substr(i, (j - i)));
-            }
-            buffer.append(patch);
-            i = k;
-        }
-        if (i < _text.length()) {
-            buffer.append(_text.substr(i, (_text.length() - i)));
-        }
-        _text = buffer;
-        indexLines();
-        _version = version;
-    }
-
-    auto LspTextDocument::indexLines() -> void {
-        posByLine.clear();
-        lenByLine.clear();
-        posByLine.push_back(0);
-        std::size_t column = 0;
-        for (std::size_t index = 0; index < _text.length(); ++index) {
-            unsigned char c = _text[index];
-            switch (c) {
-            case '\r': {
-                if (((index + 1) < _text.length()) && (_text[index + 1] == '\n')) {
-                    ++index;
-                    ++column;
-                }
-            } // fallthrough
-            case '\n': {
-                posByLine.push_back(index + 1);
-                lenByLine.push_back(column + 1);
-                column = 0;
-                break;
-            }
-            default: {
-                ++column;
-            }
-            }
-        }
-        lenByLine.push_back(column + 1);
-    }
-
-    auto LspTextDocument::from(
-        const TextDocumentContentChangeEvent &event
-    ) const -> std::size_t {
-        switch (event.type()) {
-        case TextDocumentContentChangeEventType::TextDocumentContentChangeEvent_0: {
-            return from(event.textDocumentContentChangeEvent_0());
-        }
-        case TextDocumentContentChangeEventType::TextDocumentContentChangeEvent_1: {
-            return from(event.textDocumentContentChangeEvent_1());
-        }
-        case TextDocumentContentChangeEventType::Uninitialized: {
-            throw std::invalid_argument("event has not been initialized!");
-        }
+            lines = apply(lines, change);
         }
-        throw std::runtime_error("This should be unreachable.");
-    }
-
-    auto LspTextDocument::from(
-        const TextDocumentContentChangeEvent_0 &event
-    ) const -> std::size_t {
-        const Range &range = event.range;
-        const Position &start = range.start;
-        std::size_t index = posByLine[start.line] + start.character;
-        return index;
+        publish(lines, version);
     }
 
-    auto LspTextDocument::toPosition(
+    auto LspTextDocument::checkPosition(
         std::size_t line,
         std::size_t column
-    ) const -> std::size_t {
-        if (line >= posByLine.size()) {
+    ) const -> void {
+        if (line >= numLines()) {
             throw std::invalid_argument(
                 ("line=" + std::to_string(line) +
                  " is greater than the number of lines: " +
-                 std::to_string(posByLine.size()))
+                 std::to_string(numLines()))
             );
         }
-        if (column >= lenByLine[line]) {
+        if (column >= numColumns(line)) {
             throw std::invalid_argument(
                 ("column=" + std::to_string(column) +
                  " is greater than the number of columns on line=" +
-                 std::to_string(line) + ": " + std::to_string(lenByLine[line]))
+                 std::to_string(line) + ": " + std::to_string(numColumns(line)))
             );
         }
-        std::size_t position = posByLine[line] + column;
-        return position;
+    }
+
+    auto LspTextDocument::toPosition(
+        std::size_t line,
+        std::size_t column
+    ) const -> std::size_t {
+        checkPosition(line, column);
+        return _lines.lineOffset(line) + column;
     }
 
     auto LspTextDocument::fromPosition(
@@ -285,28 +250,16 @@ namespace LCompilers::LanguageServerProtocol {
         std::size_t &column,
         std::size_t position
     ) const -> void {
-        if (position >= _text.length()) {
+        if (position >= _lines.length()) {
             throw std::invalid_argument(
                 ("position=" + std::to_string(position) +
                 " is out-of-bounds for text of length=" +
-                std::to_string(_text.length()))
+                std::to_string(_lines.length()))
             );
         }
-        std::size_t lower = 0;
-        std::size_t upper = posByLine.size() - 1;
-        line = (lower + upper + 1) >> 1;
-        long long scol = position - posByLine[line];
-        while ((scol < 0)
-               || (static_cast<std::size_t>(scol) >= lenByLine[line])) {
-            if (scol < 0) {
-                upper = line - 1;
-            } else {
-                lower = line;
-            }
-            line = (lower + upper + 1) >> 1;
-            scol = position - posByLine[line];
-        }
-        column = static_cast<std::size_t>(scol);
+        std::size_t offset;
+        line = _lines.lineAt(position, offset);
+        column = position - offset;
     }
 
     inline bool isIdentifier(unsigned char c) {
@@ -317,106 +270,100 @@ namespace LCompilers::LanguageServerProtocol {
         std::size_t line,
         std::size_t column
     ) const -> std::string_view {
-        std::size_t lower = toPosition(line, column);
+        checkPosition(line, column);
+        // Identifiers never span lines
+        const std::string &text = _lines.line(line);
+        std::size_t lower = std::min(column, text.length());
         std::size_t upper = lower;
-        while ((lower > 0) && isIdentifier(_text[lower - 1])) {
+        while ((lower > 0) && isIdentifier(text[lower - 1])) {
             --lower;
         }
-        while ((upper < _text.length()) && isIdentifier(upper + 1)) {
+        while ((upper < text.length()) && isIdentifier(text[upper])) {
             ++upper;
         }
         std::size_t length = upper - lower;
-        return std::string_view(_text.data() + lower, length);
-    }
-
-    auto LspTextDocument::from(
-        const TextDocumentContentChangeEvent_1 &/*event*/
-    ) const -> std::size_t {
-        return 0;
+        return std::string_view(text.data() + lower, length);
     }
 
-    auto LspTextDocument::decompose(
-        const TextDocumentContentChangeEvent &event,
-        std::size_t &j,
-        std::size_t &k,
-        std::string &patch
-    ) -> void {
+    auto LspTextDocument::apply(
+        const LineRope &lines,
+        const TextDocumentContentChangeEvent &event
+    ) const -> LineRope {
         switch (event.type()) {
         case TextDocumentContentChangeEventType::TextDocumentContentChangeEvent_0: {
             const TextDocumentContentChangeEvent_0 &partial = event.textDocumentContentChangeEvent_0();
-            decompose(partial, j, k, patch);
-            break;
+            return apply(lines, partial);
         }
         case TextDocumentContentChangeEventType::TextDocumentContentChangeEvent_1: {
             const TextDocumentContentChangeEvent_1 &whole = event.textDocumentContentChangeEvent_1();
-            decompose(whole, j, k, patch);
-            break;
+            return apply(lines, whole);
         }
         case TextDocumentContentChangeEventType::Uninitialized: {
             throw std::invalid_argument("event has not been initialized!");
         }
         }
+        throw std::runtime_error("This should be unreachable.");
     }
 
-    auto LspTextDocument::decompose(
-        const TextDocumentContentChangeEvent_0 &event,
-        std::size_t &j,
-        std::size_t &k,
-        std::string &patch
-    ) -> void {
+    auto LspTextDocument::apply(
+        const LineRope &lines,
+        const TextDocumentContentChangeEvent_0 &event
+    ) const -> LineRope {
         const Range &range = event.range;
         const Position &start = range.start;
         const Position &end = range.end;
+        std::string message;
 
         if (start.line > end.line) {
-            buffer.clear();
-            buffer.append("start.line must be <= end.line, but ");
-            buffer.append(std::to_string(start.line));
-            buffer.append(" > ");
-            buffer.append(std::to_string(end.line));
-            throw LSP_EXCEPTION(ErrorCodes::InvalidParams, buffer);
+            message.append("start.line must be <= end.line, but ");
+            message.append(std::to_string(start.line));
+            message.append(" > ");
+            message.append(std::to_string(end.line));
+            throw LSP_EXCEPTION(ErrorCodes::InvalidParams, message);
         }
 
         if ((start.line == end.line) && (start.character > end.character)) {
-            buffer.clear();
-            buffer.append("start.character must be <= end.character when colinear, but ");
-            buffer.append(std::to_string(start.character));
-            buffer.append(" > ");
-            buffer.append(std::to_string(end.character));
-            throw LSP_EXCEPTION(ErrorCodes::InvalidParams, buffer);
+            message.append("start.character must be <= end.character when colinear, but ");
+            message.append(std::to_string(start.character));
+            message.append(" > ");
+            message.append(std::to_string(end.character));
+            throw LSP_EXCEPTION(ErrorCodes::InvalidParams, message);
         }
 
-        if (start.line < posByLine.size()) {
-            j = posByLine[start.line] + start.character;
-        } else if (start.line == posByLine[posByLine.size() - 1] + 1) {
-            j = _text.length();
-        } else {
-            buffer.clear();
-            buffer.append("start.line must be <= ");
-            buffer.append(std::to_string(posByLine[posByLine.size() - 1] + 1));
-            buffer.append(" but was: ");
-            buffer.append(std::to_string(start.line));
-            throw LSP_EXCEPTION(ErrorCodes::InvalidParams, buffer);
+        if (start.line > lines.numLines()) {
+            message.append("start.line must be <= ");
+            message.append(std::to_string(lines.numLines()));
+            message.append(" but was: ");
+            message.append(std::to_string(start.line));
+            throw LSP_EXCEPTION(ErrorCodes::InvalidParams, message);
         }
 
-        if (end.line < posByLine.size()) {
-            k = posByLine[end.line] + end.character;
-        } else {
-            k = j + event.text.length();
+        // Positions past the end of a line refer to its end, and the ones
+        // past the last line to the end of the document.
+        std::size_t lastLine = lines.numLines() - 1;
+        std::size_t startLine = start.line;
+        std::size_t startColumn = start.character;
+        if (startLine > lastLine) {
+            startLine = lastLine;
+            startColumn = lines.lineLength(lastLine);
         }
+        startColumn = std::min(startColumn, lines.lineLength(startLine));
+        std::size_t endLine = end.line;
+        std::size_t endColumn = end.character;
+        if (endLine > lastLine) {
+            endLine = lastLine;
+            endColumn = lines.lineLength(lastLine);
+        }
+        endColumn = std::min(endColumn, lines.lineLength(endLine));
 
-        patch = event.text;
+        return lines.replace(startLine, startColumn, endLine, endColumn, event.text);
     }
 
-    auto LspTextDocument::decompose(
-        const TextDocumentContentChangeEvent_1 &event,
-        std::size_t &j,
-        std::size_t &k,
-        std::string &patch
-    ) -> void {
-        j = 0;
-        k = _text.length();
-        patch = event.text;
+    auto LspTextDocument::apply(
+        const LineRope &/*lines*/,
+        const TextDocumentContentChangeEvent_1 &event
+    ) const -> LineRope {
+        return LineRope(event.text);
     }
 
 } // namespace LCompilers::LanguageServerProtocol
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <filesystem>
+#include <mutex>
 #include <shared_mutex>
 #include <regex>
 #include <string>
@@ -9,6 +10,7 @@
 #include <vector>
 
 #include <server/logger.h>
+#include <server/lsp_line_rope.h>
 #include <server/lsp_specification.h>
 
 namespace LCompilers::LanguageServerProtocol {
@@ -26,6 +28,13 @@ namespace LCompilers::LanguageServerProtocol {
         std::regex_constants::ECMAScript | std::regex_constants::icase
     );
 
+    /*
+        The text of a document open in the editor. It is kept in a `LineRope`,
+        so that the line index is maintained incrementally and an edit costs
+        O(edit + log lines): `apply` builds the new version without holding
+        `mutex()` and only takes it exclusively to publish it. The flat text
+        returned by `text()` is only assembled when somebody asks for it.
+    */
     class LspTextDocument {
     public:
         LspTextDocument(
@@ -48,6 +57,9 @@ namespace LCompilers::LanguageServerProtocol {
         auto languageId() const -> const std::string &;
         auto version() const -> int;
         auto text() const -> const std::string &;
+        // The current version of the text. The rope is immutable, so it
+        // stays valid after `mutex()` is released.
+        auto lines() const -> LineRope;
         auto mutex() -> std::shared_mutex &;
         auto numLines() const -> std::size_t;
         auto lastLine() const -> std::size_t;
@@ -91,45 +103,33 @@ namespace LCompilers::LanguageServerProtocol {
         DocumentUri _uri;
         std::string _languageId;
         int _version;
-        std::string _text;
+        LineRope _lines;
         lsl::Logger logger;
         fs::path _path;
-        std::string buffer;
-        std::vector<std::size_t> posByLine;
-        std::vector<std::size_t> lenByLine;
         std::shared_mutex _mutex;
+        // Serializes the writers, which read `_lines` without `_mutex`
+        std::mutex _editMutex;
+        // `text()` is assembled lazily, under the read lock of `_mutex`
+        mutable std::string _text;
+        mutable bool _isTextStale = true;
+        mutable std::mutex _textMutex;
 
-        auto indexLines() -> void;
-        auto loadText() -> void;
+        auto loadText() -> std::string;
+        auto publish(LineRope &lines, int version) -> void;
+        auto checkPosition(std::size_t line, std::size_t column) const -> void;
 
-        auto from(
+        auto apply(
+            const LineRope &lines,
             const TextDocumentContentChangeEvent &event
-        ) const -> std::size_t;
-        auto from(
+        ) const -> LineRope;
+        auto apply(
+            const LineRope &lines,
             const TextDocumentContentChangeEvent_0 &event
-        ) const -> std::size_t;
-        auto from(
+        ) const -> LineRope;
+        auto apply(
+            const LineRope &lines,
             const TextDocumentContentChangeEvent_1 &event
-        ) const -> std::size_t;
-
-        auto decompose(
-            const TextDocumentContentChangeEvent &event,
-            std::size_t &j,
-            std::size_t &k,
-            std::string &patch
-        ) -> void;
-        auto decompose(
-            const TextDocumentContentChangeEvent_0 &event,
-            std::size_t &j,
-            std::size_t &k,
-            std::string &patch
-        ) -> void;
-        auto decompose(
-            const TextDocumentContentChangeEvent_1 &event,
-            std::size_t &j,
-            std::size_t &k,
-            std::string &patch
-        ) -> void;
+        ) const -> LineRope;
     };
 
 } // namespace LCompilers::LanguageServerProtocol
@@ -0,0 +1,5 @@
+program parallel_compilation_02
+use parallel_compilation_02a, only: n
+implicit none
+print *, n
+end program
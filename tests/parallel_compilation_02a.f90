@@ -0,0 +1,6 @@
+! Does not compile: test_lfortran_cmdline checks that `-j` skips the files
+! that use this module
+module parallel_compilation_02a
+implicit none
+integer :: n = undefined_name
+end module